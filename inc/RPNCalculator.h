@@ -26,17 +26,31 @@
                   evaluation.
 
     @see        - RPNCalculator_tokenize
+                - RPNCalculator_tokenizeLength
                 - RPNCalculator_infixToPostfix
                 - RPNCalculator_evaluatePostfix
                 - RPNCalculator_whichOperator
                 - RPNCalculator_whichFunction
+                - RPNCalculator_functionArity
                 - RPNCalculator_checkPrecedence
                 - RPNCalculator_isRightAssociative
+                - RPNCalculator_isVariable
  =========================================================================== **/
 
 #ifndef RPNCALCULATOR_H_
 #define RPNCALCULATOR_H_
 
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /* ==================================== *\
  *           PUBLIC DEFINES             *
 \* ==================================== */
@@ -81,6 +95,80 @@
  ==================================== **/ 
 #define MAX_TOKEN_LEN           (unsigned int)(64U)
 
+/** ====================================
+  @def      MAX_FUNCTION_ARITY
+  @package  RPN_calculator
+  @brief    Defines the maximum number
+            of arguments of a built-in
+            function.
+ ==================================== **/
+#define MAX_FUNCTION_ARITY      (unsigned int)(3U)
+
+/* ==================================== *\
+ *       PUBLIC TYPES DEFINITION        *
+\* ==================================== */
+
+/** ============================================================================
+  @enum     funcIndex
+  @package  RPN_calculator
+
+  @typedef  func_index_t
+
+  @brief    Defines indices for mathematical functions.
+
+  @details  Enumerates the indices corresponding to supported mathematical 
+            functions, used for function identification and lookup. The
+            functions after FUNC_POW10 take more than one argument, see
+            RPNCalculator_functionArity.
+ =========================================================================== **/
+typedef enum funcIndex
+{
+    FUNC_SQRT,     /*< Square root function >*/
+    FUNC_LOG,      /*< Logarithm base 10 function >*/
+    FUNC_LN,       /*< Natural logarithm function >*/
+    FUNC_SIN,      /*< Sine function >*/
+    FUNC_COS,      /*< Cosine function >*/
+    FUNC_TAN,      /*< Tangent function >*/
+    FUNC_COSH,     /*< Hyperbolic cosine function >*/
+    FUNC_SINH,     /*< Hyperbolic sine function >*/
+    FUNC_TANH,     /*< Hyperbolic tangent function >*/
+    FUNC_ASIN,     /*< Inverse sine function >*/
+    FUNC_ACOS,     /*< Inverse cosine function >*/
+    FUNC_ATAN,     /*< Inverse tangent function >*/
+    FUNC_ARCSIN,   /*< Alternate inverse sine function >*/
+    FUNC_ARCCOS,   /*< Alternate inverse cosine function >*/
+    FUNC_ARCTAN,   /*< Alternate inverse tangent function >*/
+    FUNC_POW10,    /*< Power of ten function >*/
+    FUNC_ATAN2,    /*< Two-argument inverse tangent function >*/
+    FUNC_HYPOT,    /*< Euclidean distance function >*/
+    FUNC_MIN,      /*< Minimum of two values >*/
+    FUNC_MAX,      /*< Maximum of two values >*/
+    FUNC_FMA,      /*< Fused multiply-add function >*/
+    FUNC_COUNT     /*< Total number of functions >*/
+} func_index_t;
+
+/** ============================================================================
+  @enum     operatorIndex
+  @package  RPN_calculator
+
+  @typedef  operator_index_t
+
+  @brief    Defines indices for operators.
+
+  @details  Enumerates the indices corresponding to supported operators,
+            used for operator identification and lookup.
+ =========================================================================== **/
+typedef enum operatorIndex
+{
+    OP_ADD,    /*< Addition operator '+' >*/
+    OP_SUB,    /*< Subtraction operator '-' >*/
+    OP_MUL,    /*< Multiplication operator '*' >*/
+    OP_DIV,    /*< Division operator '/' >*/
+    OP_POW,    /*< Exponentiation operator '^' >*/
+    OP_FACT,   /*< Factorial operator '!' >*/
+    OP_COUNT   /*< Total number of operators >*/
+} operator_index_t;
+
 /* ==================================== *\
  *     PUBLIC FUNCTIONS PROTOTYPES      *
 \* ==================================== */
@@ -160,6 +248,72 @@ int RPNCalculator_checkPrecedence(const char* token);
  =========================================================================== **/
 int RPNCalculator_isRightAssociative(const char* token);
 
+/** ============================================================================
+  @fn       RPNCalculator_isVariable
+  @package  RPN_calculator
+  
+  @brief    Checks if a given token names a variable.
+ 
+  @details  A variable is an identifier (a letter or '_' followed by letters,
+            digits or '_') that is not a function name. Variables are operands
+            for RPNCalculator_infixToPostfix; RPNCalculator_evaluatePostfix
+            has no bindings and rejects them, while compiled programs bind
+            them through Program_evaluateWith.
+ 
+  @param    token    [in]:   String representing the token to check.
+ 
+  @return   0 if the token is a variable.
+            -ENOMEM if token is NULL.
+            -EINVAL if the token is not a variable.
+ =========================================================================== **/
+int RPNCalculator_isVariable(const char* token);
+
+/** ============================================================================
+  @fn       RPNCalculator_nextToken
+  @package  RPN_calculator
+  
+  @brief    Reads the next token of an expression.
+ 
+  @details  Skips whitespace from the given position and extracts one number,
+            identifier, operator or bracket, using the same rules as
+            RPNCalculator_tokenize. On success the position is moved past the
+            token, so the token starts at the new position minus its length.
+ 
+  @param    expression   [in]:       String representing the mathematical
+                                     expression.
+  @param    position     [in/out]:   Offset to read from; advanced past the
+                                     token.
+  @param    token        [out]:      Receives the NUL-terminated token.
+ 
+  @return   Length of the token on success, 0 at the end of the expression.
+            -ENOMEM if an argument is NULL.
+            -EINVAL if the character is not recognized.
+ =========================================================================== **/
+int RPNCalculator_nextToken(const char* expression, size_t* position, char token[MAX_TOKEN_LEN]);
+
+/** ============================================================================
+  @fn       RPNCalculator_nextTokenLength
+  @package  RPN_calculator
+  
+  @brief    Reads the next token of an expression of known length.
+ 
+  @details  Works as RPNCalculator_nextToken, but never reads at or past
+            `length`, so the expression does not need a NUL terminator.
+ 
+  @param    expression   [in]:       String representing the mathematical
+                                     expression.
+  @param    length       [in]:       Number of characters of the expression;
+                                     a NUL before it also ends it.
+  @param    position     [in/out]:   Offset to read from; advanced past the
+                                     token.
+  @param    token        [out]:      Receives the NUL-terminated token.
+ 
+  @return   Length of the token on success, 0 at the end of the expression.
+            -ENOMEM if an argument is NULL.
+            -EINVAL if the character is not recognized.
+ =========================================================================== **/
+int RPNCalculator_nextTokenLength(const char* expression, size_t length, size_t* position, char token[MAX_TOKEN_LEN]);
+
 /** ============================================================================
   @fn       RPNCalculator_tokenize
   @package  RPN_calculator
@@ -183,6 +337,27 @@ int RPNCalculator_isRightAssociative(const char* token);
  =========================================================================== **/
 int RPNCalculator_tokenize(const char* expression, char tokens[][MAX_TOKEN_LEN]);
 
+/** ============================================================================
+  @fn       RPNCalculator_tokenizeLength
+  @package  RPN_calculator
+  
+  @brief    Tokenizes an expression of known length into individual tokens.
+ 
+  @details  Works as RPNCalculator_tokenize on the first `length`
+            characters, without needing a NUL terminator, so views into a
+            larger buffer are tokenized in place.
+ 
+  @param    expression   [in]:   String representing the mathematical expression 
+                                 to tokenize.
+  @param    length       [in]:   Number of characters of the expression.
+  @param    tokens       [out]:  Array to store the extracted tokens.
+ 
+  @return   Number of tokens on success,
+            -ENOMEM if token is NULL.
+            -EINVAL if the function is not recognized.
+ =========================================================================== **/
+int RPNCalculator_tokenizeLength(const char* expression, size_t length, char tokens[][MAX_TOKEN_LEN]);
+
 /** ============================================================================
   @fn       RPNCalculator_infixToPostfix
   @package  RPN_calculator
@@ -192,6 +367,9 @@ int RPNCalculator_tokenize(const char* expression, char tokens[][MAX_TOKEN_LEN])
   @details  Implements the Shunting Yard algorithm to convert an infix expression
             represented by tokens into a postfix expression, considering operator
             precedence and associativity.
+            An identifier directly followed by an open bracket is a user
+            function call: it is emitted after its arguments, which are
+            separated by commas, like the built-in functions.
 
   @param    tokens    [in]:  Array of strings representing the infix expression 
                              tokens.
@@ -252,10 +430,43 @@ double RPNCalculator_applyOperation(const char* operation, double num_a, double
   @param    number      [in]:  The operand to apply the function to.
 
   @return   The result of the function as a double.
-            Returns NAN if the function is invalid.
+            Returns NAN if the function is invalid or takes more than one
+            argument.
  =========================================================================== **/
 double RPNCalculator_applyFunction(const char* function, double number);
 
+/** ============================================================================
+  @fn       RPNCalculator_functionArity
+  @package  RPN_calculator
+
+  @brief    Returns the number of arguments a function takes.
+
+  @param    token    [in]:   String representing the function.
+
+  @return   Arity on success, between 1 and MAX_FUNCTION_ARITY.
+            -ENOMEM if token is NULL.
+            -EINVAL if the function is not recognized.
+ =========================================================================== **/
+int RPNCalculator_functionArity(const char* token);
+
+/** ============================================================================
+  @fn       RPNCalculator_applyFunctionArgs
+  @package  RPN_calculator
+
+  @brief    Applies a mathematical function to its arguments.
+
+  @details  Extends RPNCalculator_applyFunction to functions of any arity.
+            The arguments are given in call order, so "atan2(y, x)" receives
+            y first.
+
+  @param    function    [in]:  String representing the function.
+  @param    arguments   [in]:  As many operands as the function takes.
+
+  @return   The result of the function as a double.
+            -EINVAL if the function is invalid.
+ =========================================================================== **/
+double RPNCalculator_applyFunctionArgs(const char* function, const double* arguments);
+
 /** ============================================================================
   @fn       RPNCalculator_evaluatePostfix
   @package  RPN_calculator
@@ -274,6 +485,10 @@ double RPNCalculator_applyFunction(const char* function, double number);
  =========================================================================== **/
 double RPNCalculator_evaluatePostfix(char output[][MAX_TOKEN_LEN], int number);
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* RPNCALCULATOR_H_ */
 
 /*< end of header file >*/
@@ -0,0 +1,355 @@
+/** ===========================================================================
+    @addtogroup Alloc
+    @addtogroup Alloc_Module alloc
+
+    @package    alloc
+    @brief      This module routes every allocation of the library through
+                replaceable allocator hooks.
+
+    @file       alloc.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    An alloc_t bundles allocate, reallocate and release hooks
+                with a context pointer. The hooks receive the alignment
+                and, when releasing or resizing, the size of the block, so
+                an allocator can place memory on a NUMA node, back it with
+                huge pages or account for it without keeping its own
+                bookkeeping.
+
+                The library allocates with Alloc_malloc and friends, which
+                use the allocator of the calling thread if one was set with
+                Alloc_setThread, and the global one from Alloc_setGlobal
+                otherwise. Every block records the allocator that made it,
+                so Alloc_free returns it to that allocator even after the
+                selection has changed or on another thread.
+
+                Alloc_arenaCreate makes a bump-pointer arena suited to many
+                small, short-lived objects: allocation is an aligned pointer
+                increment, releasing the most recent block rolls the pointer
+                back, and Alloc_arenaReset recycles every chunk at once.
+                Alloc_arenaMark and Alloc_arenaRewind release everything
+                allocated after a point in O(1), so nested users can share
+                one arena.
+
+                Alloc_scratch gives every thread an arena of its own for
+                temporary work, such as the buffers of a compilation. After
+                the first call its chunks are reused, so that work makes no
+                allocator calls at all.
+
+    @note       - An allocator must stay valid until every block it made has
+                  been released.
+                - Blocks of a stricter alignment are resized by moving them.
+                - An arena is not thread-safe; use it as the allocator of a
+                  single thread.
+
+    @see        - Alloc_setGlobal
+                - Alloc_setThread
+                - Alloc_malloc
+                - Alloc_free
+                - Alloc_arenaCreate
+ =========================================================================== **/
+
+#ifndef ALLOC_H_
+#define ALLOC_H_
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================================== *\
+ *           PUBLIC DEFINES             *
+\* ==================================== */
+
+/** ====================================
+  @def      ALLOC_ALIGNMENT
+  @package  alloc
+  @brief    Defines the alignment of
+            blocks from Alloc_malloc.
+
+  @details  Same as malloc on 64-bit
+            targets.
+ ==================================== **/
+#define ALLOC_ALIGNMENT         (size_t)(16U)
+
+/** ====================================
+  @def      ALLOC_ARENA_CHUNK
+  @package  alloc
+  @brief    Defines the default chunk
+            size of an arena.
+ ==================================== **/
+#define ALLOC_ARENA_CHUNK       (size_t)(64U * 1024U)
+
+/* ==================================== *\
+ *       PUBLIC TYPES DEFINITION        *
+\* ==================================== */
+
+/** ============================================================================
+  @struct   alloc_t
+  @package  alloc
+
+  @typedef  alloc_t
+
+  @brief    Represents an allocator.
+
+  @details  `alignment` is a power of two, at least ALLOC_ALIGNMENT.
+            reallocate is only called with ALLOC_ALIGNMENT and must keep
+            the contents up to the smaller size; it may be NULL, in which
+            case blocks are moved with allocate and release.
+ =========================================================================== **/
+typedef struct alloc
+{
+    void*   (*allocate)(void* context, size_t size, size_t alignment);                      /*< Returns a block or NULL >*/
+    void*   (*reallocate)(void* context, void* pointer, size_t old_size, size_t size);      /*< Resizes a block or returns NULL >*/
+    void    (*release)(void* context, void* pointer, size_t size);                          /*< Returns a block >*/
+    void*   context;                                                                        /*< Passed to every hook >*/
+} alloc_t;
+
+/** ============================================================================
+  @struct   alloc_arena_t
+  @package  alloc
+
+  @typedef  alloc_arena_t
+
+  @brief    Opaque handle to a bump-pointer arena.
+ =========================================================================== **/
+typedef struct alloc_arena alloc_arena_t;
+
+/** ============================================================================
+  @struct   alloc_mark_t
+  @package  alloc
+
+  @typedef  alloc_mark_t
+
+  @brief    Represents a position in an arena, from Alloc_arenaMark.
+ =========================================================================== **/
+typedef struct
+{
+    void*       chunk;      /*< Chunk being filled, NULL before the first >*/
+    uintptr_t   cursor;     /*< Next free byte of the chunk >*/
+} alloc_mark_t;
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS PROTOTYPES      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Alloc_setGlobal
+  @package  alloc
+
+  @brief    Selects the allocator of threads that have none of their own.
+
+  @param    allocator   [in]:   Allocator to use, NULL for the C library.
+
+  @return   0 on success.
+            -EINVAL if allocate or release is missing.
+ =========================================================================== **/
+int Alloc_setGlobal(const alloc_t* allocator);
+
+/** ============================================================================
+  @fn       Alloc_setThread
+  @package  alloc
+
+  @brief    Selects the allocator of the calling thread.
+
+  @param    allocator   [in]:   Allocator to use, NULL for the global one.
+
+  @return   The previous allocator of the thread, NULL if it had none, so
+            that the caller can restore it.
+ =========================================================================== **/
+const alloc_t* Alloc_setThread(const alloc_t* allocator);
+
+/** ============================================================================
+  @fn       Alloc_current
+  @package  alloc
+
+  @brief    Returns the allocator the calling thread allocates from.
+ =========================================================================== **/
+const alloc_t* Alloc_current(void);
+
+/** ============================================================================
+  @fn       Alloc_malloc
+  @package  alloc
+
+  @brief    Allocates a block of ALLOC_ALIGNMENT like malloc.
+
+  @param    size    [in]:   Number of bytes.
+
+  @return   The block, or NULL if the allocator fails.
+ =========================================================================== **/
+void* Alloc_malloc(size_t size);
+
+/** ============================================================================
+  @fn       Alloc_calloc
+  @package  alloc
+
+  @brief    Allocates a zeroed array like calloc.
+
+  @param    count   [in]:   Number of elements.
+  @param    size    [in]:   Size of an element.
+
+  @return   The block, or NULL if the size overflows or the allocator
+            fails.
+ =========================================================================== **/
+void* Alloc_calloc(size_t count, size_t size);
+
+/** ============================================================================
+  @fn       Alloc_realloc
+  @package  alloc
+
+  @brief    Resizes a block like realloc, with the allocator that made it.
+
+  @param    pointer [in]:   Block from any Alloc_ function, or NULL.
+  @param    size    [in]:   New number of bytes.
+
+  @return   The block, or NULL if the allocator fails; the old block is
+            then left untouched.
+ =========================================================================== **/
+void* Alloc_realloc(void* pointer, size_t size);
+
+/** ============================================================================
+  @fn       Alloc_aligned
+  @package  alloc
+
+  @brief    Allocates a block with a stricter alignment.
+
+  @param    alignment   [in]:   Power of two.
+  @param    size        [in]:   Number of bytes.
+
+  @return   The block, or NULL if the alignment is invalid or the allocator
+            fails.
+ =========================================================================== **/
+void* Alloc_aligned(size_t alignment, size_t size);
+
+/** ============================================================================
+  @fn       Alloc_free
+  @package  alloc
+
+  @brief    Returns a block to the allocator that made it.
+
+  @param    pointer [in]:   Block from any Alloc_ function, or NULL.
+ =========================================================================== **/
+void Alloc_free(void* pointer);
+
+/** ============================================================================
+  @fn       Alloc_arenaCreate
+  @package  alloc
+
+  @brief    Creates a bump-pointer arena.
+
+  @param    chunk   [in]:   Bytes requested from the current allocator at
+                            a time; 0 uses ALLOC_ARENA_CHUNK.
+  @param    arena   [out]:  Receives the new arena.
+
+  @return   0 on success.
+            -ENOMEM if arena is NULL or an allocation fails.
+ =========================================================================== **/
+int Alloc_arenaCreate(size_t chunk, alloc_arena_t** arena);
+
+/** ============================================================================
+  @fn       Alloc_arenaAllocator
+  @package  alloc
+
+  @brief    Returns the allocator that allocates from an arena.
+
+  @param    arena   [in]:   Arena to allocate from.
+
+  @return   The allocator, valid until the arena is destroyed.
+ =========================================================================== **/
+const alloc_t* Alloc_arenaAllocator(alloc_arena_t* arena);
+
+/** ============================================================================
+  @fn       Alloc_arenaMalloc
+  @package  alloc
+
+  @brief    Allocates straight from an arena, without a block header.
+
+  @details  The block cannot be passed to Alloc_free or Alloc_realloc; it is
+            released by Alloc_arenaRewind, Alloc_arenaReset or
+            Alloc_arenaDestroy.
+
+  @param    arena   [in]:   Arena to allocate from.
+  @param    size    [in]:   Number of bytes, aligned to ALLOC_ALIGNMENT.
+
+  @return   The block, or NULL if arena is NULL or the allocator fails.
+ =========================================================================== **/
+void* Alloc_arenaMalloc(alloc_arena_t* arena, size_t size);
+
+/** ============================================================================
+  @fn       Alloc_arenaMark
+  @package  alloc
+
+  @brief    Returns the current position of an arena.
+
+  @param    arena   [in]:   Arena to query.
+
+  @return   A mark for Alloc_arenaRewind.
+ =========================================================================== **/
+alloc_mark_t Alloc_arenaMark(const alloc_arena_t* arena);
+
+/** ============================================================================
+  @fn       Alloc_arenaRewind
+  @package  alloc
+
+  @brief    Releases every block allocated from an arena since a mark.
+
+  @details  Marks must be rewound in reverse order; a rewind discards the
+            marks taken after it.
+
+  @param    arena   [in]:   Arena to rewind. NULL is ignored.
+  @param    mark    [in]:   Mark from Alloc_arenaMark on the same arena.
+ =========================================================================== **/
+void Alloc_arenaRewind(alloc_arena_t* arena, alloc_mark_t mark);
+
+/** ============================================================================
+  @fn       Alloc_arenaReset
+  @package  alloc
+
+  @brief    Releases every block of an arena at once, keeping its chunks for
+            reuse.
+
+  @param    arena   [in]:   Arena to reset. NULL is ignored.
+ =========================================================================== **/
+void Alloc_arenaReset(alloc_arena_t* arena);
+
+/** ============================================================================
+  @fn       Alloc_arenaDestroy
+  @package  alloc
+
+  @brief    Returns the chunks of an arena and releases it.
+
+  @param    arena   [in]:   Arena to release. NULL is ignored.
+ =========================================================================== **/
+void Alloc_arenaDestroy(alloc_arena_t* arena);
+
+/** ============================================================================
+  @fn       Alloc_scratch
+  @package  alloc
+
+  @brief    Returns the scratch arena of the calling thread.
+
+  @details  The arena is created on the first call, with chunks from the
+            global allocator, and destroyed when the thread exits. Take a
+            mark before using it and rewind to the mark when done, so that
+            callers further up keep their blocks.
+
+  @return   The arena, or NULL if it cannot be created.
+ =========================================================================== **/
+alloc_arena_t* Alloc_scratch(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ALLOC_H_ */
+
+/*< end of header file >*/
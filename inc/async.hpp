@@ -0,0 +1,426 @@
+/** ===========================================================================
+    @addtogroup Async
+    @addtogroup Async_Module async
+
+    @package    async
+    @brief      This header evaluates expressions from C++20 coroutines
+                without blocking the awaiting thread.
+
+    @file       async.hpp
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    `co_await rpn::eval_async(expression, bindings)` suspends the
+                coroutine and queues the request on an rpn::Executor, which
+                owns a thread pool from pool.h. The request lives inside the
+                awaiting coroutine frame, so nothing is allocated per
+                evaluation.
+
+                Requests are served in batches: a pool task takes up to
+                ASYNC_BATCH queued requests at once, evaluates them all and
+                then resumes their coroutines. Another task is submitted
+                only while requests are still waiting and fewer tasks than
+                workers are running, so a burst of thousands of evaluations
+                costs a few pool tasks rather than one each.
+
+    @note       - Coroutines resume on a pool thread.
+                - The expression and the bindings must stay alive until the
+                  co_await completes, which a temporary in the awaiting
+                  full-expression already guarantees.
+                - An exception escaping a resumed coroutine reaches a pool
+                  thread and terminates the program, as it would in a
+                  std::thread.
+                - rpn::Executor::shared() is created on first use with one
+                  worker per hardware thread, and drained at exit.
+
+    @see        - rpn::eval_async
+                - rpn::Executor
+                - Pool_submit
+ =========================================================================== **/
+
+#ifndef ASYNC_HPP_
+#define ASYNC_HPP_
+
+#if (__cplusplus < 202002L)
+#error "async.hpp requires C++20"
+#endif
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <algorithm>
+#include <coroutine>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+
+#include <pool.h>
+#include <rpn.hpp>
+
+/* ==================================== *\
+ *           PUBLIC DEFINES             *
+\* ==================================== */
+
+/** ====================================
+  @def      ASYNC_BATCH
+  @package  async
+  @brief    Defines the most requests
+            one pool task serves.
+ ==================================== **/
+#define ASYNC_BATCH             (std::size_t)(64U)
+
+namespace rpn
+{
+
+class Executor;
+
+/* ==================================== *\
+ *       PUBLIC TYPES DEFINITION        *
+\* ==================================== */
+
+/** ============================================================================
+  @class    Evaluation
+  @package  async
+
+  @brief    Awaitable returned by rpn::eval_async.
+
+  @details  Also the queue node of its request: it lives in the coroutine
+            frame while the coroutine is suspended.
+ =========================================================================== **/
+class Evaluation
+{
+public:
+    Evaluation(Executor& executor, const Expression& expression, span<const double> bindings) noexcept
+        : executor_(executor), program_(expression.program()), bindings_(bindings),
+          status_((bindings.size() < expression.variable_count()) ? -(EINVAL) : 0)
+    {
+    }
+
+    Evaluation(const Evaluation&)            = delete;
+    Evaluation& operator=(const Evaluation&) = delete;
+
+    /*< Missing bindings fail without suspending >*/
+    bool await_ready() const noexcept { return (status_ != 0); }
+
+    void await_suspend(std::coroutine_handle<> handle);
+
+    /** ========================================================================
+      @fn       Evaluation::await_resume
+      @package  async
+
+      @brief    Returns the value of the evaluation.
+
+      @throw    rpn::error if the evaluation failed or bindings are missing.
+     ======================================================================== **/
+    double await_resume() const
+    {
+        if (status_ < 0)
+        {
+            throw error(status_, "rpn::eval_async: evaluation failed");
+        }
+
+        return result_;
+    }
+
+private:
+    friend class Executor;
+
+    /** ========================================================================
+      @fn       Evaluation::run
+      @package  async
+
+      @brief    Evaluates the request on the calling pool thread.
+     ======================================================================== **/
+    void run() noexcept
+    {
+        status_ = Program_evaluateWith(program_, bindings_.empty() ? nullptr : bindings_.data(), &result_);
+    }
+
+    Executor&               executor_;              /*< Executor serving the request >*/
+    const rpn_program_t*    program_    = nullptr;  /*< Program to evaluate >*/
+    span<const double>      bindings_;              /*< One value per variable slot >*/
+    std::coroutine_handle<> handle_;                /*< Coroutine to resume >*/
+    Evaluation*             next_       = nullptr;  /*< Next queued request >*/
+    double                  result_     = 0.0;      /*< Value once run >*/
+    int                     status_     = 0;        /*< 0 or a negative errno value >*/
+};
+
+/** ============================================================================
+  @class    Executor
+  @package  async
+
+  @brief    Thread pool and request queue behind rpn::eval_async.
+ =========================================================================== **/
+class Executor
+{
+public:
+    /** ========================================================================
+      @fn       Executor::Executor
+      @package  async
+
+      @brief    Starts a pool that serves asynchronous evaluations.
+
+      @param    workers [in]:   Threads that evaluate, below POOL_MAX_THREADS;
+                                0 uses one per hardware thread.
+
+      @throw    rpn::error if the pool cannot be started.
+     ======================================================================== **/
+    explicit Executor(std::size_t workers = 0u)
+        : workers_((workers != 0u) ? workers : std::max(1u, std::thread::hardware_concurrency()))
+    {
+        /*< The thread that creates a pool only runs tasks while it waits, which nobody does here >*/
+        int status = Pool_create(std::min<std::size_t>(workers_ + 1u, POOL_MAX_THREADS), &pool_);
+
+        if (status != 0)
+        {
+            throw error(status, "rpn::Executor: pool start failed");
+        }
+
+        workers_ = Pool_threads(pool_) - 1u;
+    }
+
+    Executor(const Executor&)            = delete;
+    Executor& operator=(const Executor&) = delete;
+
+    /*< Serves every queued request before returning >*/
+    ~Executor() { Pool_destroy(pool_); }
+
+    /** ========================================================================
+      @fn       Executor::shared
+      @package  async
+
+      @brief    Returns the executor used when none is given.
+     ======================================================================== **/
+    static Executor& shared()
+    {
+        static Executor executor;
+
+        return executor;
+    }
+
+    /** ========================================================================
+      @fn       Executor::workers
+      @package  async
+
+      @brief    Returns the number of threads that evaluate.
+     ======================================================================== **/
+    std::size_t workers() const noexcept { return workers_; }
+
+private:
+    friend class Evaluation;
+
+    /** ========================================================================
+      @fn       Executor::enqueue
+      @package  async
+
+      @brief    Queues a request and starts a pool task if none is running.
+     ======================================================================== **/
+    void enqueue(Evaluation* request)
+    {
+        bool start = false;
+
+        {
+            std::lock_guard<std::mutex> guard(lock_);
+
+            *tail_  = request;
+            tail_   = &request->next_;
+            start   = (running_ == 0u);
+            running_ += start ? 1u : 0u;
+        }
+
+        if (start)
+        {
+            submit(request);
+        }
+    }
+
+    /** ========================================================================
+      @fn       Executor::submit
+      @package  async
+
+      @brief    Submits a pool task that serves the queue.
+
+      @details  On failure the request is taken off the queue before the
+                error is thrown, so no task can resume its coroutine later.
+                Requests queued behind it saw a task starting and did not
+                submit one, so they are served on the calling thread.
+
+      @param    request [in]:   Request whose enqueue starts the task.
+
+      @throw    rpn::error if the task cannot be queued.
+     ======================================================================== **/
+    void submit(Evaluation* request)
+    {
+        int status          = Pool_submit(pool_, &Executor::serve, this);
+        Evaluation** link   = &head_;
+        bool drain          = false;
+
+        if (status == 0)
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(lock_);
+
+            while ((*link != nullptr) && (*link != request))
+            {
+                link = &(*link)->next_;
+            }
+
+            if (*link == request)
+            {
+                *link           = request->next_;
+                tail_           = (request->next_ != nullptr) ? tail_ : link;
+                request->next_  = nullptr;
+            }
+
+            drain       = (head_ != nullptr);
+            running_   -= drain ? 0u : 1u;
+        }
+
+        /*< serve releases the running_ count taken by enqueue >*/
+        if (drain)
+        {
+            serve(this);
+        }
+
+        throw error(status, "rpn::Executor: submit failed");
+    }
+
+    /** ========================================================================
+      @fn       Executor::serve
+      @package  async
+
+      @brief    Serves batches of requests until the queue is empty.
+
+      @details  A task that leaves requests behind hands them to one more
+                task while there are idle workers, so load spreads without
+                one task per request.
+     ======================================================================== **/
+    static void serve(void* argument)
+    {
+        Executor* executor  = static_cast<Executor*>(argument);
+        Evaluation* batch   = nullptr;
+        Evaluation* next    = nullptr;
+        bool spread         = false;
+        std::size_t taken   = 0u;
+
+        while (true)
+        {
+            {
+                std::lock_guard<std::mutex> guard(executor->lock_);
+
+                batch = executor->head_;
+                for (taken = 0u, next = batch; (next != nullptr) && (taken < (ASYNC_BATCH - 1u)); taken++)
+                {
+                    next = next->next_;
+                }
+
+                if (batch == nullptr)
+                {
+                    executor->running_--;
+                    return;
+                }
+
+                /*< Cut the batch off the queue >*/
+                executor->head_ = (next != nullptr) ? next->next_ : nullptr;
+                executor->tail_ = (executor->head_ != nullptr) ? executor->tail_ : &executor->head_;
+                if (next != nullptr)
+                {
+                    next->next_ = nullptr;
+                }
+
+                spread = (executor->head_ != nullptr) && (executor->running_ < executor->workers_);
+                executor->running_ += spread ? 1u : 0u;
+            }
+
+            if (spread && (Pool_submit(executor->pool_, &Executor::serve, executor) != 0))
+            {
+                std::lock_guard<std::mutex> guard(executor->lock_);
+
+                executor->running_--;
+            }
+
+            for (next = batch; next != nullptr; next = next->next_)
+            {
+                next->run();
+            }
+
+            /*< A resumed coroutine may end and free its request, so read the link first >*/
+            while (batch != nullptr)
+            {
+                next = batch->next_;
+                batch->handle_.resume();
+                batch = next;
+            }
+        }
+    }
+
+    pool_t*         pool_       = nullptr;      /*< Threads that serve requests >*/
+    std::size_t     workers_    = 0u;           /*< Worker threads of pool_ >*/
+    std::mutex      lock_;                      /*< Guards the fields below >*/
+    Evaluation*     head_       = nullptr;      /*< Oldest queued request >*/
+    Evaluation**    tail_       = &head_;       /*< Link to append to >*/
+    std::size_t     running_    = 0u;           /*< Pool tasks serving the queue >*/
+};
+
+/** ============================================================================
+  @fn       Evaluation::await_suspend
+  @package  async
+
+  @brief    Queues the request; the coroutine resumes once it has run.
+ =========================================================================== **/
+inline void Evaluation::await_suspend(std::coroutine_handle<> handle)
+{
+    handle_ = handle;
+    executor_.enqueue(this);
+}
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS DEFINITION      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       eval_async
+  @package  async
+
+  @brief    Evaluates an expression on an executor, to be co_awaited.
+
+  @param    executor    [in]:   Executor to run on.
+  @param    expression  [in]:   Compiled expression.
+  @param    bindings    [in]:   One value per variable slot.
+
+  @return   An awaitable whose co_await yields the value, or throws
+            rpn::error if the evaluation fails.
+ =========================================================================== **/
+inline Evaluation eval_async(Executor& executor, const Expression& expression, span<const double> bindings = {})
+{
+    return Evaluation(executor, expression, bindings);
+}
+
+/** ============================================================================
+  @fn       eval_async
+  @package  async
+
+  @brief    Evaluates an expression on the shared executor, to be co_awaited.
+
+  @param    expression  [in]:   Compiled expression.
+  @param    bindings    [in]:   One value per variable slot.
+
+  @return   An awaitable whose co_await yields the value, or throws
+            rpn::error if the evaluation fails.
+ =========================================================================== **/
+inline Evaluation eval_async(const Expression& expression, span<const double> bindings = {})
+{
+    return Evaluation(Executor::shared(), expression, bindings);
+}
+
+} /* namespace rpn */
+
+#endif /* ASYNC_HPP_ */
+
+/*< end of header file >*/
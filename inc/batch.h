@@ -0,0 +1,295 @@
+/** ===========================================================================
+    @addtogroup Batch
+    @addtogroup Batch_Module batch
+
+    @package    batch
+    @brief      This module evaluates files of expressions, one expression
+                per line, in process or across isolated worker processes.
+
+    @file       batch.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    The input file is mapped read-only and indexed by line. Each
+                line is evaluated through RPNCalculator_tokenize,
+                RPNCalculator_infixToPostfix and
+                RPNCalculator_evaluatePostfix, and its value and status are
+                stored at the row's own index of a column-oriented output.
+
+                In sharded mode the rows are split into one shard per worker
+                process. Children inherit the read-only input mapping and
+                write straight into an output region mapped with MAP_SHARED,
+                so nothing is copied back. A shard whose process crashes or
+                exits abnormally is re-run from the last row it completed;
+                the other shards are left untouched. A row that brings its
+                shard down twice is marked as failed and skipped.
+
+                In checkpointed mode the rows are processed in fixed-size
+                chunks and appended to the output file, either as text with
+                one result per line or as `columnar` blocks of raw doubles
+                and status bits, one block per chunk. Progress is persisted with the `checkpoint` module
+                every few chunks, so an interrupted run restarts after the
+                last checkpointed chunk instead of from the first row.
+
+    @note       - Statuses are 0 on success or a negative errno value, as
+                  everywhere else in the library.
+                - Row order in the output always matches the input.
+                - A checkpointed run must be resumed with the format it was
+                  started with.
+
+    @see        - Batch_mapInput
+                - Batch_createOutput
+                - Batch_evaluateRange
+                - Batch_evaluateSharded
+                - Batch_evaluateCheckpointed
+ =========================================================================== **/
+
+#ifndef BATCH_H_
+#define BATCH_H_
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================================== *\
+ *           PUBLIC DEFINES             *
+\* ==================================== */
+
+/** ====================================
+  @def      MAX_BATCH_WORKERS
+  @package  batch
+  @brief    Defines the maximum number
+            of worker processes of a
+            sharded evaluation.
+ ==================================== **/
+#define MAX_BATCH_WORKERS       (unsigned int)(256U)
+
+/** ====================================
+  @def      MAX_VALUE_TEXT
+  @package  batch
+  @brief    Defines the maximum length
+            of a formatted result line.
+
+  @details  Enough for Format_double
+            of any double plus the
+            newline.
+ ==================================== **/
+#define MAX_VALUE_TEXT          (unsigned int)(32U)
+
+/* ==================================== *\
+ *       PUBLIC TYPES DEFINITION        *
+\* ==================================== */
+
+/** ============================================================================
+  @enum     batch_format_t
+  @package  batch
+
+  @typedef  batch_format_t
+
+  @brief    Layout of the output file of a checkpointed evaluation.
+============================================================================ **/
+typedef enum
+{
+    BATCH_FORMAT_TEXT       = 0,    /*< Shortest round-trip text per line, "nan" on failure >*/
+    BATCH_FORMAT_COLUMNAR,          /*< Blocks written by Columnar_writeBlock >*/
+    BATCH_FORMAT_COUNT
+} batch_format_t;
+
+/** ============================================================================
+  @struct   batch_input_t
+  @package  batch
+
+  @typedef  batch_input_t
+
+  @brief    Represents a memory-mapped file of expressions.
+
+  @details  Row `i` spans `data[offsets[i]]` up to `data[offsets[i + 1]]`,
+            line terminator included.
+============================================================================ **/
+typedef struct
+{
+    const char* data;       /*< Read-only mapping of the file >*/
+    size_t      size;       /*< Size of the mapping in bytes >*/
+    size_t      rows;       /*< Number of lines >*/
+    size_t*     offsets;    /*< rows + 1 line start offsets >*/
+} batch_input_t;
+
+/** ============================================================================
+  @struct   batch_output_t
+  @package  batch
+
+  @typedef  batch_output_t
+
+  @brief    Represents the results of a batch, one column per field.
+============================================================================ **/
+typedef struct
+{
+    double*     values;     /*< Value of each row >*/
+    int*        status;     /*< 0 or negative errno of each row >*/
+    size_t      rows;       /*< Number of rows >*/
+    void*       region;     /*< Backing mapping >*/
+    size_t      region_size;/*< Size of the backing mapping >*/
+} batch_output_t;
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS PROTOTYPES      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Batch_mapInput
+  @package  batch
+
+  @brief    Maps a file of expressions and indexes its lines.
+
+  @param    path    [in]:   Path of the input file.
+  @param    input   [out]:  Receives the mapping and the line index.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -ENOENT if the file cannot be opened or mapped.
+ =========================================================================== **/
+int Batch_mapInput(const char* path, batch_input_t* input);
+
+/** ============================================================================
+  @fn       Batch_unmapInput
+  @package  batch
+
+  @brief    Releases an input mapped by Batch_mapInput.
+
+  @param    input   [in/out]:   Input to release.
+ =========================================================================== **/
+void Batch_unmapInput(batch_input_t* input);
+
+/** ============================================================================
+  @fn       Batch_createOutput
+  @package  batch
+
+  @brief    Allocates the result columns of a batch.
+
+  @details  The columns live in one anonymous MAP_SHARED mapping, so worker
+            processes forked afterwards write into the caller's memory.
+
+  @param    output  [out]:  Receives the result columns.
+  @param    rows    [in]:   Number of rows.
+
+  @return   0 on success.
+            -ENOMEM if output is NULL or the mapping fails.
+ =========================================================================== **/
+int Batch_createOutput(batch_output_t* output, size_t rows);
+
+/** ============================================================================
+  @fn       Batch_destroyOutput
+  @package  batch
+
+  @brief    Releases result columns allocated by Batch_createOutput.
+
+  @param    output  [in/out]:   Output to release.
+ =========================================================================== **/
+void Batch_destroyOutput(batch_output_t* output);
+
+/** ============================================================================
+  @fn       Batch_evaluateLine
+  @package  batch
+
+  @brief    Evaluates one expression that is not NUL-terminated.
+
+  @param    line    [in]:   Start of the expression.
+  @param    length  [in]:   Length of the expression, terminator excluded.
+  @param    value   [out]:  Receives the value of the expression.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -EINVAL if the expression is empty, too long or invalid.
+ =========================================================================== **/
+int Batch_evaluateLine(const char* line, size_t length, double* value);
+
+/** ============================================================================
+  @fn       Batch_evaluateRange
+  @package  batch
+
+  @brief    Evaluates rows [first, last) in the calling process.
+
+  @param    input   [in]:       Mapped input.
+  @param    first   [in]:       First row to evaluate.
+  @param    last    [in]:       Row after the last one to evaluate.
+  @param    output  [in/out]:   Result columns, at least input->rows long.
+
+  @return   Number of failed rows on success, saturated at INT_MAX.
+            -ENOMEM if an argument is NULL.
+            -EINVAL if the range is outside the input.
+ =========================================================================== **/
+int Batch_evaluateRange(const batch_input_t* input, size_t first, size_t last, batch_output_t* output);
+
+/** ============================================================================
+  @fn       Batch_evaluateSharded
+  @package  batch
+
+  @brief    Evaluates every row across isolated worker processes.
+
+  @details  Forks one process per shard, waits for all of them and re-runs
+            only the shards that did not exit cleanly, starting from the
+            first row they had not completed. If the workers cannot be
+            waited for, the remaining ones are killed and reaped before
+            returning.
+
+  @param    input   [in]:       Mapped input.
+  @param    output  [in/out]:   Result columns from Batch_createOutput.
+  @param    workers [in]:       Number of worker processes, 1 to
+                                MAX_BATCH_WORKERS.
+
+  @return   Number of failed rows on success, saturated at INT_MAX.
+            -ENOMEM if an argument is NULL or the shard state cannot be
+            mapped.
+            -EINVAL if workers is out of range or output is too small.
+            -EAGAIN if no worker process can be forked.
+            -ECHILD if the workers cannot be waited for.
+ =========================================================================== **/
+int Batch_evaluateSharded(const batch_input_t* input, batch_output_t* output, size_t workers);
+
+/** ============================================================================
+  @fn       Batch_evaluateCheckpointed
+  @package  batch
+
+  @brief    Evaluates a file chunk by chunk with periodic checkpoints.
+
+  @details  Starts a new run when the checkpoint file does not exist, or
+            resumes the run it describes: the output is truncated to the last
+            durable offset, completed chunks are skipped and new results are
+            appended. In text format each result is written by Format_double
+            on its own line, and failed rows as "nan". In columnar format the file
+            starts with the columnar header and each chunk is one block. The
+            output is flushed to disk before every checkpoint is written.
+
+  @param    input_path      [in]:   File of expressions, one per line.
+  @param    output_path     [in]:   Output file.
+  @param    checkpoint_path [in]:   Checkpoint file.
+  @param    chunk_rows      [in]:   Rows per chunk, at least 1.
+  @param    interval        [in]:   Chunks between checkpoints, at least 1.
+  @param    format          [in]:   Layout of the output file.
+
+  @return   Number of failed rows of the whole run on success, saturated
+            at INT_MAX.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -ENOENT if the input cannot be mapped.
+            -EINVAL if a parameter is 0 or out of range, or the checkpoint
+            belongs to a different run (input, chunk_rows or format), or
+            the output is shorter than the checkpoint records.
+            -EIO if the output or the checkpoint cannot be written.
+ =========================================================================== **/
+int Batch_evaluateCheckpointed(const char* input_path, const char* output_path, const char* checkpoint_path, size_t chunk_rows, size_t interval, batch_format_t format);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BATCH_H_ */
+
+/*< end of header file >*/
@@ -0,0 +1,225 @@
+/** ===========================================================================
+    @addtogroup Catalogue
+    @addtogroup Catalogue_Module catalogue
+
+    @package    catalogue
+    @brief      This module provides a hot-reloadable catalogue of named,
+                compiled formulas.
+
+    @file       catalogue.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    A catalogue maps formula names to compiled programs. Each
+                reload compiles a complete new version from a text file and
+                publishes it with a single atomic pointer swap; the previous
+                version is released after an epoch grace period (see the
+                `epoch` module). Reader threads keep evaluating throughout a
+                reload without locks and without pausing: they see either the
+                old or the new version, never a mix of both.
+
+                The catalogue file holds one formula per line:
+
+                    # comment
+                    area   = 3.14159 * 2 ^ 2
+                    growth = 1.05 ^ 10
+
+    @note       - A reload is all or nothing. If any line fails to compile,
+                  the current version stays in place and an error is
+                  returned.
+                - Every reader thread registers once with
+                  Catalogue_registerReader and passes the returned slot to
+                  Catalogue_evaluate or Catalogue_evaluateWith.
+
+    @see        - Catalogue_create
+                - Catalogue_reload
+                - Catalogue_reloadAsync
+                - Catalogue_waitReload
+                - Catalogue_evaluate
+                - Catalogue_evaluateWith
+ =========================================================================== **/
+
+#ifndef CATALOGUE_H_
+#define CATALOGUE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================================== *\
+ *       PUBLIC TYPES DEFINITION        *
+\* ==================================== */
+
+/** ============================================================================
+  @struct   catalogue_t
+  @package  catalogue
+
+  @typedef  catalogue_t
+
+  @brief    Opaque handle to a formula catalogue.
+ =========================================================================== **/
+typedef struct catalogue catalogue_t;
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS PROTOTYPES      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Catalogue_create
+  @package  catalogue
+
+  @brief    Creates an empty catalogue.
+
+  @param    catalogue   [out]:  Receives the new catalogue.
+
+  @return   0 on success.
+            -ENOMEM if catalogue is NULL or an allocation fails.
+ =========================================================================== **/
+int Catalogue_create(catalogue_t** catalogue);
+
+/** ============================================================================
+  @fn       Catalogue_destroy
+  @package  catalogue
+
+  @brief    Releases a catalogue and every program it holds.
+
+  @details  Waits for a pending asynchronous reload. No reader may use the
+            catalogue once this function has been called.
+
+  @param    catalogue   [in]:   Catalogue to release. NULL is ignored.
+ =========================================================================== **/
+void Catalogue_destroy(catalogue_t* catalogue);
+
+/** ============================================================================
+  @fn       Catalogue_reload
+  @package  catalogue
+
+  @brief    Compiles a catalogue file and publishes it.
+
+  @details  Compiles every formula of the file into a new version, swaps it in
+            atomically and frees the previous version after a grace period.
+            Readers are never blocked; concurrent reloads are serialized.
+
+  @param    catalogue   [in]:   Catalogue to update.
+  @param    path        [in]:   Path of the catalogue file.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -ENOENT if the file cannot be opened.
+            -EINVAL if a line is malformed, a name is duplicated or a
+            formula does not compile.
+ =========================================================================== **/
+int Catalogue_reload(catalogue_t* catalogue, const char* path);
+
+/** ============================================================================
+  @fn       Catalogue_reloadAsync
+  @package  catalogue
+
+  @brief    Starts Catalogue_reload on a background thread.
+
+  @param    catalogue   [in]:   Catalogue to update.
+  @param    path        [in]:   Path of the catalogue file.
+
+  @return   0 if the background reload was started.
+            -ENOMEM if an argument is NULL.
+            -EBUSY if a background reload is still pending.
+            -EAGAIN if the thread cannot be created.
+ =========================================================================== **/
+int Catalogue_reloadAsync(catalogue_t* catalogue, const char* path);
+
+/** ============================================================================
+  @fn       Catalogue_waitReload
+  @package  catalogue
+
+  @brief    Waits for the pending background reload.
+
+  @details  At most one thread may wait for a given reload.
+
+  @param    catalogue   [in]:   Catalogue being updated.
+
+  @return   Status of the background Catalogue_reload, or 0 if none was
+            pending.
+            -ENOMEM if catalogue is NULL.
+ =========================================================================== **/
+int Catalogue_waitReload(catalogue_t* catalogue);
+
+/** ============================================================================
+  @fn       Catalogue_registerReader
+  @package  catalogue
+
+  @brief    Registers the calling thread as a reader.
+
+  @param    catalogue   [in]:   Catalogue to read from.
+
+  @return   Reader slot on success.
+            -ENOMEM if catalogue is NULL.
+            -EBUSY if too many readers are registered.
+ =========================================================================== **/
+int Catalogue_registerReader(catalogue_t* catalogue);
+
+/** ============================================================================
+  @fn       Catalogue_unregisterReader
+  @package  catalogue
+
+  @brief    Releases a reader slot.
+
+  @param    catalogue   [in]:   Catalogue the slot belongs to.
+  @param    reader      [in]:   Slot returned by Catalogue_registerReader.
+ =========================================================================== **/
+void Catalogue_unregisterReader(catalogue_t* catalogue, int reader);
+
+/** ============================================================================
+  @fn       Catalogue_evaluate
+  @package  catalogue
+
+  @brief    Evaluates a named formula of the current version.
+
+  @details  Same as Catalogue_evaluateWith with no variables.
+
+  @param    catalogue   [in]:   Catalogue to read from.
+  @param    reader      [in]:   Slot returned by Catalogue_registerReader.
+  @param    name        [in]:   Name of the formula.
+  @param    result      [out]:  Receives the value of the formula.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -ENOENT if the name is not in the current version.
+            -EINVAL if the evaluation fails, the formula has variables or
+            reader is not a valid slot.
+ =========================================================================== **/
+int Catalogue_evaluate(catalogue_t* catalogue, int reader, const char* name, double* result);
+
+/** ============================================================================
+  @fn       Catalogue_evaluateWith
+  @package  catalogue
+
+  @brief    Evaluates a named formula of the current version with bound
+            variables.
+
+  @details  Lock-free: the lookup and the evaluation run inside an epoch
+            read-side section, so the program cannot be released meanwhile.
+
+  @param    catalogue   [in]:   Catalogue to read from.
+  @param    reader      [in]:   Slot returned by Catalogue_registerReader.
+  @param    name        [in]:   Name of the formula.
+  @param    variables   [in]:   One value per variable, in order of first use
+                                in the formula. May be NULL when the formula
+                                has no variables.
+  @param    result      [out]:  Receives the value of the formula.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -ENOENT if the name is not in the current version.
+            -EINVAL if the evaluation fails, variables are missing or
+            reader is not a valid slot.
+ =========================================================================== **/
+int Catalogue_evaluateWith(catalogue_t* catalogue, int reader, const char* name, const double* variables, double* result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CATALOGUE_H_ */
+
+/*< end of header file >*/
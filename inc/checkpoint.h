@@ -0,0 +1,168 @@
+/** ===========================================================================
+    @addtogroup Checkpoint
+    @addtogroup Checkpoint_Module checkpoint
+
+    @package    checkpoint
+    @brief      This module persists the progress of long batch runs so they
+                can resume after being interrupted.
+
+    @file       checkpoint.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    A checkpoint records the shape of the run (input size, row
+                count, rows per chunk, output format), one bit per completed chunk, the
+                number of output bytes known to be durable and row counters.
+                It is written to a temporary file, flushed and renamed over
+                the previous checkpoint, so a crash at any point leaves
+                either the old or the new checkpoint on disk.
+
+    @note       - The file uses host byte order; it is meant to be resumed
+                  on the machine that wrote it.
+                - Output bytes past `output_offset` were written after the
+                  last checkpoint and must be discarded on resume.
+
+    @see        - Checkpoint_init
+                - Checkpoint_load
+                - Checkpoint_save
+                - Checkpoint_markChunkDone
+ =========================================================================== **/
+
+#ifndef CHECKPOINT_H_
+#define CHECKPOINT_H_
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================================== *\
+ *       PUBLIC TYPES DEFINITION        *
+\* ==================================== */
+
+/** ============================================================================
+  @struct   checkpoint_t
+  @package  checkpoint
+
+  @typedef  checkpoint_t
+
+  @brief    Represents the persisted progress of a batch run.
+============================================================================ **/
+typedef struct
+{
+    uint64_t    input_size;     /*< Size of the input file in bytes >*/
+    uint64_t    total_rows;     /*< Number of rows of the input >*/
+    uint64_t    chunk_rows;     /*< Rows per chunk >*/
+    uint64_t    chunk_count;    /*< Number of chunks >*/
+    uint64_t    output_offset;  /*< Durable size of the output in bytes >*/
+    uint64_t    rows_done;      /*< Rows evaluated so far >*/
+    uint64_t    failed_rows;    /*< Rows that failed so far >*/
+    uint64_t    format;         /*< Output format of the run, set by the caller >*/
+    uint8_t*    done;           /*< One bit per completed chunk >*/
+} checkpoint_t;
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS PROTOTYPES      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Checkpoint_init
+  @package  checkpoint
+
+  @brief    Initializes an empty checkpoint for a new run.
+
+  @param    checkpoint  [out]:  Checkpoint to initialize.
+  @param    input_size  [in]:   Size of the input file in bytes.
+  @param    total_rows  [in]:   Number of rows of the input.
+  @param    chunk_rows  [in]:   Rows per chunk, at least 1.
+
+  @return   0 on success.
+            -ENOMEM if checkpoint is NULL or the allocation fails.
+            -EINVAL if chunk_rows is 0.
+ =========================================================================== **/
+int Checkpoint_init(checkpoint_t* checkpoint, uint64_t input_size, uint64_t total_rows, uint64_t chunk_rows);
+
+/** ============================================================================
+  @fn       Checkpoint_release
+  @package  checkpoint
+
+  @brief    Releases the chunk bitmap of a checkpoint.
+
+  @param    checkpoint  [in/out]:   Checkpoint to release.
+ =========================================================================== **/
+void Checkpoint_release(checkpoint_t* checkpoint);
+
+/** ============================================================================
+  @fn       Checkpoint_load
+  @package  checkpoint
+
+  @brief    Reads a checkpoint file.
+
+  @param    path        [in]:   Path of the checkpoint file.
+  @param    checkpoint  [out]:  Receives the checkpoint.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or the allocation fails.
+            -ENOENT if the file does not exist.
+            -EINVAL if the file is not a valid checkpoint.
+ =========================================================================== **/
+int Checkpoint_load(const char* path, checkpoint_t* checkpoint);
+
+/** ============================================================================
+  @fn       Checkpoint_save
+  @package  checkpoint
+
+  @brief    Atomically replaces a checkpoint file.
+
+  @details  Writes "<path>.tmp", flushes it to disk, renames it over path
+            and flushes the directory so the rename survives a crash. The
+            temporary file is removed when the rename does not happen.
+
+  @param    path        [in]:   Path of the checkpoint file.
+  @param    checkpoint  [in]:   Checkpoint to write.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -EIO if the file cannot be written.
+ =========================================================================== **/
+int Checkpoint_save(const char* path, const checkpoint_t* checkpoint);
+
+/** ============================================================================
+  @fn       Checkpoint_isChunkDone
+  @package  checkpoint
+
+  @brief    Checks whether a chunk was completed.
+
+  @param    checkpoint  [in]:   Checkpoint to query.
+  @param    chunk       [in]:   Chunk index.
+
+  @return   Non-zero if the chunk is done, 0 otherwise.
+ =========================================================================== **/
+int Checkpoint_isChunkDone(const checkpoint_t* checkpoint, uint64_t chunk);
+
+/** ============================================================================
+  @fn       Checkpoint_markChunkDone
+  @package  checkpoint
+
+  @brief    Marks a chunk as completed.
+
+  @param    checkpoint  [in/out]:   Checkpoint to update.
+  @param    chunk       [in]:       Chunk index.
+ =========================================================================== **/
+void Checkpoint_markChunkDone(checkpoint_t* checkpoint, uint64_t chunk);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHECKPOINT_H_ */
+
+/*< end of header file >*/
@@ -0,0 +1,131 @@
+/** ===========================================================================
+    @addtogroup Codegen
+    @addtogroup Codegen_Module codegen
+
+    @package    codegen
+    @brief      This module generates standalone C source from compiled
+                programs (rpn2c).
+
+    @file       codegen.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    The generator walks the bytecode of a program once, tracking
+                the stack depth, and gives every stack entry its own local
+                variable. The result is straight-line code with no stack,
+                no dispatch and constants written as literals. A build can
+                compile it with full optimization and link it into a service
+                without a JIT.
+
+                Two forms can be generated:
+
+                - `int name(const double* variables, double* result)` has
+                  the same contract as Program_evaluateWith.
+                - `size_t name_block(const double* const* columns, size_t
+                  rows, double* results, int* status)` has the contract of
+                  Program_evaluateBlock. Its row loop has no early exit:
+                  failures only set a flag, so the compiler can vectorize
+                  it.
+
+                tools/rpn2c.c wraps the generator in a command line program.
+                Its --check mode compiles the output for a set of formulas
+                and compares the results bit for bit with
+                RPNCalculator_evaluatePostfix.
+
+    @note       - Compile the output with -ffp-contract=off to get the same
+                  bits as the interpreter; otherwise a * b + c may be fused.
+                  Add -fno-builtin as well if libm calls on constants must
+                  match too: compilers fold them with correctly rounded
+                  results, which may differ from libm in the last bit.
+                - Programs that call natives are rejected, since their code
+                  is only known at run time.
+
+    @see        - Codegen_emit
+                - Codegen_emitExpression
+ =========================================================================== **/
+
+#ifndef CODEGEN_H_
+#define CODEGEN_H_
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+
+#include <program.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================================== *\
+ *       PUBLIC TYPES DEFINITION        *
+\* ==================================== */
+
+/** ============================================================================
+  @enum     codegen_form_t
+  @package  codegen
+
+  @typedef  codegen_form_t
+
+  @brief    Functions to generate; combine them with `|`.
+============================================================================ **/
+typedef enum
+{
+    CODEGEN_SCALAR  = 1,    /*< `name`, one evaluation per call >*/
+    CODEGEN_BLOCK   = 2,    /*< `name_block`, a loop over column arrays >*/
+    CODEGEN_BOTH    = 3     /*< Both functions >*/
+} codegen_form_t;
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS PROTOTYPES      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Codegen_emit
+  @package  codegen
+
+  @brief    Writes C source that evaluates a compiled program.
+
+  @param    program [in]:   Program to translate.
+  @param    name    [in]:   C identifier of the generated function.
+  @param    forms   [in]:   Combination of codegen_form_t.
+  @param    output  [in]:   Stream receiving the source.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -EINVAL if name is not an identifier, forms is empty or the
+            program calls a native.
+            -EIO if the output cannot be written.
+ =========================================================================== **/
+int Codegen_emit(const rpn_program_t* program, const char* name, unsigned int forms, FILE* output);
+
+/** ============================================================================
+  @fn       Codegen_emitExpression
+  @package  codegen
+
+  @brief    Compiles an infix expression and writes C source that evaluates
+            it.
+
+  @param    expression  [in]:   Infix expression.
+  @param    name        [in]:   C identifier of the generated function.
+  @param    forms       [in]:   Combination of codegen_form_t.
+  @param    output      [in]:   Stream receiving the source.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -EINVAL if the expression is malformed or as for Codegen_emit.
+            -EIO if the output cannot be written.
+ =========================================================================== **/
+int Codegen_emitExpression(const char* expression, const char* name, unsigned int forms, FILE* output);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CODEGEN_H_ */
+
+/*< end of header file >*/
@@ -0,0 +1,198 @@
+/** ===========================================================================
+    @addtogroup Columnar
+    @addtogroup Columnar_Module columnar
+
+    @package    columnar
+    @brief      This module writes and reads batch results as a binary
+                column of little-endian doubles with per-row status bits.
+
+    @file       columnar.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    A columnar file is an 8-byte file header followed by any
+                number of blocks, so results can be appended chunk by chunk:
+
+                    file header : "RPNCOL01"
+                    block       : uint32 magic "BLK1", uint32 row count
+                                  row count x float64 values
+                                  ceil(rows / 8) status bytes, bit set
+                                  when the row failed, zero padded to a
+                                  multiple of 8 bytes
+
+                Every field is little-endian and every value column starts
+                on an 8-byte boundary, so the reader hands out pointers into
+                the mapped file without copying. On little-endian hosts the
+                writer passes the caller's value buffer straight to writev.
+
+    @note       - A failed row keeps whatever value the evaluator produced
+                  (NaN for the batch module); consumers should check the
+                  status bit first.
+
+    @see        - Columnar_writeHeader
+                - Columnar_writeBlock
+                - Columnar_open
+                - Columnar_nextBlock
+                - Columnar_close
+ =========================================================================== **/
+
+#ifndef COLUMNAR_H_
+#define COLUMNAR_H_
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================================== *\
+ *           PUBLIC DEFINES             *
+\* ==================================== */
+
+/** ====================================
+  @def      COLUMNAR_HEADER_SIZE
+  @package  columnar
+  @brief    Size in bytes of the file
+            header.
+ ==================================== **/
+#define COLUMNAR_HEADER_SIZE        (size_t)(8U)
+
+/** ====================================
+  @def      COLUMNAR_ROW_FAILED
+  @package  columnar
+  @brief    Checks the status bit of a
+            row of a block.
+ ==================================== **/
+#define COLUMNAR_ROW_FAILED(block, row) \
+    (((block)->status_bits[(row) / 8U] >> ((row) % 8U)) & 1U)
+
+/* ==================================== *\
+ *       PUBLIC TYPES DEFINITION        *
+\* ==================================== */
+
+/** ============================================================================
+  @struct   columnar_reader_t
+  @package  columnar
+
+  @typedef  columnar_reader_t
+
+  @brief    Represents a columnar file opened for reading.
+============================================================================ **/
+typedef struct
+{
+    const uint8_t*  data;       /*< Read-only mapping of the file >*/
+    size_t          size;       /*< Size of the mapping in bytes >*/
+    size_t          cursor;     /*< Offset of the next block >*/
+    double*         swapped;    /*< Byte-swapped values on big-endian hosts >*/
+} columnar_reader_t;
+
+/** ============================================================================
+  @struct   columnar_block_t
+  @package  columnar
+
+  @typedef  columnar_block_t
+
+  @brief    Represents one block returned by Columnar_nextBlock.
+
+  @details  Pointers stay valid until the next call on the same reader.
+============================================================================ **/
+typedef struct
+{
+    size_t          rows;           /*< Number of rows of the block >*/
+    const double*   values;         /*< Value column >*/
+    const uint8_t*  status_bits;    /*< One bit per row, set on failure >*/
+} columnar_block_t;
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS PROTOTYPES      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Columnar_writeHeader
+  @package  columnar
+
+  @brief    Writes the file header.
+
+  @param    descriptor  [in]:   File descriptor positioned at offset 0.
+
+  @return   Number of bytes written on success.
+            -EIO if the write fails.
+ =========================================================================== **/
+long Columnar_writeHeader(int descriptor);
+
+/** ============================================================================
+  @fn       Columnar_writeBlock
+  @package  columnar
+
+  @brief    Appends one block of results.
+
+  @details  Packs the statuses into bits and issues a single writev of the
+            block header, the value buffer and the status bits.
+
+  @param    descriptor  [in]:   File descriptor.
+  @param    values      [in]:   Value column.
+  @param    status      [in]:   0 or negative errno per row.
+  @param    rows        [in]:   Number of rows, at most UINT32_MAX.
+
+  @return   Number of bytes written on success.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -EINVAL if rows is too large.
+            -EIO if the write fails.
+ =========================================================================== **/
+long Columnar_writeBlock(int descriptor, const double* values, const int* status, size_t rows);
+
+/** ============================================================================
+  @fn       Columnar_open
+  @package  columnar
+
+  @brief    Maps a columnar file for reading.
+
+  @param    path    [in]:   Path of the file.
+  @param    reader  [out]:  Receives the reader.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -ENOENT if the file cannot be opened or mapped.
+            -EINVAL if the file header is invalid.
+ =========================================================================== **/
+int Columnar_open(const char* path, columnar_reader_t* reader);
+
+/** ============================================================================
+  @fn       Columnar_nextBlock
+  @package  columnar
+
+  @brief    Returns the next block of a columnar file.
+
+  @param    reader  [in/out]:   Reader from Columnar_open.
+  @param    block   [out]:      Receives the block.
+
+  @return   1 if a block was returned, 0 at the end of the file.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -EINVAL if the block is truncated or corrupted.
+ =========================================================================== **/
+int Columnar_nextBlock(columnar_reader_t* reader, columnar_block_t* block);
+
+/** ============================================================================
+  @fn       Columnar_close
+  @package  columnar
+
+  @brief    Releases a reader from Columnar_open.
+
+  @param    reader  [in/out]:   Reader to release.
+ =========================================================================== **/
+void Columnar_close(columnar_reader_t* reader);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COLUMNAR_H_ */
+
+/*< end of header file >*/
@@ -0,0 +1,160 @@
+/** ===========================================================================
+    @addtogroup Cpu
+    @addtogroup Cpu_Module cpu
+
+    @package    cpu
+    @brief      This module detects the instruction sets of the host once and
+                tells the vectorized kernels which implementation to run.
+
+    @file       cpu.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    The features are read with cpuid, and the AVX tiers also
+                require the operating system to save the wider registers, as
+                reported by xgetbv. The result is reduced to a single ordered
+                tier, so a kernel table indexed by tier picks the widest
+                implementation the host supports.
+
+                Setting CPU_TIER_VARIABLE to "scalar", "sse2", "avx2" or
+                "avx512" lowers the tier for testing; it never raises it
+                above what the host supports.
+
+                Modules dispatch by selecting a function pointer for each
+                kernel with Cpu_tier at the start of each batch of work. Kernels
+                for the SIMD tiers are compiled with the CPU_TARGET_*
+                attributes and only exist when CPU_DISPATCH is non-zero.
+
+    @note       - On hosts other than x86 the tier is always CPU_TIER_SCALAR.
+                - The tier is resolved on the first call and never changes,
+                  so the environment variable must be set before then.
+
+    @see        - Cpu_tier
+                - Cpu_tierName
+ =========================================================================== **/
+
+#ifndef CPU_H_
+#define CPU_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================================== *\
+ *           PUBLIC DEFINES             *
+\* ==================================== */
+
+/** ====================================
+  @def      CPU_TIER_VARIABLE
+  @package  cpu
+  @brief    Environment variable that
+            lowers the tier.
+ ==================================== **/
+#define CPU_TIER_VARIABLE       "RPN_CPU_TIER"
+
+/** ====================================
+  @def      CPU_DISPATCH
+  @package  cpu
+  @brief    Non-zero when the compiler
+            can build kernels for x86
+            tiers above its baseline.
+ ==================================== **/
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define CPU_DISPATCH            1
+#else
+#define CPU_DISPATCH            0
+#endif
+
+/** ====================================
+  @def      CPU_KERNEL
+  @package  cpu
+  @brief    Marks a portable kernel body
+            that is inlined into, and
+            compiled once more for, each
+            CPU_TARGET_* wrapper.
+ ==================================== **/
+#define CPU_KERNEL              static inline __attribute__((always_inline))
+
+/** ====================================
+  @def      CPU_TARGET_SSE2
+  @package  cpu
+  @brief    Compiles a function for the
+            CPU_TIER_SSE2 tier.
+ ==================================== **/
+#define CPU_TARGET_SSE2         __attribute__((target("sse2")))
+
+/** ====================================
+  @def      CPU_TARGET_AVX2
+  @package  cpu
+  @brief    Compiles a function for the
+            CPU_TIER_AVX2 tier.
+ ==================================== **/
+#define CPU_TARGET_AVX2         __attribute__((target("avx2,fma")))
+
+/** ====================================
+  @def      CPU_TARGET_AVX512
+  @package  cpu
+  @brief    Compiles a function for the
+            CPU_TIER_AVX512 tier.
+ ==================================== **/
+#define CPU_TARGET_AVX512       __attribute__((target("avx512f,avx512bw,avx2,fma")))
+
+/* ==================================== *\
+ *       PUBLIC TYPES DEFINITION        *
+\* ==================================== */
+
+/** ============================================================================
+  @enum     cpuTier
+  @package  cpu
+
+  @typedef  cpu_tier_t
+
+  @brief    Defines the instruction set tiers, narrowest first.
+ =========================================================================== **/
+typedef enum cpuTier
+{
+    CPU_TIER_SCALAR,    /*< No SIMD kernels >*/
+    CPU_TIER_SSE2,      /*< 16-byte vectors >*/
+    CPU_TIER_AVX2,      /*< 32-byte vectors with FMA >*/
+    CPU_TIER_AVX512,    /*< 64-byte vectors with byte masks >*/
+    CPU_TIER_COUNT      /*< Total number of tiers >*/
+} cpu_tier_t;
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS PROTOTYPES      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Cpu_tier
+  @package  cpu
+
+  @brief    Returns the tier the kernels should use.
+
+  @details  Detects the host features and reads CPU_TIER_VARIABLE on the
+            first call; later calls return the cached tier. Safe to call
+            from any thread.
+
+  @return   The widest supported tier, lowered by CPU_TIER_VARIABLE.
+ =========================================================================== **/
+cpu_tier_t Cpu_tier(void);
+
+/** ============================================================================
+  @fn       Cpu_tierName
+  @package  cpu
+
+  @brief    Returns the name of a tier, as accepted by CPU_TIER_VARIABLE.
+
+  @param    tier    [in]:   Tier to name.
+
+  @return   The name, or NULL if the tier is out of range.
+ =========================================================================== **/
+const char* Cpu_tierName(cpu_tier_t tier);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CPU_H_ */
+
+/*< end of header file >*/
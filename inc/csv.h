@@ -0,0 +1,169 @@
+/** ===========================================================================
+    @addtogroup Csv
+    @addtogroup Csv_Module csv
+
+    @package    csv
+    @brief      This module evaluates one formula per row of a CSV file,
+                binding the formula's variables to header columns.
+
+    @file       csv.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    The formula is compiled once with Program_compile and each
+                of its variables is bound to the header column of the same
+                name. The input is read in fixed-size chunks; only complete
+                lines of a chunk are processed and the incomplete tail is
+                carried over to the next read, so memory stays bounded by
+                the chunk size whatever the size of the file.
+
+                Fields are located in place with a vector scan for the
+                delimiter and newline characters, 16, 32 or 64 bytes wide
+                depending on the CPU tier reported by Cpu_tier, and only
+                the bound columns are parsed. Parsed values are
+                gathered into one column per variable and evaluated in
+                blocks with Program_evaluateBlock.
+
+                The result is written either as an extra column appended to
+                every input line or as a single-column file of its own.
+
+    @note       - Rows whose bound fields are missing or not numeric, and
+                  rows whose evaluation fails, get "nan" as result.
+                - Empty lines are skipped.
+                - Quoted fields are supported; a quoted numeric field is
+                  parsed without its quotes.
+
+    @see        - Csv_evaluate
+                - Csv_parseDouble
+ =========================================================================== **/
+
+#ifndef CSV_H_
+#define CSV_H_
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================================== *\
+ *           PUBLIC DEFINES             *
+\* ==================================== */
+
+/** ====================================
+  @def      CSV_DEFAULT_CHUNK_SIZE
+  @package  csv
+  @brief    Defines the default number
+            of bytes read per chunk.
+ ==================================== **/
+#define CSV_DEFAULT_CHUNK_SIZE  (size_t)(1U << 20U)
+
+/** ====================================
+  @def      CSV_BLOCK_ROWS
+  @package  csv
+  @brief    Defines the number of rows
+            gathered per evaluation
+            block.
+ ==================================== **/
+#define CSV_BLOCK_ROWS          (size_t)(1024U)
+
+/* ==================================== *\
+ *       PUBLIC TYPES DEFINITION        *
+\* ==================================== */
+
+/** ============================================================================
+  @enum     csv_output_t
+  @package  csv
+
+  @typedef  csv_output_t
+
+  @brief    Defines where the result column is written.
+============================================================================ **/
+typedef enum
+{
+    CSV_OUTPUT_APPEND   = 0,    /*< Input lines plus a result column >*/
+    CSV_OUTPUT_SEPARATE,        /*< Result column only >*/
+    CSV_OUTPUT_COUNT
+} csv_output_t;
+
+/** ============================================================================
+  @struct   csv_options_t
+  @package  csv
+
+  @typedef  csv_options_t
+
+  @brief    Represents the settings of a CSV evaluation.
+============================================================================ **/
+typedef struct
+{
+    char            delimiter;      /*< Field separator >*/
+    size_t          chunk_size;     /*< Bytes read per chunk, longest line bound >*/
+    csv_output_t    output;         /*< Output layout >*/
+    const char*     result_name;    /*< Header of the result column >*/
+} csv_options_t;
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS PROTOTYPES      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Csv_evaluate
+  @package  csv
+
+  @brief    Evaluates a formula over every row of a CSV file.
+
+  @param    input_path  [in]:   CSV file whose first line is the header.
+  @param    output_path [in]:   Output CSV file.
+  @param    expression  [in]:   Infix formula; its variables name columns.
+  @param    options     [in]:   Settings, or NULL for ',' as delimiter,
+                                CSV_DEFAULT_CHUNK_SIZE, CSV_OUTPUT_APPEND and
+                                "result" as column name.
+
+  @return   Number of failed rows on success, saturated at INT_MAX.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -ENOENT if the input cannot be opened or a variable has no
+            column.
+            -EINVAL if the formula is invalid, an option is out of range or
+            a line is longer than the chunk size.
+            -EIO if reading or writing fails.
+ =========================================================================== **/
+int Csv_evaluate(const char* input_path, const char* output_path, const char* expression, const csv_options_t* options);
+
+/** ============================================================================
+  @fn       Csv_parseDouble
+  @package  csv
+
+  @brief    Parses a decimal number that is not NUL-terminated.
+
+  @details  Numbers whose significant digits form an integer of at most
+            2^53 and whose decimal exponent is within +/-22 are converted
+            exactly with one multiplication or division by a power of ten.
+            Anything else (larger mantissas, extreme exponents, "inf",
+            "nan", hexadecimal) falls back to strtod_l in the "C" locale on a private copy, so
+            the result never depends on LC_NUMERIC. Leading and trailing
+            spaces are ignored.
+
+  @param    text    [in]:   Start of the field.
+  @param    length  [in]:   Length of the field.
+  @param    value   [out]:  Receives the number.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or the "C" locale cannot be
+            created.
+            -EINVAL if the field is not a number.
+ =========================================================================== **/
+int Csv_parseDouble(const char* text, size_t length, double* value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CSV_H_ */
+
+/*< end of header file >*/
@@ -0,0 +1,148 @@
+/** ===========================================================================
+    @addtogroup Dag
+    @addtogroup Dag_Module dag
+
+    @package    dag
+    @brief      This module compiles a batch of expressions into one program
+                in which the subexpressions they share are computed once.
+
+    @file       dag.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    Every expression of the batch is compiled on its own and its
+                instructions are replayed symbolically into a hash-consed
+                graph: a node is identified by its opcode, its operand and
+                its argument nodes, so "d*(x+y)" in one expression and
+                "(x+y)*d" in another share the node of "x+y", and variables
+                with the same name share a single column. Inlined user
+                function bodies are replayed too, so their locals become
+                ordinary shared nodes.
+
+                The graph is lowered back into one rpn_program_t. A node
+                that more than one parent uses, and the root of every
+                expression, is computed once and kept in a local slot;
+                every other node is emitted inline in its only parent.
+                Dag_evaluateBlock runs that program with
+                Program_evaluateBlockLocals and reads one result column per
+                expression from the root slots.
+
+    @note       - Natives registered with plugin.h are never shared, since
+                  nothing promises that they are pure.
+                - A row that fails anywhere in the shared program is
+                  re-evaluated expression by expression, so every result
+                  and status matches evaluating that expression alone.
+
+    @see        - Dag_compile
+                - Dag_program
+                - Dag_evaluateBlock
+                - Dag_destroy
+ =========================================================================== **/
+
+#ifndef DAG_H_
+#define DAG_H_
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+
+#include <program.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================================== *\
+ *       PUBLIC TYPES DEFINITION        *
+\* ==================================== */
+
+/** ============================================================================
+  @struct   dag_t
+  @package  dag
+
+  @typedef  dag_t
+
+  @brief    Opaque handle to a batch of expressions compiled together.
+ =========================================================================== **/
+typedef struct dag dag_t;
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS PROTOTYPES      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Dag_compile
+  @package  dag
+
+  @brief    Compiles a batch of expressions into one shared program.
+
+  @param    expressions [in]:   Infix expressions.
+  @param    count       [in]:   Number of expressions, at least one.
+  @param    registry    [in]:   User functions the expressions may call. May
+                                be NULL.
+  @param    dag         [out]:  Receives the newly allocated batch.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -EINVAL if count is 0 or any expression is malformed.
+ =========================================================================== **/
+int Dag_compile(const char* const* expressions, size_t count, const registry_t* registry, dag_t** dag);
+
+/** ============================================================================
+  @fn       Dag_program
+  @package  dag
+
+  @brief    Returns the shared program of a batch.
+
+  @details  Its variable table names the columns that Dag_evaluateBlock
+            expects, so Program_findVariable gives the column of a variable.
+
+  @param    dag [in]:   Compiled batch.
+
+  @return   The shared program, or NULL if dag is NULL.
+ =========================================================================== **/
+const rpn_program_t* Dag_program(const dag_t* dag);
+
+/** ============================================================================
+  @fn       Dag_evaluateBlock
+  @package  dag
+
+  @brief    Evaluates every expression of a batch over many rows.
+
+  @param    dag         [in]:   Compiled batch.
+  @param    columns     [in]:   One column of `rows` values per variable slot
+                                of Dag_program. May be NULL when the batch
+                                has no variables.
+  @param    rows        [in]:   Number of rows.
+  @param    results     [out]:  One column of `rows` values per expression,
+                                NaN where it fails.
+  @param    status      [out]:  One column of `rows` statuses per
+                                expression, 0 or -EINVAL.
+
+  @return   Number of failed results on success, saturated at INT_MAX.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -EINVAL if variable columns are missing.
+ =========================================================================== **/
+int Dag_evaluateBlock(const dag_t* dag, const double* const* columns, size_t rows, double* const* results, int* const* status);
+
+/** ============================================================================
+  @fn       Dag_destroy
+  @package  dag
+
+  @brief    Releases a compiled batch.
+
+  @param    dag [in]:   Batch to release. NULL is ignored.
+ =========================================================================== **/
+void Dag_destroy(dag_t* dag);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DAG_H_ */
+
+/*< end of header file >*/
@@ -0,0 +1,176 @@
+/** ===========================================================================
+    @addtogroup Epoch
+    @addtogroup Epoch_Module epoch
+
+    @package    epoch
+    @brief      This module provides epoch based memory reclamation for data
+                shared with lock-free readers.
+
+    @file       epoch.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    Readers announce the global epoch in a private slot before
+                touching shared data and clear it afterwards. A writer that
+                has unpublished an object advances the epoch and waits until
+                every slot is either idle or has observed the new epoch; after
+                that no reader can still hold the old object and it can be
+                released. Readers never take a lock and never wait.
+
+    @note       - Each reader thread registers once and keeps its slot for
+                  its whole lifetime.
+                - Read-side sections must not nest and must not call
+                  Epoch_synchronize.
+
+    @see        - Epoch_create
+                - Epoch_register
+                - Epoch_enter
+                - Epoch_exit
+                - Epoch_synchronize
+ =========================================================================== **/
+
+#ifndef EPOCH_H_
+#define EPOCH_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================================== *\
+ *           PUBLIC DEFINES             *
+\* ==================================== */
+
+/** ====================================
+  @def      MAX_EPOCH_READERS
+  @package  epoch
+  @brief    Defines the maximum number
+            of registered readers.
+
+  @details  Each reader owns one cache
+            line sized slot, so this
+            also bounds the memory used
+            by a domain.
+ ==================================== **/
+#define MAX_EPOCH_READERS       (unsigned int)(128U)
+
+/* ==================================== *\
+ *       PUBLIC TYPES DEFINITION        *
+\* ==================================== */
+
+/** ============================================================================
+  @struct   epoch_domain_t
+  @package  epoch
+
+  @typedef  epoch_domain_t
+
+  @brief    Opaque reclamation domain shared by readers and writers.
+ =========================================================================== **/
+typedef struct epochDomain epoch_domain_t;
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS PROTOTYPES      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Epoch_create
+  @package  epoch
+
+  @brief    Creates a reclamation domain.
+
+  @param    domain  [out]:  Receives the new domain.
+
+  @return   0 on success.
+            -ENOMEM if domain is NULL or the allocation fails.
+ =========================================================================== **/
+int Epoch_create(epoch_domain_t** domain);
+
+/** ============================================================================
+  @fn       Epoch_destroy
+  @package  epoch
+
+  @brief    Releases a reclamation domain.
+
+  @param    domain  [in]:   Domain to release. NULL is ignored.
+ =========================================================================== **/
+void Epoch_destroy(epoch_domain_t* domain);
+
+/** ============================================================================
+  @fn       Epoch_register
+  @package  epoch
+
+  @brief    Claims a reader slot.
+
+  @param    domain  [in]:   Domain to register with.
+
+  @return   Slot index on success.
+            -ENOMEM if domain is NULL.
+            -EBUSY if all MAX_EPOCH_READERS slots are taken.
+ =========================================================================== **/
+int Epoch_register(epoch_domain_t* domain);
+
+/** ============================================================================
+  @fn       Epoch_unregister
+  @package  epoch
+
+  @brief    Releases a reader slot claimed by Epoch_register.
+
+  @param    domain  [in]:   Domain the slot belongs to.
+  @param    slot    [in]:   Slot index returned by Epoch_register.
+ =========================================================================== **/
+void Epoch_unregister(epoch_domain_t* domain, int slot);
+
+/** ============================================================================
+  @fn       Epoch_enter
+  @package  epoch
+
+  @brief    Starts a read-side section.
+
+  @details  Publishes the current epoch in the reader slot. Shared pointers
+            loaded after this call stay valid until Epoch_exit.
+
+  @param    domain  [in]:   Domain the slot belongs to.
+  @param    slot    [in]:   Slot index returned by Epoch_register.
+
+  @return   0 on success.
+            -ENOMEM if domain is NULL.
+            -EINVAL if slot is out of range.
+ =========================================================================== **/
+int Epoch_enter(epoch_domain_t* domain, int slot);
+
+/** ============================================================================
+  @fn       Epoch_exit
+  @package  epoch
+
+  @brief    Ends a read-side section.
+
+  @param    domain  [in]:   Domain the slot belongs to.
+  @param    slot    [in]:   Slot index returned by Epoch_register. Out of
+                            range slots are ignored.
+ =========================================================================== **/
+void Epoch_exit(epoch_domain_t* domain, int slot);
+
+/** ============================================================================
+  @fn       Epoch_synchronize
+  @package  epoch
+
+  @brief    Waits for a grace period.
+
+  @details  Advances the global epoch and returns once every reader that could
+            have observed data unpublished before the call has left its
+            read-side section. Only writers call this function.
+
+  @param    domain  [in]:   Domain to synchronize.
+
+  @return   0 on success.
+            -ENOMEM if domain is NULL.
+ =========================================================================== **/
+int Epoch_synchronize(epoch_domain_t* domain);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EPOCH_H_ */
+
+/*< end of header file >*/
@@ -0,0 +1,936 @@
+/** ===========================================================================
+    @addtogroup Fixed
+    @addtogroup Fixed_Module fixed
+
+    @package    fixed
+    @brief      This header parses and compiles formulas fixed at build time,
+                for C++20 callers.
+
+    @file       fixed.hpp
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    The tokenizer, the Shunting-Yard conversion and the lowering
+                of Program_compile are redone as consteval functions, so
+                `"sqrt(x)*2"_rpn` is turned into bytecode while the
+                translation unit compiles:
+
+                1. Tokens follow RPNCalculator_nextToken.
+                2. The conversion follows RPNCalculator_infixToPostfix,
+                   precedence and associativity included.
+                3. Lowering follows Program_compile: the same opcodes, one
+                   slot per distinct variable name in order of first use,
+                   and a simulated stack depth that rejects malformed
+                   formulas.
+
+                A malformed formula does not compile: the diagnostic points
+                at a call to rpn::detail::syntax_error and shows the reason.
+
+                The literal yields an empty rpn::formula type whose program
+                is a constant. Evaluation expands one statement per
+                instruction with the stack offsets resolved at compile time,
+                so there is no loop, dispatch or stack pointer left for the
+                optimizer to remove, and no parsing at startup.
+
+    @note       - Values and failures follow Program_evaluateWith; a failed
+                  evaluation (division by zero, invalid factorial) returns
+                  NaN, as Program_evaluateBlock does for failed rows.
+                - Formulas can also be evaluated in constant expressions.
+                  Those that use ^ or call a function rely on the compiler
+                  treating <cmath> as constexpr, which GCC does.
+                - Calls to registry functions and natives are not available:
+                  they only exist at run time.
+
+    @see        - rpn::formula
+                - rpn::literals::operator""_rpn
+                - Program_compile
+ =========================================================================== **/
+
+#ifndef FIXED_HPP_
+#define FIXED_HPP_
+
+#if (__cplusplus < 202002L)
+#error "fixed.hpp requires C++20"
+#endif
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <program.h>
+
+namespace rpn
+{
+
+/* ==================================== *\
+ *       PUBLIC TYPES DEFINITION        *
+\* ==================================== */
+
+/** ============================================================================
+  @struct   fixed_string
+  @package  fixed
+
+  @brief    String literal usable as a template argument.
+ =========================================================================== **/
+template <std::size_t N>
+struct fixed_string
+{
+    char data[N] = {};      /*< Characters, with the terminator >*/
+
+    consteval fixed_string(const char (&text)[N])
+    {
+        for (std::size_t iterator = 0u; iterator < N; iterator++)
+        {
+            data[iterator] = text[iterator];
+        }
+    }
+
+    constexpr std::string_view view() const { return std::string_view(data, N - 1u); }
+};
+
+/** ============================================================================
+  @struct   fixed_instruction
+  @package  fixed
+
+  @brief    Represents one instruction of a compile-time program.
+
+  @details  Same opcodes and operands as program_instr_t, plus the stack
+            depth before the instruction runs.
+ =========================================================================== **/
+struct fixed_instruction
+{
+    std::uint32_t   opcode  = 0u;   /*< One of program_opcode_t >*/
+    std::uint32_t   operand = 0u;   /*< Constant, function or variable index >*/
+    std::uint32_t   depth   = 0u;   /*< Values on the stack before it runs >*/
+};
+
+/** ============================================================================
+  @struct   fixed_program
+  @package  fixed
+
+  @brief    Represents a program compiled at compile time.
+
+  @details  Sized by the length of the formula, which bounds every count.
+            Variable names are kept as offsets into the formula text.
+ =========================================================================== **/
+template <std::size_t N>
+struct fixed_program
+{
+    std::array<fixed_instruction, N>    code            = {};   /*< Instructions >*/
+    std::array<double, N>               constants       = {};   /*< Constant pool >*/
+    std::array<std::uint32_t, N>        name_begin      = {};   /*< First character of each variable name >*/
+    std::array<std::uint32_t, N>        name_length     = {};   /*< Length of each variable name >*/
+    std::size_t                         code_count      = 0u;   /*< Number of instructions >*/
+    std::size_t                         const_count     = 0u;   /*< Number of constants >*/
+    std::size_t                         var_count       = 0u;   /*< Number of variable slots >*/
+    std::size_t                         max_depth       = 0u;   /*< Maximum stack depth >*/
+};
+
+namespace detail
+{
+
+/** ============================================================================
+  @fn       syntax_error
+  @package  fixed
+
+  @brief    Reports a malformed formula.
+
+  @details  Deliberately not constexpr: reaching it during constant
+            evaluation stops the compilation at the offending formula.
+
+  @param    reason  [in]:   What is wrong.
+ =========================================================================== **/
+inline void syntax_error(const char* reason)
+{
+    (void)reason;
+}
+
+/** ============================================================================
+  @enum     token_kind
+  @package  fixed
+
+  @brief    Defines the kinds of token of a formula.
+ =========================================================================== **/
+enum class token_kind
+{
+    number,         /*< Numeric literal >*/
+    identifier,     /*< Function or variable name >*/
+    symbol          /*< Operator, bracket or comma >*/
+};
+
+/** ============================================================================
+  @struct   token
+  @package  fixed
+
+  @brief    Represents a token as a slice of the formula.
+ =========================================================================== **/
+struct token
+{
+    token_kind      kind    = token_kind::symbol;   /*< Kind of token >*/
+    std::size_t     begin   = 0u;                   /*< First character >*/
+    std::size_t     length  = 0u;                   /*< Number of characters >*/
+};
+
+/** ============================================================================
+  @var      function_names
+  @package  fixed
+
+  @brief    Built-in function names, indexed by func_index_t.
+ =========================================================================== **/
+inline constexpr std::array<std::string_view, FUNC_COUNT> function_names =
+{
+    "sqrt", "log", "ln", "sin", "cos", "tan", "cosh", "sinh", "tanh", "asin", "acos", "atan",
+    "arcsin", "arccos", "arctan", "pow10", "atan2", "hypot", "min", "max", "fma"
+};
+
+/** ============================================================================
+  @var      function_arities
+  @package  fixed
+
+  @brief    Arguments of each built-in function, indexed by func_index_t.
+ =========================================================================== **/
+inline constexpr std::array<std::uint32_t, FUNC_COUNT> function_arities =
+{
+    1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 2u, 2u, 2u, 2u, 3u
+};
+
+constexpr bool is_space(char c) { return (c == ' ') || ((c >= '\t') && (c <= '\r')); }
+constexpr bool is_digit(char c) { return (c >= '0') && (c <= '9'); }
+constexpr bool is_alpha(char c) { return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')); }
+constexpr bool is_open(char c) { return (c == '(') || (c == '[') || (c == '{'); }
+constexpr bool is_close(char c) { return (c == ')') || (c == ']') || (c == '}'); }
+constexpr bool is_operator(char c) { return (c == '+') || (c == '-') || (c == '*') || (c == '/') || (c == '^') || (c == '!'); }
+
+/** ============================================================================
+  @fn       precedence
+  @package  fixed
+
+  @brief    Returns the precedence of an operator as checkPrecedence does;
+            a lower value binds tighter.
+ =========================================================================== **/
+constexpr int precedence(char c)
+{
+    return (c == '!') ? 2 : (c == '^') ? 3 : ((c == '*') || (c == '/')) ? 4 : 5;
+}
+
+/** ============================================================================
+  @fn       find_function
+  @package  fixed
+
+  @brief    Returns the func_index_t of a name, or -1.
+ =========================================================================== **/
+constexpr int find_function(std::string_view name)
+{
+    for (std::size_t index = 0u; index < function_names.size(); index++)
+    {
+        if (function_names[index] == name)
+        {
+            return static_cast<int>(index);
+        }
+    }
+
+    return -1;
+}
+
+/** ============================================================================
+  @struct   wide
+  @package  fixed
+
+  @brief    Unsigned integer wide enough for any numeric token and the power
+            of ten dividing it.
+ =========================================================================== **/
+struct wide
+{
+    std::array<std::uint32_t, 8> limbs = {};   /*< Little-endian 32-bit limbs >*/
+
+    constexpr void multiply_add(std::uint32_t factor, std::uint32_t addend)
+    {
+        std::uint64_t carry = addend;
+
+        for (std::uint32_t& limb : limbs)
+        {
+            carry   += static_cast<std::uint64_t>(limb) * factor;
+            limb     = static_cast<std::uint32_t>(carry);
+            carry  >>= 32u;
+        }
+    }
+
+    constexpr void shift()
+    {
+        for (std::size_t index = limbs.size() - 1u; index > 0u; index--)
+        {
+            limbs[index] = (limbs[index] << 1u) | (limbs[index - 1u] >> 31u);
+        }
+
+        limbs[0] <<= 1u;
+    }
+
+    constexpr void subtract(const wide& other)
+    {
+        std::uint64_t borrow = 0u;
+
+        for (std::size_t index = 0u; index < limbs.size(); index++)
+        {
+            const std::uint64_t difference = static_cast<std::uint64_t>(limbs[index]) - other.limbs[index] - borrow;
+
+            limbs[index]    = static_cast<std::uint32_t>(difference);
+            borrow          = (difference >> 63u);
+        }
+    }
+
+    constexpr bool less(const wide& other) const
+    {
+        for (std::size_t index = limbs.size(); index > 0u; index--)
+        {
+            if (limbs[index - 1u] != other.limbs[index - 1u])
+            {
+                return (limbs[index - 1u] < other.limbs[index - 1u]);
+            }
+        }
+
+        return false;
+    }
+
+    constexpr int bits() const
+    {
+        for (std::size_t index = limbs.size(); index > 0u; index--)
+        {
+            for (int bit = 31; bit >= 0; bit--)
+            {
+                if (((limbs[index - 1u] >> bit) & 1u) != 0u)
+                {
+                    return static_cast<int>((index - 1u) * 32u) + bit + 1;
+                }
+            }
+        }
+
+        return 0;
+    }
+};
+
+/** ============================================================================
+  @fn       parse_number
+  @package  fixed
+
+  @brief    Converts a numeric token as atof does.
+
+  @details  Reads digits up to a second decimal point. The digits form an
+            integer that is divided by the power of ten of the decimals in
+            exact arithmetic, one quotient bit at a time, and rounded to
+            nearest even once, so the value is the correctly rounded one
+            strtod gives. A token holds at most 63 characters, which keeps
+            both operands below 2^210.
+ =========================================================================== **/
+constexpr double parse_number(std::string_view text)
+{
+    wide numerator      = {};
+    wide denominator    = {};
+    std::uint64_t mantissa = 0u;
+    bool point          = false;
+    int exponent        = 0;
+    double result       = 1.0;
+
+    denominator.multiply_add(1u, 1u);
+
+    for (char c : text)
+    {
+        if (c == '.')
+        {
+            if (point)
+            {
+                break;
+            }
+
+            point = true;
+            continue;
+        }
+
+        numerator.multiply_add(10u, static_cast<std::uint32_t>(c - '0'));
+        if (point)
+        {
+            denominator.multiply_add(10u, 0u);
+        }
+    }
+
+    if (numerator.bits() == 0)
+    {
+        return 0.0;
+    }
+
+    /*< Scale so that denominator <= numerator < 2 * denominator >*/
+    for (int shift = numerator.bits() - denominator.bits(); shift > 0; shift--)
+    {
+        denominator.shift();
+        exponent++;
+    }
+
+    while (numerator.less(denominator))
+    {
+        numerator.shift();
+        exponent--;
+    }
+
+    /*< 53 quotient bits, then the guard bit and whether anything remains >*/
+    for (int bit = 0; bit < 53; bit++)
+    {
+        mantissa <<= 1u;
+        if (!numerator.less(denominator))
+        {
+            numerator.subtract(denominator);
+            mantissa |= 1u;
+        }
+
+        numerator.shift();
+    }
+
+    if (!numerator.less(denominator))
+    {
+        numerator.subtract(denominator);
+        if ((numerator.bits() != 0) || ((mantissa & 1u) != 0u))
+        {
+            mantissa++;
+        }
+    }
+
+    if (mantissa == (std::uint64_t(1) << 53u))
+    {
+        mantissa >>= 1u;
+        exponent++;
+    }
+
+    for (exponent -= 52; exponent > 0; exponent--)
+    {
+        result *= 2.0;
+    }
+
+    for (; exponent < 0; exponent++)
+    {
+        result *= 0.5;
+    }
+
+    return static_cast<double>(mantissa) * result;
+}
+
+/** ============================================================================
+  @fn       factorial
+  @package  fixed
+
+  @brief    Computes a factorial in the order of
+            RPNCalculator_factorialCalculate.
+ =========================================================================== **/
+constexpr double factorial(double value)
+{
+    double result = 1.0;
+
+    /*< Every factorial past 170 overflows to infinity >*/
+    for (double factor = 2.0; (factor <= value) && (result != std::numeric_limits<double>::infinity()); factor += 1.0)
+    {
+        result = factor * result;
+    }
+
+    return result;
+}
+
+/** ============================================================================
+  @fn       compile
+  @package  fixed
+
+  @brief    Compiles a formula into a fixed_program.
+
+  @details  Mirrors RPNCalculator_tokenize, RPNCalculator_infixToPostfix and
+            the lowering of Program_compile step by step.
+ =========================================================================== **/
+template <fixed_string S>
+consteval auto compile()
+{
+    constexpr std::size_t N = sizeof(S.data);
+    constexpr std::string_view text = S.view();
+
+    fixed_program<N> program = {};
+
+    std::array<token, N> tokens     = {};
+    std::array<std::size_t, N> stack = {};
+    std::array<std::size_t, N> postfix = {};
+    std::size_t token_count         = 0u;
+    std::size_t postfix_count       = 0u;
+    std::size_t top                 = 0u;
+    std::size_t position            = 0u;
+    std::size_t depth               = 0u;
+
+    auto slice      = [&](std::size_t index) { return text.substr(tokens[index].begin, tokens[index].length); };
+    auto first      = [&](std::size_t index) { return text[tokens[index].begin]; };
+    auto is_call    = [&](std::size_t index) { return (tokens[index].kind == token_kind::identifier); };
+
+    if (text.size() >= MAX_EXPRESSION_SIZE)
+    {
+        syntax_error("formula longer than MAX_EXPRESSION_SIZE");
+    }
+
+    /*< Tokenize >*/
+    while (true)
+    {
+        while ((position < text.size()) && is_space(text[position]))
+        {
+            position++;
+        }
+
+        if ((position >= text.size()) || (text[position] == '\0'))
+        {
+            break;
+        }
+
+        token current = { token_kind::symbol, position, 1u };
+
+        if (is_digit(text[position]) || (text[position] == '.'))
+        {
+            current.kind    = token_kind::number;
+            current.length  = 0u;
+            while ((position < text.size()) && (is_digit(text[position]) || (text[position] == '.')) && (current.length < (MAX_TOKEN_LEN - 1u)))
+            {
+                position++;
+                current.length++;
+            }
+        }
+        else if (is_alpha(text[position]) || (text[position] == '_'))
+        {
+            current.kind    = token_kind::identifier;
+            current.length  = 0u;
+            while ((position < text.size()) && (is_alpha(text[position]) || is_digit(text[position]) || (text[position] == '_'))
+                                            && (current.length < (MAX_TOKEN_LEN - 1u)))
+            {
+                position++;
+                current.length++;
+            }
+        }
+        else if (is_operator(text[position]) || is_open(text[position]) || is_close(text[position]) || (text[position] == ','))
+        {
+            position++;
+        }
+        else
+        {
+            syntax_error("unknown character");
+        }
+
+        if (token_count >= MAX_NUM_TOKENS)
+        {
+            syntax_error("more than MAX_NUM_TOKENS tokens");
+        }
+
+        tokens[token_count++] = current;
+    }
+
+    if (token_count == 0u)
+    {
+        syntax_error("empty formula");
+    }
+
+    /*< Shunting-Yard; any open bracket matches any close bracket, as in C >*/
+    for (std::size_t index = 0u; index < token_count; index++)
+    {
+        const char c = first(index);
+
+        if (tokens[index].kind == token_kind::number)
+        {
+            if (!is_digit(c) && ((tokens[index].length < 2u) || !is_digit(text[tokens[index].begin + 1u])))
+            {
+                syntax_error("malformed number");
+            }
+
+            postfix[postfix_count++] = index;
+        }
+        else if ((tokens[index].kind == token_kind::identifier) && (find_function(slice(index)) < 0))
+        {
+            if (((index + 1u) < token_count) && is_open(first(index + 1u)))
+            {
+                syntax_error("call to an unknown function");
+            }
+
+            postfix[postfix_count++] = index;
+        }
+        else if (tokens[index].kind == token_kind::identifier)
+        {
+            stack[top++] = index;
+        }
+        else if (is_open(c))
+        {
+            stack[top++] = index;
+        }
+        else if ((c == ',') || is_close(c))
+        {
+            while ((top > 0u) && (is_call(stack[top - 1u]) || !is_open(first(stack[top - 1u]))))
+            {
+                postfix[postfix_count++] = stack[--top];
+            }
+
+            if (top == 0u)
+            {
+                syntax_error("unbalanced bracket or stray comma");
+            }
+
+            if (is_close(c))
+            {
+                top--;
+                if ((top > 0u) && is_call(stack[top - 1u]))
+                {
+                    postfix[postfix_count++] = stack[--top];
+                }
+            }
+        }
+        else
+        {
+            while ((top > 0u) && (is_call(stack[top - 1u]) || (is_operator(first(stack[top - 1u]))
+                                                            && ((precedence(first(stack[top - 1u])) < precedence(c))
+                                                                || ((precedence(first(stack[top - 1u])) == precedence(c)) && (c != '^') && (c != '!'))))))
+            {
+                postfix[postfix_count++] = stack[--top];
+            }
+
+            stack[top++] = index;
+        }
+    }
+
+    while (top > 0u)
+    {
+        if (!is_call(stack[top - 1u]) && is_open(first(stack[top - 1u])))
+        {
+            syntax_error("unbalanced bracket");
+        }
+
+        postfix[postfix_count++] = stack[--top];
+    }
+
+    /*< Lower, simulating the stack depth as Program_compile does >*/
+    for (std::size_t index = 0u; index < postfix_count; index++)
+    {
+        const std::size_t current   = postfix[index];
+        const char c                = first(current);
+        fixed_instruction instruction = { 0u, 0u, static_cast<std::uint32_t>(depth) };
+
+        if (tokens[current].kind == token_kind::number)
+        {
+            program.constants[program.const_count] = parse_number(slice(current));
+            instruction.opcode  = OPCODE_CONST;
+            instruction.operand = static_cast<std::uint32_t>(program.const_count++);
+            depth++;
+        }
+        else if ((tokens[current].kind == token_kind::identifier) && (find_function(slice(current)) < 0))
+        {
+            std::size_t slot = 0u;
+            while ((slot < program.var_count) && (text.substr(program.name_begin[slot], program.name_length[slot]) != slice(current)))
+            {
+                slot++;
+            }
+
+            if (slot == program.var_count)
+            {
+                program.name_begin[slot]    = static_cast<std::uint32_t>(tokens[current].begin);
+                program.name_length[slot]   = static_cast<std::uint32_t>(tokens[current].length);
+                program.var_count++;
+            }
+
+            instruction.opcode  = OPCODE_VAR;
+            instruction.operand = static_cast<std::uint32_t>(slot);
+            depth++;
+        }
+        else if (tokens[current].kind == token_kind::identifier)
+        {
+            const int function = find_function(slice(current));
+
+            if (depth < function_arities[function])
+            {
+                syntax_error("missing function argument");
+            }
+
+            instruction.opcode  = (function >= FUNC_POW10) ? static_cast<std::uint32_t>(OPCODE_POW10 + (function - FUNC_POW10))
+                                                              : static_cast<std::uint32_t>(OPCODE_FUNC);
+            instruction.operand = static_cast<std::uint32_t>(function);
+            depth               = depth + 1u - function_arities[function];
+        }
+        else if (c == '!')
+        {
+            if (depth < 1u)
+            {
+                syntax_error("missing operand");
+            }
+
+            instruction.opcode = OPCODE_FACT;
+        }
+        else if (is_operator(c))
+        {
+            if (depth < 2u)
+            {
+                syntax_error("missing operand");
+            }
+
+            instruction.opcode  = (c == '+') ? OPCODE_ADD : (c == '-') ? OPCODE_SUB : (c == '*') ? OPCODE_MUL : (c == '/') ? OPCODE_DIV : OPCODE_POW;
+            depth--;
+        }
+        else
+        {
+            syntax_error("unexpected token");
+        }
+
+        program.code[program.code_count++]  = instruction;
+        program.max_depth                   = (depth > program.max_depth) ? depth : program.max_depth;
+    }
+
+    if (depth != 1u)
+    {
+        syntax_error("operands left without an operator");
+    }
+
+    return program;
+}
+
+/** ============================================================================
+  @fn       apply
+  @package  fixed
+
+  @brief    Applies a one-argument built-in function chosen at compile time.
+ =========================================================================== **/
+template <std::uint32_t F>
+constexpr double apply(double value)
+{
+    if constexpr (F == FUNC_SQRT)                           { return std::sqrt(value); }
+    else if constexpr (F == FUNC_LOG)                       { return std::log10(value); }
+    else if constexpr (F == FUNC_LN)                        { return std::log(value); }
+    else if constexpr (F == FUNC_SIN)                       { return std::sin(value); }
+    else if constexpr (F == FUNC_COS)                       { return std::cos(value); }
+    else if constexpr (F == FUNC_TAN)                       { return std::tan(value); }
+    else if constexpr (F == FUNC_COSH)                      { return std::cosh(value); }
+    else if constexpr (F == FUNC_SINH)                      { return std::sinh(value); }
+    else if constexpr (F == FUNC_TANH)                      { return std::tanh(value); }
+    else if constexpr ((F == FUNC_ASIN) || (F == FUNC_ARCSIN)) { return std::asin(value); }
+    else if constexpr ((F == FUNC_ACOS) || (F == FUNC_ARCCOS)) { return std::acos(value); }
+    else                                                    { return std::atan(value); }
+}
+
+} /* namespace detail */
+
+/** ============================================================================
+  @struct   formula
+  @package  fixed
+
+  @brief    Empty type standing for a formula compiled at compile time.
+
+  @details  Call it with one value per variable, in order of first use, or
+            with a span of them.
+ =========================================================================== **/
+template <fixed_string S>
+struct formula
+{
+    /*< Compiled program; a malformed formula fails here >*/
+    static constexpr auto program = detail::compile<S>();
+
+    /*< Number of variable slots >*/
+    static constexpr std::size_t variable_count = program.var_count;
+
+    /** ========================================================================
+      @fn       formula::text
+      @package  fixed
+
+      @brief    Returns the source of the formula.
+     ======================================================================== **/
+    static constexpr std::string_view text() { return S.view(); }
+
+    /** ========================================================================
+      @fn       formula::variable_name
+      @package  fixed
+
+      @brief    Returns the name bound to a variable slot.
+     ======================================================================== **/
+    static constexpr std::string_view variable_name(std::size_t slot)
+    {
+        return S.view().substr(program.name_begin[slot], program.name_length[slot]);
+    }
+
+    /** ========================================================================
+      @fn       formula::find_variable
+      @package  fixed
+
+      @brief    Returns the slot of a variable, or -1 if there is none.
+     ======================================================================== **/
+    static constexpr int find_variable(std::string_view name)
+    {
+        for (std::size_t slot = 0u; slot < variable_count; slot++)
+        {
+            if (variable_name(slot) == name)
+            {
+                return static_cast<int>(slot);
+            }
+        }
+
+        return -1;
+    }
+
+    /** ========================================================================
+      @fn       formula::operator()
+      @package  fixed
+
+      @brief    Evaluates the formula with one argument per variable slot.
+
+      @return   The value, or NaN if the evaluation fails.
+     ======================================================================== **/
+    template <typename... Args>
+        requires((sizeof...(Args) == variable_count) && (std::is_convertible_v<Args, double> && ...))
+    constexpr double operator()(Args... arguments) const
+    {
+        const std::array<double, sizeof...(Args)> values = { static_cast<double>(arguments)... };
+
+        return run(values.data(), std::make_index_sequence<program.code_count>{});
+    }
+
+    /** ========================================================================
+      @fn       formula::evaluate
+      @package  fixed
+
+      @brief    Evaluates the formula with a span of variable values.
+
+      @return   The value, or NaN if values are missing or the evaluation
+                fails.
+     ======================================================================== **/
+    constexpr double evaluate(std::span<const double> values) const
+    {
+        if (values.size() < variable_count)
+        {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+
+        return run(values.data(), std::make_index_sequence<program.code_count>{});
+    }
+
+private:
+    /** ========================================================================
+      @fn       formula::run
+      @package  fixed
+
+      @brief    Runs every instruction, unrolled.
+     ======================================================================== **/
+    template <std::size_t... I>
+    static constexpr double run(const double* variables, std::index_sequence<I...>)
+    {
+        std::array<double, program.max_depth + 1u> stack = {};
+        bool failed = false;
+
+        (step<I>(stack.data(), variables, failed), ...);
+
+        return failed ? std::numeric_limits<double>::quiet_NaN() : stack[0];
+    }
+
+    /** ========================================================================
+      @fn       formula::step
+      @package  fixed
+
+      @brief    Runs instruction I, whose stack slots are known constants.
+     ======================================================================== **/
+    template <std::size_t I>
+    static constexpr void step(double* stack, const double* variables, bool& failed)
+    {
+        constexpr fixed_instruction instruction = program.code[I];
+        constexpr std::size_t top               = instruction.depth;
+
+        if constexpr (instruction.opcode == OPCODE_CONST)
+        {
+            stack[top] = program.constants[instruction.operand];
+        }
+        else if constexpr (instruction.opcode == OPCODE_VAR)
+        {
+            stack[top] = variables[instruction.operand];
+        }
+        else if constexpr (instruction.opcode == OPCODE_ADD)
+        {
+            stack[top - 2u] = stack[top - 2u] + stack[top - 1u];
+        }
+        else if constexpr (instruction.opcode == OPCODE_SUB)
+        {
+            stack[top - 2u] = stack[top - 2u] - stack[top - 1u];
+        }
+        else if constexpr (instruction.opcode == OPCODE_MUL)
+        {
+            stack[top - 2u] = stack[top - 2u] * stack[top - 1u];
+        }
+        else if constexpr (instruction.opcode == OPCODE_DIV)
+        {
+            failed          = failed || (stack[top - 1u] == 0.0);
+            stack[top - 2u] = (stack[top - 1u] == 0.0) ? 0.0 : (stack[top - 2u] / stack[top - 1u]);
+        }
+        else if constexpr (instruction.opcode == OPCODE_POW)
+        {
+            stack[top - 2u] = std::pow(stack[top - 2u], stack[top - 1u]);
+        }
+        else if constexpr (instruction.opcode == OPCODE_FACT)
+        {
+            const double value  = stack[top - 1u];
+            const bool integral = (value >= 0.0) && ((value > 4503599627370496.0) || (value == static_cast<double>(static_cast<std::int64_t>(value))));
+
+            failed          = failed || !integral;
+            stack[top - 1u] = integral ? detail::factorial(value) : 0.0;
+        }
+        else if constexpr (instruction.opcode == OPCODE_FUNC)
+        {
+            stack[top - 1u] = detail::apply<instruction.operand>(stack[top - 1u]);
+        }
+        else if constexpr (instruction.opcode == OPCODE_POW10)
+        {
+            stack[top - 1u] = std::pow(10.0, stack[top - 1u]);
+        }
+        else if constexpr (instruction.opcode == OPCODE_ATAN2)
+        {
+            stack[top - 2u] = std::atan2(stack[top - 2u], stack[top - 1u]);
+        }
+        else if constexpr (instruction.opcode == OPCODE_HYPOT)
+        {
+            stack[top - 2u] = std::hypot(stack[top - 2u], stack[top - 1u]);
+        }
+        /*< fmin / fmax: NaN only wins if both are NaN >*/
+        else if constexpr (instruction.opcode == OPCODE_MIN)
+        {
+            stack[top - 2u] = ((stack[top - 1u] < stack[top - 2u]) || (stack[top - 2u] != stack[top - 2u])) ? stack[top - 1u] : stack[top - 2u];
+        }
+        else if constexpr (instruction.opcode == OPCODE_MAX)
+        {
+            stack[top - 2u] = ((stack[top - 1u] > stack[top - 2u]) || (stack[top - 2u] != stack[top - 2u])) ? stack[top - 1u] : stack[top - 2u];
+        }
+        else
+        {
+            stack[top - 3u] = std::fma(stack[top - 3u], stack[top - 2u], stack[top - 1u]);
+        }
+    }
+};
+
+namespace literals
+{
+
+/** ============================================================================
+  @fn       operator""_rpn
+  @package  fixed
+
+  @brief    Compiles a formula literal, e.g. "sqrt(x)*2"_rpn.
+
+  @return   An empty rpn::formula for the literal.
+ =========================================================================== **/
+template <fixed_string S>
+consteval formula<S> operator""_rpn()
+{
+    return formula<S>{};
+}
+
+} /* namespace literals */
+
+} /* namespace rpn */
+
+#endif /* FIXED_HPP_ */
+
+/*< end of header file >*/
@@ -0,0 +1,80 @@
+/** ===========================================================================
+    @addtogroup Format
+    @addtogroup Format_Module format
+
+    @package    format
+    @brief      This module converts doubles to the shortest decimal text
+                that reads back as the same value.
+
+    @file       format.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    Digits are generated with the Grisu2 algorithm: the value and
+                its rounding boundaries are scaled by a cached power of ten
+                into 64-bit fixed point, and digits are emitted until the
+                text uniquely identifies the value. Only integer arithmetic
+                is used, so the result never depends on the locale or on the
+                floating-point environment.
+
+                The digits are laid out like "%g": plain decimal notation
+                for magnitudes between 1e-6 and 1e21, scientific notation
+                with a signed, at least two-digit exponent otherwise.
+
+    @note       - The output always parses back to the exact input with
+                  strtod. It is the shortest such text for almost every
+                  value; Grisu2 may emit one extra digit in rare cases.
+                - Infinities and NaN are written as "inf", "-inf" and "nan".
+
+    @see        - Format_double
+ =========================================================================== **/
+
+#ifndef FORMAT_H_
+#define FORMAT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================================== *\
+ *           PUBLIC DEFINES             *
+\* ==================================== */
+
+/** ====================================
+  @def      FORMAT_DOUBLE_SIZE
+  @package  format
+  @brief    Defines the buffer size that
+            holds any formatted double.
+
+  @details  Sign, "0.", five zeros,
+            17 digits and terminator.
+ ==================================== **/
+#define FORMAT_DOUBLE_SIZE      (unsigned int)(26U)
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS PROTOTYPES      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Format_double
+  @package  format
+
+  @brief    Writes the shortest round-trip text of a double.
+
+  @param    value   [in]:   Value to format.
+  @param    buffer  [out]:  Receives the NUL-terminated text, at least
+                            FORMAT_DOUBLE_SIZE bytes.
+
+  @return   Number of characters written, terminator excluded.
+            -ENOMEM if buffer is NULL.
+ =========================================================================== **/
+int Format_double(double value, char* buffer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FORMAT_H_ */
+
+/*< end of header file >*/
@@ -0,0 +1,437 @@
+/** ===========================================================================
+    @addtogroup Parallel
+    @addtogroup Parallel_Module parallel
+
+    @package    parallel
+    @brief      This header evaluates an expression over iterator ranges of
+                rows, with the standard execution policies.
+
+    @file       parallel.hpp
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    rpn::evaluate(policy, expression, first, last, out) writes
+                the value of every input row to out, like std::transform.
+                A row is either one number, for expressions with a single
+                variable, or a range of numbers holding one value per
+                variable slot, such as std::array, std::vector or rpn::span.
+
+                Each policy maps to an engine of the library:
+
+                | Policy                | Engine                             |
+                |-----------------------|------------------------------------|
+                | std::execution::seq   | Program_evaluateWith, row by row   |
+                | std::execution::unseq | Program_evaluateBlock tiles        |
+                | std::execution::par   | Pool threads, row by row           |
+                | std::execution::par_unseq | Pool threads over tiles        |
+
+                Tiles transpose PROGRAM_BLOCK_ROWS rows into columns, so each
+                instruction runs over a whole column and the compiler
+                vectorizes it. The parallel policies cut the range into
+                chunks of at least PARALLEL_GRAIN rows and spread them over
+                a pool shared by every call.
+
+    @note       - Failed rows, and rows with fewer values than the
+                  expression has variables, yield NaN as in
+                  Program_evaluateBlock.
+                - The parallel policies need random-access input and output
+                  iterators; with other iterators they run on the caller,
+                  and par_unseq still uses tiles.
+                - With libstdc++, <execution> may need linking with -ltbb.
+
+    @see        - rpn::evaluate
+                - Program_evaluateBlock
+                - Pool_spawn
+ =========================================================================== **/
+
+#ifndef PARALLEL_HPP_
+#define PARALLEL_HPP_
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <execution>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <pool.h>
+#include <rpn.hpp>
+
+/* ==================================== *\
+ *           PUBLIC DEFINES             *
+\* ==================================== */
+
+/** ====================================
+  @def      PARALLEL_GRAIN
+  @package  parallel
+  @brief    Defines the fewest rows a
+            parallel chunk holds.
+ ==================================== **/
+#define PARALLEL_GRAIN          (std::size_t)(4096U)
+
+namespace rpn
+{
+
+namespace detail
+{
+
+/* ==================================== *\
+ *     PRIVATE FUNCTIONS DEFINITION     *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       gather
+  @package  parallel
+
+  @brief    Copies the values of a row.
+
+  @param    row     [in]:   A number, or a range of numbers.
+  @param    values  [out]:  Receives the first `count` values.
+  @param    count   [in]:   Number of variable slots.
+
+  @return   true if the row holds at least `count` values.
+ =========================================================================== **/
+template <typename Row>
+bool gather(const Row& row, double* values, std::size_t count)
+{
+    std::size_t filled = 0u;
+
+    if constexpr (std::is_arithmetic_v<Row>)
+    {
+        if (count > 0u)
+        {
+            values[filled++] = static_cast<double>(row);
+        }
+    }
+    else
+    {
+        for (auto iterator = std::begin(row); (iterator != std::end(row)) && (filled < count); ++iterator)
+        {
+            values[filled++] = static_cast<double>(*iterator);
+        }
+    }
+
+    return (filled == count);
+}
+
+/** ============================================================================
+  @fn       evaluate_rows
+  @package  parallel
+
+  @brief    Evaluates rows one at a time.
+ =========================================================================== **/
+template <typename InputIt, typename OutputIt>
+OutputIt evaluate_rows(const rpn_program_t* program, InputIt first, InputIt last, OutputIt out)
+{
+    std::vector<double> values(program->var_count);
+    double result = 0.0;
+
+    for (; first != last; ++first, ++out)
+    {
+        if (!gather(*first, values.data(), values.size()) || (Program_evaluateWith(program, values.data(), &result) != 0))
+        {
+            result = std::numeric_limits<double>::quiet_NaN();
+        }
+
+        *out = result;
+    }
+
+    return out;
+}
+
+/** ============================================================================
+  @fn       evaluate_tiles
+  @package  parallel
+
+  @brief    Evaluates rows a tile at a time with Program_evaluateBlock.
+
+  @throw    rpn::error if the tile stack cannot be allocated.
+ =========================================================================== **/
+template <typename InputIt, typename OutputIt>
+OutputIt evaluate_tiles(const rpn_program_t* program, InputIt first, InputIt last, OutputIt out)
+{
+    const std::size_t count = program->var_count;
+
+    std::vector<double> tile(count * PROGRAM_BLOCK_ROWS);
+    std::vector<const double*> columns(count);
+    std::vector<double> values(count);
+    std::array<double, PROGRAM_BLOCK_ROWS> results;
+    std::array<int, PROGRAM_BLOCK_ROWS> status;
+    std::array<bool, PROGRAM_BLOCK_ROWS> complete;
+    std::size_t rows    = 0u;
+    int failed          = 0;
+
+    for (std::size_t slot = 0u; slot < count; slot++)
+    {
+        columns[slot] = &tile[slot * PROGRAM_BLOCK_ROWS];
+    }
+
+    while (first != last)
+    {
+        /*< Transpose the rows of the tile into columns >*/
+        for (rows = 0u; (first != last) && (rows < PROGRAM_BLOCK_ROWS); ++first, rows++)
+        {
+            complete[rows] = gather(*first, values.data(), count);
+            for (std::size_t slot = 0u; slot < count; slot++)
+            {
+                tile[(slot * PROGRAM_BLOCK_ROWS) + rows] = complete[rows] ? values[slot] : 0.0;
+            }
+        }
+
+        failed = Program_evaluateBlock(program, (count > 0u) ? columns.data() : nullptr, rows, results.data(), status.data());
+        if (failed < 0)
+        {
+            throw error(failed, "rpn::evaluate: block evaluation failed");
+        }
+
+        for (std::size_t row = 0u; row < rows; row++, ++out)
+        {
+            *out = complete[row] ? results[row] : std::numeric_limits<double>::quiet_NaN();
+        }
+    }
+
+    return out;
+}
+
+/** ============================================================================
+  @fn       shared_pool
+  @package  parallel
+
+  @brief    Returns the pool of the parallel policies, started on first use.
+
+  @return   The pool, or NULL if it cannot be started, which leaves the work
+            to the caller.
+ =========================================================================== **/
+inline pool_t* shared_pool()
+{
+    static const struct holder
+    {
+        pool_t* pool = nullptr;
+
+        holder() { (void)Pool_create(0u, &pool); }
+        ~holder() { Pool_destroy(pool); }
+    } shared;
+
+    return shared.pool;
+}
+
+/** ============================================================================
+  @struct   chunk
+  @package  parallel
+
+  @brief    Represents the rows one pool task evaluates.
+ =========================================================================== **/
+template <bool Tiles, typename InputIt, typename OutputIt>
+struct chunk
+{
+    const rpn_program_t*    program = nullptr;  /*< Program to evaluate >*/
+    InputIt                 first;              /*< First row >*/
+    InputIt                 last;               /*< Past the last row >*/
+    OutputIt                out;                /*< Value of the first row >*/
+    std::exception_ptr      failure;            /*< Exception thrown, if any >*/
+
+    static void run(void* argument)
+    {
+        chunk* self = static_cast<chunk*>(argument);
+
+        try
+        {
+            if constexpr (Tiles)
+            {
+                (void)evaluate_tiles(self->program, self->first, self->last, self->out);
+            }
+            else
+            {
+                (void)evaluate_rows(self->program, self->first, self->last, self->out);
+            }
+        }
+        catch (...)
+        {
+            self->failure = std::current_exception();
+        }
+    }
+};
+
+/** ============================================================================
+  @fn       evaluate_parallel
+  @package  parallel
+
+  @brief    Spreads chunks of rows over the shared pool.
+
+  @details  The caller evaluates the first chunk itself and then helps with
+            the others while it waits for them.
+ =========================================================================== **/
+template <bool Tiles, typename InputIt, typename OutputIt>
+OutputIt evaluate_parallel(const rpn_program_t* program, InputIt first, InputIt last, OutputIt out)
+{
+    using piece_t = chunk<Tiles, InputIt, OutputIt>;
+
+    const std::size_t rows  = static_cast<std::size_t>(std::distance(first, last));
+    pool_t* pool            = shared_pool();
+    std::size_t pieces      = std::min<std::size_t>(Pool_threads(pool) * 4u, rows / PARALLEL_GRAIN);
+    std::size_t size        = 0u;
+
+    if ((Pool_threads(pool) < 2u) || (pieces < 2u))
+    {
+        return Tiles ? evaluate_tiles(program, first, last, out) : evaluate_rows(program, first, last, out);
+    }
+
+    std::vector<piece_t> chunks(pieces);
+    std::vector<pool_task_t*> tasks(pieces, nullptr);
+
+    size = (rows + pieces - 1u) / pieces;
+    for (std::size_t index = 0u; index < pieces; index++)
+    {
+        const std::size_t begin = std::min(rows, index * size);
+        const std::size_t end   = std::min(rows, begin + size);
+
+        chunks[index].program   = program;
+        chunks[index].first     = first + static_cast<std::ptrdiff_t>(begin);
+        chunks[index].last      = first + static_cast<std::ptrdiff_t>(end);
+        chunks[index].out       = out + static_cast<std::ptrdiff_t>(begin);
+    }
+
+    /*< A chunk that cannot be spawned runs on the caller >*/
+    for (std::size_t index = 1u; index < pieces; index++)
+    {
+        if (Pool_spawn(pool, &piece_t::run, &chunks[index], &tasks[index]) != 0)
+        {
+            piece_t::run(&chunks[index]);
+        }
+    }
+
+    piece_t::run(&chunks[0]);
+
+    for (std::size_t index = 1u; index < pieces; index++)
+    {
+        if (tasks[index] != nullptr)
+        {
+            (void)Pool_wait(pool, tasks[index]);
+        }
+    }
+
+    for (const piece_t& piece : chunks)
+    {
+        if (piece.failure)
+        {
+            std::rethrow_exception(piece.failure);
+        }
+    }
+
+    return out + static_cast<std::ptrdiff_t>(rows);
+}
+
+/** ============================================================================
+  @var      random_access
+  @package  parallel
+
+  @brief    True for random-access iterators.
+ =========================================================================== **/
+template <typename Iterator>
+inline constexpr bool random_access =
+    std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>;
+
+} /* namespace detail */
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS DEFINITION      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       evaluate
+  @package  parallel
+
+  @brief    Evaluates an expression for every row of a range.
+
+  @param    policy      [in]:   std::execution policy.
+  @param    expression  [in]:   Compiled expression.
+  @param    first       [in]:   First row.
+  @param    last        [in]:   Past the last row.
+  @param    out         [out]:  Receives the value of each row, NaN where it
+                                fails.
+
+  @return   Output iterator past the last value written.
+
+  @throw    rpn::error if the expression was moved from or memory runs out.
+ =========================================================================== **/
+template <typename ExecutionPolicy, typename InputIt, typename OutputIt,
+          std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0>
+OutputIt evaluate(ExecutionPolicy&& policy, const Expression& expression, InputIt first, InputIt last, OutputIt out)
+{
+    using policy_t = std::decay_t<ExecutionPolicy>;
+
+    constexpr bool parallel = detail::random_access<InputIt> && detail::random_access<OutputIt>;
+
+    const rpn_program_t* program = expression.program();
+
+    (void)policy;
+
+    if (program == nullptr)
+    {
+        throw error(-(ENOMEM), "rpn::evaluate: empty expression");
+    }
+
+    if constexpr (std::is_same_v<policy_t, std::execution::parallel_unsequenced_policy>)
+    {
+        if constexpr (parallel)
+        {
+            return detail::evaluate_parallel<true>(program, first, last, out);
+        }
+        else
+        {
+            return detail::evaluate_tiles(program, first, last, out);
+        }
+    }
+    else if constexpr (std::is_same_v<policy_t, std::execution::parallel_policy> && parallel)
+    {
+        return detail::evaluate_parallel<false>(program, first, last, out);
+    }
+#if defined(__cpp_lib_execution) && (__cpp_lib_execution >= 201902L)
+    else if constexpr (std::is_same_v<policy_t, std::execution::unsequenced_policy>)
+    {
+        return detail::evaluate_tiles(program, first, last, out);
+    }
+#endif
+    else
+    {
+        return detail::evaluate_rows(program, first, last, out);
+    }
+}
+
+/** ============================================================================
+  @fn       evaluate
+  @package  parallel
+
+  @brief    Evaluates an expression for every row of a range, in order on
+            the caller.
+
+  @param    expression  [in]:   Compiled expression.
+  @param    first       [in]:   First row.
+  @param    last        [in]:   Past the last row.
+  @param    out         [out]:  Receives the value of each row, NaN where it
+                                fails.
+
+  @return   Output iterator past the last value written.
+
+  @throw    rpn::error if the expression was moved from.
+ =========================================================================== **/
+template <typename InputIt, typename OutputIt>
+OutputIt evaluate(const Expression& expression, InputIt first, InputIt last, OutputIt out)
+{
+    return evaluate(std::execution::seq, expression, first, last, out);
+}
+
+} /* namespace rpn */
+
+#endif /* PARALLEL_HPP_ */
+
+/*< end of header file >*/
@@ -0,0 +1,126 @@
+/** ===========================================================================
+    @addtogroup Parse
+    @addtogroup Parse_Module parse
+
+    @package    parse
+    @brief      This module converts very large infix expressions to postfix
+                on several threads.
+
+    @file       parse.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    RPNCalculator_tokenize and RPNCalculator_infixToPostfix work
+                on at most MAX_NUM_TOKENS tokens, one token at a time.
+                Parse_infixToPostfix lifts that limit and spreads the work:
+
+                1. The text is cut into one chunk per thread, at points no
+                   token spans, and every thread counts the tokens of its
+                   chunk and their net bracket depth.
+                2. An exclusive prefix sum over the chunks gives the first
+                   token and the starting bracket depth of each chunk, so
+                   every thread stores its tokens, with the depth of each,
+                   straight into the shared token array.
+                3. The binary operators at depth 0 with the lowest
+                   precedence cut the expression into segments. Since such
+                   an operator empties the operator stack of the
+                   shunting-yard conversion, every thread takes a span of
+                   whole segments and converts it on its own, batching
+                   consecutive segments into runs of up to MAX_NUM_TOKENS
+                   tokens for RPNCalculator_infixToPostfix.
+                4. A prefix sum over the span lengths places each span in
+                   the final postfix, right-associative operators after
+                   all of them, and the threads copy them there.
+
+                A segment larger than MAX_NUM_TOKENS is split the same way
+                at its own lowest operators, or, if it is a bracketed
+                group or a function call, at the commas between its
+                arguments, until each piece fits
+                RPNCalculator_infixToPostfix.
+
+    @note       - The postfix is the same as RPNCalculator_infixToPostfix
+                  gives for expressions that it accepts.
+                - Parallelism comes from the top-level operators; an
+                  expression wrapped in a single call is converted by one
+                  thread.
+                - Groups too long to convert in one piece may nest at most
+                  MAX_STACK_SIZE brackets deep.
+
+    @see        - Parse_infixToPostfix
+ =========================================================================== **/
+
+#ifndef PARSE_H_
+#define PARSE_H_
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+
+#include <RPNCalculator.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================================== *\
+ *           PUBLIC DEFINES             *
+\* ==================================== */
+
+/** ====================================
+  @def      PARSE_MAX_THREADS
+  @package  parse
+  @brief    Defines the maximum number
+            of threads of a conversion.
+ ==================================== **/
+#define PARSE_MAX_THREADS       (size_t)(64U)
+
+/** ====================================
+  @def      PARSE_MIN_CHUNK
+  @package  parse
+  @brief    Defines the fewest bytes
+            worth a thread of their own.
+ ==================================== **/
+#define PARSE_MIN_CHUNK         (size_t)(65536U)
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS PROTOTYPES      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Parse_infixToPostfix
+  @package  parse
+
+  @brief    Converts an infix expression of any length to postfix.
+
+  @details  The length is unbounded, but nesting is not: a bracketed group
+            or function call too long for RPNCalculator_infixToPostfix is
+            opened up recursively, one level per bracket, and may sit at
+            most MAX_STACK_SIZE brackets deep.
+
+  @param    expression  [in]:   String representing the infix expression.
+  @param    threads     [in]:   Threads to use, at most PARSE_MAX_THREADS;
+                                0 uses one per online processor. Fewer are
+                                used for short expressions.
+  @param    postfix     [out]:  Receives the newly allocated postfix tokens,
+                                to be released with Alloc_free.
+  @param    count       [out]:  Receives the number of postfix tokens.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -EINVAL if the expression is malformed, nests a long group
+            deeper than MAX_STACK_SIZE, or has a part that can be neither
+            split nor handed to RPNCalculator_infixToPostfix.
+ =========================================================================== **/
+int Parse_infixToPostfix(const char* expression, size_t threads, char (**postfix)[MAX_TOKEN_LEN], size_t* count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PARSE_H_ */
+
+/*< end of header file >*/
@@ -0,0 +1,193 @@
+/** ===========================================================================
+    @addtogroup Plugin
+    @addtogroup Plugin_Module plugin
+
+    @package    plugin
+    @brief      This module registers native C functions, loaded from shared
+                objects or linked into the host, that compiled programs call
+                by name.
+
+    @file       plugin.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    A plugin is a shared object that exports PLUGIN_ENTRY_SYMBOL,
+                a function returning its table of plugin_function_t. Each
+                entry has a name, an arity, a scalar entry point and an
+                optional vector entry point for whole columns.
+
+                Natives live in one process-wide table. Program_compileWith
+                lowers a call such as "erf(x)" into OPCODE_NATIVE with the
+                table index as operand, so evaluation calls the entry point
+                through a pointer instead of comparing strings, and block
+                evaluation hands a whole tile to the vector entry point.
+
+    @note       - Natives cannot be unregistered and plugins are never
+                  unloaded, so compiled programs may keep their indices for
+                  the lifetime of the process.
+                - Registration is serialized internally and may run while
+                  other threads compile or evaluate programs.
+                - Native indices are only meaningful in the process that
+                  registered them; programs that call natives must not be
+                  saved and restored in another process.
+
+    @see        - Plugin_load
+                - Plugin_register
+                - Plugin_find
+                - Plugin_get
+ =========================================================================== **/
+
+#ifndef PLUGIN_H_
+#define PLUGIN_H_
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+#include <stdint.h>
+
+#include <RPNCalculator.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================================== *\
+ *           PUBLIC DEFINES             *
+\* ==================================== */
+
+/** ====================================
+  @def      PLUGIN_MAX_ARITY
+  @package  plugin
+  @brief    Defines the maximum number
+            of arguments of a native.
+ ==================================== **/
+#define PLUGIN_MAX_ARITY        (unsigned int)(8U)
+
+/** ====================================
+  @def      PLUGIN_MAX_FUNCTIONS
+  @package  plugin
+  @brief    Defines the maximum number
+            of natives in the process.
+ ==================================== **/
+#define PLUGIN_MAX_FUNCTIONS    (unsigned int)(256U)
+
+/** ====================================
+  @def      PLUGIN_ENTRY_SYMBOL
+  @package  plugin
+  @brief    Name of the function a
+            plugin exports, of type
+            plugin_entry_t.
+ ==================================== **/
+#define PLUGIN_ENTRY_SYMBOL     "rpn_plugin_functions"
+
+/* ==================================== *\
+ *       PUBLIC TYPES DEFINITION        *
+\* ==================================== */
+
+/** ============================================================================
+  @struct   plugin_function_t
+  @package  plugin
+
+  @typedef  plugin_function_t
+
+  @brief    Describes a native function.
+
+  @details  `scalar` receives the arguments in call order. `vector`, when not
+            NULL, receives one column per argument and writes `count`
+            results to `out`, which may be the same array as `args[0]`.
+ =========================================================================== **/
+typedef struct
+{
+    char        name[MAX_TOKEN_LEN];                                        /*< Function name >*/
+    uint32_t    arity;                                                      /*< Number of arguments >*/
+    double      (*scalar)(const double* args);                              /*< Scalar entry point >*/
+    void        (*vector)(const double* const* args, size_t count, double* out); /*< Column entry point, or NULL >*/
+} plugin_function_t;
+
+/** ============================================================================
+  @typedef  plugin_entry_t
+  @package  plugin
+
+  @brief    Type of the PLUGIN_ENTRY_SYMBOL function of a plugin.
+
+  @details  Returns the plugin's table and stores its length in `count`. The
+            table must stay valid while the plugin is loaded.
+ =========================================================================== **/
+typedef const plugin_function_t* (*plugin_entry_t)(size_t* count);
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS PROTOTYPES      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Plugin_register
+  @package  plugin
+
+  @brief    Registers a native function.
+
+  @details  The descriptor is copied. The name must be an identifier that is
+            neither a built-in function nor an already registered native.
+
+  @param    function    [in]:   Native to register.
+
+  @return   Index of the native on success.
+            -ENOMEM if function is NULL.
+            -EINVAL if the descriptor is invalid or the name is taken.
+            -ENOSPC if PLUGIN_MAX_FUNCTIONS natives are registered.
+ =========================================================================== **/
+int Plugin_register(const plugin_function_t* function);
+
+/** ============================================================================
+  @fn       Plugin_load
+  @package  plugin
+
+  @brief    Loads a shared object and registers its natives.
+
+  @param    path    [in]:   Path of the shared object.
+
+  @return   Number of natives registered on success.
+            -ENOMEM if path is NULL.
+            -ENOENT if the object cannot be loaded or lacks
+            PLUGIN_ENTRY_SYMBOL.
+            The error of Plugin_register for the first rejected entry; the
+            entries before it stay registered.
+ =========================================================================== **/
+int Plugin_load(const char* path);
+
+/** ============================================================================
+  @fn       Plugin_find
+  @package  plugin
+
+  @brief    Returns the index of a native.
+
+  @param    name    [in]:   Function name.
+
+  @return   Index on success.
+            -ENOMEM if name is NULL.
+            -ENOENT if no native has that name.
+ =========================================================================== **/
+int Plugin_find(const char* name);
+
+/** ============================================================================
+  @fn       Plugin_get
+  @package  plugin
+
+  @brief    Returns a native by index.
+
+  @param    index   [in]:   Index returned by Plugin_register or Plugin_find.
+
+  @return   The native, or NULL if the index is not registered.
+ =========================================================================== **/
+const plugin_function_t* Plugin_get(uint32_t index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLUGIN_H_ */
+
+/*< end of header file >*/
@@ -0,0 +1,189 @@
+/** ===========================================================================
+    @addtogroup Pool
+    @addtogroup Pool_Module pool
+
+    @package    pool
+    @brief      This module provides a work-stealing thread pool for
+                fork-join tasks.
+
+    @file       pool.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    Every worker owns a deque of tasks. A task spawned on a
+                worker goes to the bottom of its deque and the worker takes
+                its next task from the bottom too, so it keeps working on
+                the most recent, and usually smallest, piece of the problem.
+                An idle worker steals from the top of another deque, where
+                the oldest and usually largest pieces are.
+
+                A thread that waits for a task does not block: it runs
+                other tasks until the one it waits for is done, so a task
+                may spawn and wait for subtasks without tying up a worker.
+                Threads outside the pool share one extra deque and join in
+                the same way while they wait.
+
+    @note       - Every spawned task must be waited for exactly once, and
+                  before the pool is destroyed.
+                - A submitted task is never waited for: it is released once
+                  it has run, and Pool_destroy runs those still queued.
+                - Idle workers sleep; a waiting thread with nothing to run
+                  yields instead.
+
+    @see        - Pool_create
+                - Pool_spawn
+                - Pool_submit
+                - Pool_wait
+                - Pool_destroy
+ =========================================================================== **/
+
+#ifndef POOL_H_
+#define POOL_H_
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================================== *\
+ *           PUBLIC DEFINES             *
+\* ==================================== */
+
+/** ====================================
+  @def      POOL_MAX_THREADS
+  @package  pool
+  @brief    Defines the maximum number
+            of threads of a pool.
+ ==================================== **/
+#define POOL_MAX_THREADS        (size_t)(64U)
+
+/* ==================================== *\
+ *       PUBLIC TYPES DEFINITION        *
+\* ==================================== */
+
+/** ============================================================================
+  @struct   pool_t
+  @package  pool
+
+  @typedef  pool_t
+
+  @brief    Opaque handle to a thread pool.
+ =========================================================================== **/
+typedef struct pool pool_t;
+
+/** ============================================================================
+  @struct   pool_task_t
+  @package  pool
+
+  @typedef  pool_task_t
+
+  @brief    Opaque handle to a spawned task.
+ =========================================================================== **/
+typedef struct pool_task pool_task_t;
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS PROTOTYPES      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Pool_create
+  @package  pool
+
+  @brief    Creates a thread pool.
+
+  @param    threads [in]:   Threads that run tasks, at most POOL_MAX_THREADS;
+                            0 uses one per online processor. One of them is
+                            the thread that waits, so threads - 1 workers
+                            are started.
+  @param    pool    [out]:  Receives the new pool.
+
+  @return   0 on success.
+            -ENOMEM if pool is NULL or an allocation fails.
+            -EINVAL if threads exceeds POOL_MAX_THREADS.
+            -EAGAIN if a worker cannot be started.
+ =========================================================================== **/
+int Pool_create(size_t threads, pool_t** pool);
+
+/** ============================================================================
+  @fn       Pool_threads
+  @package  pool
+
+  @brief    Returns the number of threads that run the tasks of a pool.
+
+  @param    pool    [in]:   Pool to query.
+
+  @return   The number of threads, or 1 if pool is NULL.
+ =========================================================================== **/
+size_t Pool_threads(const pool_t* pool);
+
+/** ============================================================================
+  @fn       Pool_spawn
+  @package  pool
+
+  @brief    Queues a task to run concurrently with the caller.
+
+  @param    pool        [in]:   Pool to run the task on.
+  @param    routine     [in]:   Function to run.
+  @param    argument    [in]:   Argument passed to routine.
+  @param    task        [out]:  Receives the task, to be passed to
+                                Pool_wait.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or an allocation fails.
+ =========================================================================== **/
+int Pool_spawn(pool_t* pool, void (*routine)(void*), void* argument, pool_task_t** task);
+
+/** ============================================================================
+  @fn       Pool_submit
+  @package  pool
+
+  @brief    Queues a task that nobody waits for.
+
+  @param    pool        [in]:   Pool to run the task on.
+  @param    routine     [in]:   Function to run.
+  @param    argument    [in]:   Argument passed to routine.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or an allocation fails.
+ =========================================================================== **/
+int Pool_submit(pool_t* pool, void (*routine)(void*), void* argument);
+
+/** ============================================================================
+  @fn       Pool_wait
+  @package  pool
+
+  @brief    Waits for a task, running other tasks meanwhile, and releases it.
+
+  @param    pool    [in]:   Pool the task was spawned on.
+  @param    task    [in]:   Task to wait for.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+ =========================================================================== **/
+int Pool_wait(pool_t* pool, pool_task_t* task);
+
+/** ============================================================================
+  @fn       Pool_destroy
+  @package  pool
+
+  @brief    Runs the tasks still queued, stops the workers and releases a
+            pool.
+
+  @param    pool    [in]:   Pool to release. NULL is ignored.
+ =========================================================================== **/
+void Pool_destroy(pool_t* pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POOL_H_ */
+
+/*< end of header file >*/
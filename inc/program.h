@@ -0,0 +1,419 @@
+/** ===========================================================================
+    @addtogroup Program
+    @addtogroup Program_Module program
+
+    @package    program
+    @brief      This module compiles infix expressions into compact bytecode
+                programs and evaluates them without string dispatch.
+
+    @file       program.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    A program is produced once from an infix expression through
+                RPNCalculator_tokenize and RPNCalculator_infixToPostfix, and
+                the postfix tokens are lowered into fixed-size instructions
+                plus a constant pool. Identifiers that are not functions
+                become variables: each distinct name gets a slot in a name
+                table and OPCODE_VAR reads the value bound to that slot. The
+                whole program lives in a single contiguous, pointer-free block
+                addressed through offsets, so it can be shared between
+                threads, copied with memcpy and evaluated any number of times.
+
+                Besides the scalar Program_evaluateWith, Program_evaluateBlock
+                runs one instruction at a time over a tile of rows, with one
+                column of values per variable. The arithmetic opcodes become
+                plain loops over contiguous arrays that the compiler turns
+                into SIMD code.
+
+                Program_compileWith also accepts calls to user functions of
+                a registry_t. A call is inlined: its arguments are stored
+                into local slots with OPCODE_STORE, and the body
+                instructions are copied into the program with their
+                parameters read back through OPCODE_LOAD. No call remains at
+                run time. Calls to natives registered with plugin.h become
+                OPCODE_NATIVE and go straight to their entry points.
+
+    @note       - Programs are immutable after Program_compile returns, and
+                  Program_evaluate may be called concurrently on the same
+                  program from any number of threads.
+                - Evaluation errors follow RPNCalculator_evaluatePostfix:
+                  division by zero, invalid factorials and stack underflow
+                  are reported as -EINVAL.
+
+    @see        - Program_compile
+                - Program_compileWith
+                - Program_compileLength
+                - Program_evaluate
+                - Program_evaluateWith
+                - Program_evaluateBlock
+                - Program_evaluateBlockLocals
+                - Program_findVariable
+                - Program_destroy
+ =========================================================================== **/
+
+#ifndef PROGRAM_H_
+#define PROGRAM_H_
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+#include <stdint.h>
+
+#include <RPNCalculator.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================================== *\
+ *           PUBLIC DEFINES             *
+\* ==================================== */
+
+/** ====================================
+  @def      PROGRAM_CODE
+  @package  program
+  @brief    Returns the instruction
+            array of a program.
+
+  @details  Resolves the code offset
+            stored in the program
+            header into a pointer.
+ ==================================== **/
+#define PROGRAM_CODE(program)       ((const program_instr_t*)((const char*)(program) + (program)->code_offset))
+
+/** ====================================
+  @def      PROGRAM_CONSTANTS
+  @package  program
+  @brief    Returns the constant pool
+            of a program.
+
+  @details  Resolves the constant
+            offset stored in the
+            program header into a
+            pointer.
+ ==================================== **/
+#define PROGRAM_CONSTANTS(program)  ((const double*)((const char*)(program) + (program)->const_offset))
+
+/** ====================================
+  @def      PROGRAM_VARIABLES
+  @package  program
+  @brief    Returns the variable name
+            table of a program.
+
+  @details  Entry `i` is the
+            NUL-terminated name bound
+            to slot `i`.
+ ==================================== **/
+#define PROGRAM_VARIABLES(program)  ((const char (*)[MAX_TOKEN_LEN])((const char*)(program) + (program)->var_offset))
+
+/** ====================================
+  @def      PROGRAM_BLOCK_ROWS
+  @package  program
+  @brief    Rows evaluated together by
+            Program_evaluateBlock.
+
+  @details  Each stack entry holds one
+            tile of this many values.
+ ==================================== **/
+#define PROGRAM_BLOCK_ROWS          (unsigned int)(256U)
+
+/* ==================================== *\
+ *       PUBLIC TYPES DEFINITION        *
+\* ==================================== */
+
+/** ============================================================================
+  @enum     programOpcode
+  @package  program
+
+  @typedef  program_opcode_t
+
+  @brief    Defines the instructions of a compiled program.
+
+  @details  Arithmetic opcodes mirror `operator_index_t`; OPCODE_FUNC carries
+            a `func_index_t` as its operand, OPCODE_CONST an index into the
+            constant pool, OPCODE_VAR a variable slot, OPCODE_STORE /
+            OPCODE_LOAD a local slot of an inlined user function and
+            OPCODE_NATIVE the index of a native registered with plugin.h.
+            OPCODE_POW10 to OPCODE_FMA are the built-in functions from
+            FUNC_POW10 on, in the same order, with dedicated scalar and
+            tile implementations.
+ =========================================================================== **/
+typedef enum programOpcode
+{
+    OPCODE_CONST,   /*< Push constants[operand] >*/
+    OPCODE_ADD,     /*< Pop two values, push their sum >*/
+    OPCODE_SUB,     /*< Pop two values, push their difference >*/
+    OPCODE_MUL,     /*< Pop two values, push their product >*/
+    OPCODE_DIV,     /*< Pop two values, push their quotient >*/
+    OPCODE_POW,     /*< Pop two values, push the power >*/
+    OPCODE_FACT,    /*< Pop one value, push its factorial >*/
+    OPCODE_FUNC,    /*< Pop one value, push functions[operand](value) >*/
+    OPCODE_VAR,     /*< Push the value bound to variable slot operand >*/
+    OPCODE_STORE,   /*< Pop a value into local slot operand >*/
+    OPCODE_LOAD,    /*< Push the value of local slot operand >*/
+    OPCODE_NATIVE,  /*< Pop the arguments of native operand, push its result >*/
+    OPCODE_POW10,   /*< Pop one value, push ten to its power >*/
+    OPCODE_ATAN2,   /*< Pop two values, push atan2(a, b) >*/
+    OPCODE_HYPOT,   /*< Pop two values, push hypot(a, b) >*/
+    OPCODE_MIN,     /*< Pop two values, push the smaller >*/
+    OPCODE_MAX,     /*< Pop two values, push the larger >*/
+    OPCODE_FMA,     /*< Pop three values, push a * b + c rounded once >*/
+    OPCODE_COUNT
+} program_opcode_t;
+
+/** ============================================================================
+  @struct   program_instr_t
+  @package  program
+
+  @typedef  program_instr_t
+
+  @brief    Represents a single bytecode instruction.
+ =========================================================================== **/
+typedef struct
+{
+    uint32_t    opcode;     /*< One of program_opcode_t >*/
+    uint32_t    operand;    /*< Constant, function or variable index >*/
+} program_instr_t;
+
+/** ============================================================================
+  @struct   rpn_program_t
+  @package  program
+
+  @typedef  rpn_program_t
+
+  @brief    Represents a compiled expression.
+
+  @details  Header of a single contiguous block. The instruction array, the
+            constant pool and the variable name table follow the header and
+            are addressed through offsets relative to the start of the block,
+            never through pointers.
+ =========================================================================== **/
+typedef struct
+{
+    uint32_t    size;           /*< Total size of the block in bytes >*/
+    uint32_t    code_count;     /*< Number of instructions >*/
+    uint32_t    const_count;    /*< Number of constants >*/
+    uint32_t    max_depth;      /*< Maximum value stack depth >*/
+    uint32_t    code_offset;    /*< Offset of the instruction array >*/
+    uint32_t    const_offset;   /*< Offset of the constant pool >*/
+    uint32_t    var_count;      /*< Number of variable slots >*/
+    uint32_t    var_offset;     /*< Offset of the variable name table >*/
+    uint32_t    local_count;    /*< Number of local slots >*/
+    uint32_t    reserved;       /*< Keeps the instructions 8-byte aligned >*/
+} rpn_program_t;
+
+/** ============================================================================
+  @struct   registry_t
+  @package  program
+
+  @typedef  registry_t
+
+  @brief    Opaque handle to a table of user functions, see registry.h.
+ =========================================================================== **/
+typedef struct registry registry_t;
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS PROTOTYPES      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Program_compile
+  @package  program
+
+  @brief    Compiles an infix expression into a bytecode program.
+
+  @details  Tokenizes the expression, converts it to postfix and lowers the
+            postfix tokens into instructions. The value stack depth is
+            simulated during lowering, so malformed expressions are rejected
+            here instead of at evaluation time.
+
+  @param    expression  [in]:   String representing the infix expression.
+  @param    program     [out]:  Receives the newly allocated program.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or the allocation fails.
+            -EINVAL if the expression is malformed.
+ =========================================================================== **/
+int Program_compile(const char* expression, rpn_program_t** program);
+
+/** ============================================================================
+  @fn       Program_compileWith
+  @package  program
+
+  @brief    Compiles an infix expression that may call user functions.
+
+  @details  Works like Program_compile, and inlines every call to a function
+            of the registry. Calls to registered natives are lowered to
+            OPCODE_NATIVE. The number of arguments of each call is checked
+            against the arity of the function.
+
+  @param    expression  [in]:   String representing the infix expression.
+  @param    registry    [in]:   User functions, or NULL for none.
+  @param    program     [out]:  Receives the newly allocated program.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or the allocation fails.
+            -EINVAL if the expression is malformed, calls an unknown
+            function, passes the wrong number of arguments or uses a
+            function name as a variable.
+ =========================================================================== **/
+int Program_compileWith(const char* expression, const registry_t* registry, rpn_program_t** program);
+
+/** ============================================================================
+  @fn       Program_compileLength
+  @package  program
+
+  @brief    Compiles an infix expression of known length.
+
+  @details  Works as Program_compileWith on the first `length` characters,
+            which need no NUL terminator, so an expression inside a larger
+            buffer is compiled without being copied out first.
+
+            Temporary buffers come from the scratch arena of the calling
+            thread (Alloc_scratch); the program is the only block taken
+            from the current allocator.
+
+  @param    expression  [in]:   String representing the infix expression.
+  @param    length      [in]:   Number of characters of the expression.
+  @param    registry    [in]:   User functions, or NULL for none.
+  @param    program     [out]:  Receives the newly allocated program.
+
+  @return   0 on success.
+            -ENOMEM if expression or program is NULL or the allocation fails.
+            -EINVAL if the expression is malformed, calls an unknown function
+            or passes the wrong number of arguments.
+ =========================================================================== **/
+int Program_compileLength(const char* expression, size_t length, const registry_t* registry, rpn_program_t** program);
+
+/** ============================================================================
+  @fn       Program_evaluate
+  @package  program
+
+  @brief    Evaluates a compiled program.
+
+  @details  Runs the instructions over a local value stack. The program is not
+            modified, so concurrent evaluation of one program is safe.
+
+  @param    program     [in]:   Program to evaluate.
+  @param    result      [out]:  Receives the value of the expression.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -EINVAL if the evaluation fails (e.g., division by zero) or the
+            program has variables.
+ =========================================================================== **/
+int Program_evaluate(const rpn_program_t* program, double* result);
+
+/** ============================================================================
+  @fn       Program_evaluateWith
+  @package  program
+
+  @brief    Evaluates a compiled program with bound variables.
+
+  @param    program     [in]:   Program to evaluate.
+  @param    variables   [in]:   One value per variable slot, in the order of
+                                PROGRAM_VARIABLES. May be NULL when the
+                                program has no variables.
+  @param    result      [out]:  Receives the value of the expression.
+
+  @return   0 on success.
+            -ENOMEM if program or result is NULL.
+            -EINVAL if the evaluation fails, variables are missing or a
+            native called by the program is not registered.
+ =========================================================================== **/
+int Program_evaluateWith(const rpn_program_t* program, const double* variables, double* result);
+
+/** ============================================================================
+  @fn       Program_evaluateBlock
+  @package  program
+
+  @brief    Evaluates a compiled program over many rows.
+
+  @details  Rows are processed in tiles of PROGRAM_BLOCK_ROWS. Every
+            instruction is applied to the whole tile before the next one, and
+            rows that fail (division by zero, invalid factorial) are flagged
+            instead of stopping the tile.
+
+  @param    program     [in]:   Program to evaluate.
+  @param    columns     [in]:   One column of `rows` values per variable slot.
+                                May be NULL when the program has no variables.
+  @param    rows        [in]:   Number of rows.
+  @param    results     [out]:  Value of each row, NaN for failed rows.
+  @param    status      [out]:  0 or -EINVAL for each row.
+
+  @return   Number of failed rows on success, saturated at INT_MAX.
+            -ENOMEM if an argument is NULL or the tile stack cannot be
+            allocated.
+            -EINVAL if variable columns are missing or a native called by
+            the program is not registered.
+ =========================================================================== **/
+int Program_evaluateBlock(const rpn_program_t* program, const double* const* columns, size_t rows, double* results, int* status);
+
+/** ============================================================================
+  @fn       Program_evaluateBlockLocals
+  @package  program
+
+  @brief    Evaluates a program over many rows and reads its results from
+            local slots.
+
+  @details  Runs like Program_evaluateBlock, but a program may leave several
+            results behind: output `k` of each row is the value that local
+            slot `slots[k]` holds once the tile is done. A failed row is
+            failed for every output, since the tile keeps a single failure
+            flag per row.
+
+  @param    program     [in]:   Program to evaluate.
+  @param    columns     [in]:   One column of `rows` values per variable slot.
+                                May be NULL when the program has no variables.
+  @param    rows        [in]:   Number of rows.
+  @param    slots       [in]:   Local slot of each output.
+  @param    outputs     [in]:   Number of outputs.
+  @param    results     [out]:  One column of `rows` values per output.
+  @param    status      [out]:  0 or -EINVAL for each row.
+
+  @return   Number of failed rows on success, saturated at INT_MAX.
+            -ENOMEM if an argument is NULL or the tile stack cannot be
+            allocated.
+            -EINVAL if variable columns are missing, a slot is out of range
+            or a native called by the program is not registered.
+ =========================================================================== **/
+int Program_evaluateBlockLocals(const rpn_program_t* program, const double* const* columns, size_t rows, const uint32_t* slots,
+                                size_t outputs, double* const* results, int* status);
+
+/** ============================================================================
+  @fn       Program_findVariable
+  @package  program
+
+  @brief    Returns the slot of a variable.
+
+  @param    program     [in]:   Compiled program.
+  @param    name        [in]:   Variable name.
+
+  @return   Slot index on success.
+            -ENOMEM if an argument is NULL.
+            -ENOENT if the program has no such variable.
+ =========================================================================== **/
+int Program_findVariable(const rpn_program_t* program, const char* name);
+
+/** ============================================================================
+  @fn       Program_destroy
+  @package  program
+
+  @brief    Releases a compiled program.
+
+  @param    program     [in]:   Program to release. NULL is ignored.
+ =========================================================================== **/
+void Program_destroy(rpn_program_t* program);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PROGRAM_H_ */
+
+/*< end of header file >*/
@@ -0,0 +1,198 @@
+/** ===========================================================================
+    @addtogroup ProgramTable
+    @addtogroup ProgramTable_Module program_table
+
+    @package    program_table
+    @brief      This module provides a concurrent table of compiled programs
+                shared by every worker thread.
+
+    @file       programtable.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    The table maps expression strings to compiled programs so
+                that each expression is compiled once per process instead of
+                once per thread. Buckets are singly linked lists with
+                lock-free reads (plain acquire loads) and lock-free inserts
+                (compare-and-swap on the bucket head). When two threads
+                compile the same expression concurrently, the loser discards
+                its copy and uses the published one.
+
+                Memory is reclaimed with the `epoch` module: ProgramTable_flush
+                publishes an empty bucket array and frees the old entries only
+                after every reader has left its read-side section.
+
+    @note       - Every thread registers once with
+                  ProgramTable_registerReader and passes the returned slot
+                  to the other calls.
+                - The number of buckets is chosen at creation and never
+                  grows; size it for the expected number of distinct
+                  expressions.
+
+    @see        - ProgramTable_create
+                - ProgramTable_evaluate
+                - ProgramTable_evaluateWith
+                - ProgramTable_flush
+ =========================================================================== **/
+
+#ifndef PROGRAMTABLE_H_
+#define PROGRAMTABLE_H_
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================================== *\
+ *       PUBLIC TYPES DEFINITION        *
+\* ==================================== */
+
+/** ============================================================================
+  @struct   program_table_t
+  @package  program_table
+
+  @typedef  program_table_t
+
+  @brief    Opaque handle to a concurrent program table.
+ =========================================================================== **/
+typedef struct programTable program_table_t;
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS PROTOTYPES      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       ProgramTable_create
+  @package  program_table
+
+  @brief    Creates an empty table.
+
+  @param    table           [out]:  Receives the new table.
+  @details  The bucket array never grows: past bucket_count distinct
+            expressions the chains get longer and lookups slow down
+            linearly. Size it for the expected working set, or call
+            ProgramTable_flush to start over.
+
+  @param    bucket_count    [in]:   Number of buckets, rounded up to a power
+                                    of two.
+
+  @return   0 on success.
+            -ENOMEM if table is NULL or an allocation fails.
+ =========================================================================== **/
+int ProgramTable_create(program_table_t** table, size_t bucket_count);
+
+/** ============================================================================
+  @fn       ProgramTable_destroy
+  @package  program_table
+
+  @brief    Releases a table and every program it holds.
+
+  @details  No thread may use the table once this function has been called.
+
+  @param    table   [in]:   Table to release. NULL is ignored.
+ =========================================================================== **/
+void ProgramTable_destroy(program_table_t* table);
+
+/** ============================================================================
+  @fn       ProgramTable_registerReader
+  @package  program_table
+
+  @brief    Registers the calling thread with the table.
+
+  @param    table   [in]:   Table to use.
+
+  @return   Reader slot on success.
+            -ENOMEM if table is NULL.
+            -EBUSY if too many threads are registered.
+ =========================================================================== **/
+int ProgramTable_registerReader(program_table_t* table);
+
+/** ============================================================================
+  @fn       ProgramTable_unregisterReader
+  @package  program_table
+
+  @brief    Releases a reader slot.
+
+  @param    table   [in]:   Table the slot belongs to.
+  @param    reader  [in]:   Slot returned by ProgramTable_registerReader.
+ =========================================================================== **/
+void ProgramTable_unregisterReader(program_table_t* table, int reader);
+
+/** ============================================================================
+  @fn       ProgramTable_evaluate
+  @package  program_table
+
+  @brief    Evaluates an expression without variables through the shared
+            table.
+
+  @details  Same as ProgramTable_evaluateWith with no variables.
+
+  @param    table       [in]:   Table to use.
+  @param    reader      [in]:   Slot returned by ProgramTable_registerReader.
+  @param    expression  [in]:   Infix expression.
+  @param    result      [out]:  Receives the value of the expression.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -EINVAL if the expression does not compile or evaluate, has
+            variables or reader is not a valid slot.
+ =========================================================================== **/
+int ProgramTable_evaluate(program_table_t* table, int reader, const char* expression, double* result);
+
+/** ============================================================================
+  @fn       ProgramTable_evaluateWith
+  @package  program_table
+
+  @brief    Evaluates an expression with bound variables through the shared
+            table.
+
+  @details  On a hit the cached program is evaluated without taking any lock.
+            On a miss the expression is compiled outside any read-side
+            section and inserted with a compare-and-swap.
+
+  @param    table       [in]:   Table to use.
+  @param    reader      [in]:   Slot returned by ProgramTable_registerReader.
+  @param    expression  [in]:   Infix expression.
+  @param    variables   [in]:   One value per variable, in order of first use
+                                in the expression. May be NULL when the
+                                expression has no variables.
+  @param    result      [out]:  Receives the value of the expression.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -EINVAL if the expression does not compile or evaluate,
+            variables are missing or reader is not a valid slot.
+ =========================================================================== **/
+int ProgramTable_evaluateWith(program_table_t* table, int reader, const char* expression, const double* variables, double* result);
+
+/** ============================================================================
+  @fn       ProgramTable_flush
+  @package  program_table
+
+  @brief    Drops every cached program.
+
+  @details  Publishes an empty bucket array and releases the old entries after
+            an epoch grace period. Concurrent readers are never blocked.
+            Must not be called from inside ProgramTable_evaluate.
+
+  @param    table   [in]:   Table to flush.
+
+  @return   0 on success.
+            -ENOMEM if table is NULL or an allocation fails.
+ =========================================================================== **/
+int ProgramTable_flush(program_table_t* table);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PROGRAMTABLE_H_ */
+
+/*< end of header file >*/
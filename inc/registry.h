@@ -0,0 +1,170 @@
+/** ===========================================================================
+    @addtogroup Registry
+    @addtogroup Registry_Module registry
+
+    @package    registry
+    @brief      This module holds user-defined functions such as
+                "f(x, y) = x^2 + sin(y)" for the compiler to inline.
+
+    @file       registry.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    A definition is split at '=' into a head, the function name
+                and its parameter list, and a body. The body is compiled once
+                with Program_compileWith, so calls to functions defined
+                before it are already inlined into it, and its parameters
+                become ordinary variables of the body program.
+
+                Functions are interned in an open-addressing hash table keyed
+                by the FNV-1a hash of their name. Program_compileWith looks
+                each call up there and copies the body instructions into the
+                calling program, so a user function costs no call at run
+                time.
+
+    @note       - A function name cannot be a built-in function, and an
+                  expression cannot use it as a variable.
+                - Redefining a function replaces it for programs compiled
+                  afterwards; compiled programs keep the body they inlined.
+                - A body that calls its own name refers to the previous
+                  definition, so recursion cannot be expressed.
+                - The registry is not thread-safe while definitions are
+                  added; compiling against it concurrently is safe.
+
+    @see        - Registry_create
+                - Registry_define
+                - Registry_find
+                - Program_compileWith
+ =========================================================================== **/
+
+#ifndef REGISTRY_H_
+#define REGISTRY_H_
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+#include <stdint.h>
+
+#include <RPNCalculator.h>
+#include <program.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================================== *\
+ *           PUBLIC DEFINES             *
+\* ==================================== */
+
+/** ====================================
+  @def      REGISTRY_MAX_PARAMS
+  @package  registry
+  @brief    Defines the maximum number
+            of parameters of a user
+            function.
+ ==================================== **/
+#define REGISTRY_MAX_PARAMS     (unsigned int)(8U)
+
+/* ==================================== *\
+ *       PUBLIC TYPES DEFINITION        *
+\* ==================================== */
+
+/** ============================================================================
+  @struct   registry_t
+  @package  registry
+
+  @typedef  registry_t
+
+  @brief    Opaque handle to a table of user-defined functions.
+ =========================================================================== **/
+typedef struct registry registry_t;
+
+/** ============================================================================
+  @struct   registry_function_t
+  @package  registry
+
+  @typedef  registry_function_t
+
+  @brief    Represents a user-defined function.
+ =========================================================================== **/
+typedef struct
+{
+    char            name[MAX_TOKEN_LEN];                        /*< Function name >*/
+    uint32_t        arity;                                      /*< Number of parameters >*/
+    char            params[REGISTRY_MAX_PARAMS][MAX_TOKEN_LEN]; /*< Parameter names >*/
+    rpn_program_t*  body;                                       /*< Compiled body >*/
+} registry_function_t;
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS PROTOTYPES      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Registry_create
+  @package  registry
+
+  @brief    Creates an empty registry.
+
+  @param    registry    [out]:  Receives the new registry.
+
+  @return   0 on success.
+            -ENOMEM if registry is NULL or an allocation fails.
+ =========================================================================== **/
+int Registry_create(registry_t** registry);
+
+/** ============================================================================
+  @fn       Registry_destroy
+  @package  registry
+
+  @brief    Releases a registry and the bodies of its functions.
+
+  @param    registry    [in]:   Registry to release. NULL is ignored.
+ =========================================================================== **/
+void Registry_destroy(registry_t* registry);
+
+/** ============================================================================
+  @fn       Registry_define
+  @package  registry
+
+  @brief    Compiles and registers a function definition.
+
+  @details  The definition has the form "name(p1, ..., pn) = body", with at
+            most REGISTRY_MAX_PARAMS distinct parameters. The body may use
+            the parameters, free variables, and functions already in the
+            registry.
+
+  @param    registry    [in/out]:   Registry to update.
+  @param    definition  [in]:       Function definition.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -EINVAL if the definition is malformed or its body does not
+            compile.
+ =========================================================================== **/
+int Registry_define(registry_t* registry, const char* definition);
+
+/** ============================================================================
+  @fn       Registry_find
+  @package  registry
+
+  @brief    Looks a user function up by name.
+
+  @param    registry    [in]:   Registry to search.
+  @param    name        [in]:   Function name.
+
+  @return   The function, or NULL if the registry or name is NULL or the
+            function does not exist.
+ =========================================================================== **/
+const registry_function_t* Registry_find(const registry_t* registry, const char* name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* REGISTRY_H_ */
+
+/*< end of header file >*/
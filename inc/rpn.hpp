@@ -0,0 +1,412 @@
+/** ===========================================================================
+    @addtogroup Rpn
+    @addtogroup Rpn_Module rpn
+
+    @package    rpn
+    @brief      This header wraps the program module for C++17 callers.
+
+    @file       rpn.hpp
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    rpn::Expression owns one compiled program. It can be moved
+                but not copied, and releases the program when it goes out of
+                scope. Expressions are compiled straight from a
+                std::string_view through Program_compileLength, so text
+                inside a larger buffer is never copied into a terminated
+                string first.
+
+                A compiled program is a single pointer-free block, so once
+                compiled it is moved into memory taken from a
+                std::pmr::memory_resource, which also provides the result
+                and status buffers of the allocating overloads. Every other
+                overload writes into spans the caller owns.
+
+                Failures throw rpn::error, a std::system_error carrying the
+                errno value that the C function returned.
+
+    @note       - Header-only: link against the C sources as usual.
+                - rpn::span is std::span when the standard library has it,
+                  and a minimal pointer and size pair otherwise.
+                - Evaluation does not modify the program, so one Expression
+                  may be evaluated from many threads at once.
+
+    @see        - rpn::Expression
+                - rpn::error
+                - Program_compileLength
+ =========================================================================== **/
+
+#ifndef RPN_HPP_
+#define RPN_HPP_
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <memory_resource>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if (__cplusplus > 201703L) && __has_include(<span>)
+#include <span>
+#endif
+
+#include <program.h>
+
+namespace rpn
+{
+
+/* ==================================== *\
+ *       PUBLIC TYPES DEFINITION        *
+\* ==================================== */
+
+#if defined(__cpp_lib_span)
+
+/** ============================================================================
+  @typedef  span
+  @package  rpn
+
+  @brief    Contiguous view used by the batch overloads.
+ =========================================================================== **/
+template <typename T>
+using span = std::span<T>;
+
+#else
+
+/** ============================================================================
+  @class    span
+  @package  rpn
+
+  @brief    Contiguous view used by the batch overloads before C++20.
+
+  @details  Binds to a pointer and a size, a C array, or any container with
+            data() and size(), such as std::vector and std::array.
+ =========================================================================== **/
+template <typename T>
+class span
+{
+public:
+    constexpr span() noexcept = default;
+
+    constexpr span(T* data, std::size_t size) noexcept : data_(data), size_(size) {}
+
+    template <std::size_t N>
+    constexpr span(T (&array)[N]) noexcept : data_(array), size_(N) {}
+
+    template <typename Container,
+              typename = std::enable_if_t<std::is_convertible_v<decltype(std::declval<Container&>().data()), T*>>>
+    constexpr span(Container& container) noexcept : data_(container.data()), size_(container.size()) {}
+
+    constexpr T* data() const noexcept { return data_; }
+    constexpr std::size_t size() const noexcept { return size_; }
+    constexpr bool empty() const noexcept { return size_ == 0u; }
+    constexpr T* begin() const noexcept { return data_; }
+    constexpr T* end() const noexcept { return data_ + size_; }
+    constexpr T& operator[](std::size_t index) const noexcept { return data_[index]; }
+
+private:
+    T*          data_ = nullptr;    /*< First element >*/
+    std::size_t size_ = 0u;         /*< Number of elements >*/
+};
+
+#endif
+
+/** ============================================================================
+  @class    error
+  @package  rpn
+
+  @brief    Exception thrown when a C call of the library fails.
+
+  @details  code().value() is the positive errno value, e.g. EINVAL for a
+            malformed expression or a failed evaluation.
+ =========================================================================== **/
+class error : public std::system_error
+{
+public:
+    error(int status, const char* what) : std::system_error(-status, std::generic_category(), what) {}
+};
+
+/** ============================================================================
+  @class    Expression
+  @package  rpn
+
+  @brief    Movable, non-copyable handle to a compiled expression.
+ =========================================================================== **/
+class Expression
+{
+public:
+    /** ========================================================================
+      @fn       Expression::Expression
+      @package  rpn
+
+      @brief    Compiles an infix expression.
+
+      @param    text        [in]:   Infix expression; needs no terminator.
+      @param    registry    [in]:   User functions it may call, or nullptr.
+      @param    resource    [in]:   Memory of the compiled program.
+
+      @throw    rpn::error if the expression is malformed or memory runs out.
+     ======================================================================== **/
+    explicit Expression(std::string_view text, const registry_t* registry = nullptr,
+                        std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : resource_(resource)
+    {
+        rpn_program_t* compiled = nullptr;
+        int status              = Program_compileLength((text.data() != nullptr) ? text.data() : "", text.size(), registry, &compiled);
+
+        if (status != 0)
+        {
+            throw error(status, "rpn::Expression: compile failed");
+        }
+
+        /*< The block holds no pointers, so a byte copy is a valid program >*/
+        try
+        {
+            program_ = static_cast<rpn_program_t*>(resource_->allocate(compiled->size, alignof(std::max_align_t)));
+        }
+        catch (...)
+        {
+            Program_destroy(compiled);
+            throw;
+        }
+
+        std::memcpy(program_, compiled, compiled->size);
+        Program_destroy(compiled);
+    }
+
+    /** ========================================================================
+      @fn       Expression::Expression
+      @package  rpn
+
+      @brief    Compiles an infix expression into memory from a resource.
+
+      @param    text        [in]:   Infix expression; needs no terminator.
+      @param    resource    [in]:   Memory of the compiled program.
+
+      @throw    rpn::error if the expression is malformed or memory runs out.
+     ======================================================================== **/
+    Expression(std::string_view text, std::pmr::memory_resource* resource) : Expression(text, nullptr, resource) {}
+
+    Expression(const Expression&)            = delete;
+    Expression& operator=(const Expression&) = delete;
+
+    Expression(Expression&& other) noexcept
+        : program_(std::exchange(other.program_, nullptr)), resource_(other.resource_)
+    {
+    }
+
+    Expression& operator=(Expression&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            program_    = std::exchange(other.program_, nullptr);
+            resource_   = other.resource_;
+        }
+
+        return *this;
+    }
+
+    ~Expression() { release(); }
+
+    /** ========================================================================
+      @fn       Expression::program
+      @package  rpn
+
+      @brief    Returns the compiled program, for calls into the C API.
+
+      @return   The program, or nullptr once moved from.
+     ======================================================================== **/
+    const rpn_program_t* program() const noexcept { return program_; }
+
+    /** ========================================================================
+      @fn       Expression::resource
+      @package  rpn
+
+      @brief    Returns the memory resource of the expression.
+     ======================================================================== **/
+    std::pmr::memory_resource* resource() const noexcept { return resource_; }
+
+    /** ========================================================================
+      @fn       Expression::variable_count
+      @package  rpn
+
+      @brief    Returns the number of variable slots.
+     ======================================================================== **/
+    std::size_t variable_count() const noexcept { return (program_ != nullptr) ? program_->var_count : 0u; }
+
+    /** ========================================================================
+      @fn       Expression::variable_name
+      @package  rpn
+
+      @brief    Returns the name bound to a variable slot.
+
+      @param    slot    [in]:   Slot below variable_count().
+
+      @return   A view into the program.
+     ======================================================================== **/
+    std::string_view variable_name(std::size_t slot) const noexcept { return PROGRAM_VARIABLES(program_)[slot]; }
+
+    /** ========================================================================
+      @fn       Expression::find_variable
+      @package  rpn
+
+      @brief    Returns the slot of a variable, without copying the name.
+
+      @param    name    [in]:   Variable name.
+
+      @return   Slot index, or -ENOENT if there is no such variable.
+     ======================================================================== **/
+    int find_variable(std::string_view name) const noexcept
+    {
+        for (std::size_t slot = 0u; slot < variable_count(); slot++)
+        {
+            if (variable_name(slot) == name)
+            {
+                return static_cast<int>(slot);
+            }
+        }
+
+        return -(ENOENT);
+    }
+
+    /** ========================================================================
+      @fn       Expression::evaluate
+      @package  rpn
+
+      @brief    Evaluates an expression without variables.
+
+      @return   The value.
+
+      @throw    rpn::error if the evaluation fails or variables are missing.
+     ======================================================================== **/
+    double evaluate() const { return evaluate(span<const double>()); }
+
+    /** ========================================================================
+      @fn       Expression::evaluate
+      @package  rpn
+
+      @brief    Evaluates an expression with one value per variable slot.
+
+      @param    variables   [in]:   At least variable_count() values.
+
+      @return   The value.
+
+      @throw    rpn::error if the evaluation fails or variables are missing.
+     ======================================================================== **/
+    double evaluate(span<const double> variables) const
+    {
+        double result = 0.0;
+
+        if (variables.size() < variable_count())
+        {
+            throw error(-(EINVAL), "rpn::Expression: missing variables");
+        }
+
+        check(Program_evaluateWith(program_, variables.empty() ? nullptr : variables.data(), &result), "rpn::Expression: evaluation failed");
+
+        return result;
+    }
+
+    /** ========================================================================
+      @fn       Expression::evaluate
+      @package  rpn
+
+      @brief    Evaluates an expression over many rows into caller buffers.
+
+      @param    columns [in]:   One column of results.size() values per
+                                variable slot.
+      @param    results [out]:  Value of each row, NaN where it fails.
+      @param    status  [out]:  0 or -EINVAL for each row; same size as
+                                results.
+
+      @return   Number of failed rows.
+
+      @throw    rpn::error if columns are missing, the sizes differ or memory
+                runs out.
+     ======================================================================== **/
+    std::size_t evaluate(span<const double* const> columns, span<double> results, span<int> status) const
+    {
+        if ((columns.size() < variable_count()) || (results.size() != status.size()))
+        {
+            throw error(-(EINVAL), "rpn::Expression: mismatched buffers");
+        }
+
+        return static_cast<std::size_t>(check(Program_evaluateBlock(program_, columns.empty() ? nullptr : columns.data(),
+                                                                    results.size(), results.data(), status.data()),
+                                              "rpn::Expression: block evaluation failed"));
+    }
+
+    /** ========================================================================
+      @fn       Expression::evaluate
+      @package  rpn
+
+      @brief    Evaluates an expression over many rows into buffers taken
+                from its memory resource.
+
+      @param    columns [in]:   One column of `rows` values per variable slot.
+      @param    rows    [in]:   Number of rows.
+
+      @return   Value of each row, NaN where it fails.
+
+      @throw    rpn::error if columns are missing or memory runs out.
+     ======================================================================== **/
+    std::pmr::vector<double> evaluate(span<const double* const> columns, std::size_t rows) const
+    {
+        std::pmr::vector<double> results(rows, 0.0, resource_);
+        std::pmr::vector<int> status(rows, 0, resource_);
+
+        (void)evaluate(columns, span<double>(results.data(), rows), span<int>(status.data(), rows));
+
+        return results;
+    }
+
+private:
+    /** ========================================================================
+      @fn       Expression::check
+      @package  rpn
+
+      @brief    Throws if a C call failed, otherwise passes its result on.
+     ======================================================================== **/
+    static int check(int status, const char* what)
+    {
+        if (status < 0)
+        {
+            throw error(status, what);
+        }
+
+        return status;
+    }
+
+    /** ========================================================================
+      @fn       Expression::release
+      @package  rpn
+
+      @brief    Returns the program to its memory resource.
+     ======================================================================== **/
+    void release() noexcept
+    {
+        if (program_ != nullptr)
+        {
+            resource_->deallocate(program_, program_->size, alignof(std::max_align_t));
+            program_ = nullptr;
+        }
+    }
+
+    rpn_program_t*              program_  = nullptr;    /*< Compiled program, owned >*/
+    std::pmr::memory_resource*  resource_ = nullptr;    /*< Memory of program_ >*/
+};
+
+} /* namespace rpn */
+
+#endif /* RPN_HPP_ */
+
+/*< end of header file >*/
@@ -0,0 +1,466 @@
+/** ===========================================================================
+    @addtogroup Session
+    @addtogroup Session_Module session
+
+    @package    session
+    @brief      This module keeps the state of an interactive, HP-style
+                calculator: a persistent value stack and an infix input line
+                previewed on every edit.
+
+    @file       session.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    The value stack is a stack_val_t and is addressed by level,
+                level 1 being the top, as on HP calculators. Values are
+                pushed, popped, swapped, duplicated and rolled with the
+                Session_* stack commands, and operators or functions are
+                applied to the stack with Session_apply.
+
+                The input line is changed with Session_edit, which replaces
+                a range of the buffer. Only the edited region is tokenized
+                again: scanning starts at the first token touched by the
+                edit and stops as soon as it reaches the start of an old
+                token past the edit, whose tokens are kept and shifted.
+
+                Session_preview evaluates the input line. Every subtree of
+                the expression is identified by a hash of its tokens, and
+                the values of subtrees that call the math library are kept
+                in a small cache, so the parts of a large expression left
+                untouched by a keystroke are not computed again.
+
+                Named variables and named programs compiled with
+                Program_compile are kept in the session too. Variables are
+                visible to the preview and to stored programs.
+
+                A session is a single pointer-free block: the stack,
+                tables and input line are fixed-size arrays, and stored
+                programs are relocatable rpn_program_t blocks copied into an
+                arena and referenced by offset. Session_save writes the
+                block to a file as is, and Session_restore maps that file
+                back with one private mmap. No log is replayed and nothing
+                is rebuilt.
+
+    @note       - A failed command leaves the stack unchanged.
+                - Session_enter pushes the preview and clears the input; on
+                  an empty input it duplicates level 1.
+                - The input line is limited to MAX_EXPRESSION_SIZE - 1
+                  characters and MAX_NUM_TOKENS tokens.
+                - Snapshots use host byte order and the layout of this
+                  build. They are meant to be restored by the same binary on
+                  the same machine. A snapshot of a different size is
+                  rejected.
+                - Changes to a restored session stay in memory until the next
+                  Session_save; the mapping is copy-on-write.
+
+    @see        - Session_create
+                - Session_apply
+                - Session_edit
+                - Session_preview
+                - Session_enter
+                - Session_store
+                - Session_define
+                - Session_save
+                - Session_restore
+ =========================================================================== **/
+
+#ifndef SESSION_H_
+#define SESSION_H_
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================================== *\
+ *           PUBLIC DEFINES             *
+\* ==================================== */
+
+/** ====================================
+  @def      SESSION_MAX_VARIABLES
+  @package  session
+  @brief    Defines the number of named
+            variables of a session.
+ ==================================== **/
+#define SESSION_MAX_VARIABLES   (unsigned int)(256U)
+
+/** ====================================
+  @def      SESSION_MAX_PROGRAMS
+  @package  session
+  @brief    Defines the number of named
+            programs of a session.
+ ==================================== **/
+#define SESSION_MAX_PROGRAMS    (unsigned int)(128U)
+
+/** ====================================
+  @def      SESSION_ARENA_SIZE
+  @package  session
+  @brief    Defines the bytes available
+            to stored programs.
+ ==================================== **/
+#define SESSION_ARENA_SIZE      (unsigned int)(256U * 1024U)
+
+/* ==================================== *\
+ *       PUBLIC TYPES DEFINITION        *
+\* ==================================== */
+
+/** ============================================================================
+  @struct   rpn_session_t
+  @package  session
+
+  @typedef  rpn_session_t
+
+  @brief    Opaque handle to a calculator session.
+ =========================================================================== **/
+typedef struct rpnSession rpn_session_t;
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS PROTOTYPES      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Session_create
+  @package  session
+
+  @brief    Creates a session with an empty stack and an empty input line.
+
+  @param    session [out]:  Receives the new session.
+
+  @return   0 on success.
+            -ENOMEM if session is NULL or the allocation fails.
+ =========================================================================== **/
+int Session_create(rpn_session_t** session);
+
+/** ============================================================================
+  @fn       Session_destroy
+  @package  session
+
+  @brief    Releases a session.
+
+  @details  A session obtained from Session_restore is unmapped.
+
+  @param    session [in]:   Session to release. NULL is ignored.
+ =========================================================================== **/
+void Session_destroy(rpn_session_t* session);
+
+/** ============================================================================
+  @fn       Session_push
+  @package  session
+
+  @brief    Pushes a value onto level 1.
+
+  @param    session [in/out]:   Session to update.
+  @param    value   [in]:       Value to push.
+
+  @return   0 on success.
+            -ENOMEM if session is NULL.
+            -EINVAL if the stack is full.
+ =========================================================================== **/
+int Session_push(rpn_session_t* session, double value);
+
+/** ============================================================================
+  @fn       Session_pop
+  @package  session
+
+  @brief    Removes the value of level 1.
+
+  @param    session [in/out]:   Session to update.
+  @param    value   [out]:      Receives the value, or NULL to drop it.
+
+  @return   0 on success.
+            -ENOMEM if session is NULL.
+            -EINVAL if the stack is empty.
+ =========================================================================== **/
+int Session_pop(rpn_session_t* session, double* value);
+
+/** ============================================================================
+  @fn       Session_swap
+  @package  session
+
+  @brief    Exchanges levels 1 and 2.
+
+  @param    session [in/out]:   Session to update.
+
+  @return   0 on success.
+            -ENOMEM if session is NULL.
+            -EINVAL if the stack holds less than two values.
+ =========================================================================== **/
+int Session_swap(rpn_session_t* session);
+
+/** ============================================================================
+  @fn       Session_dup
+  @package  session
+
+  @brief    Pushes a copy of level 1.
+
+  @param    session [in/out]:   Session to update.
+
+  @return   0 on success.
+            -ENOMEM if session is NULL.
+            -EINVAL if the stack is empty or full.
+ =========================================================================== **/
+int Session_dup(rpn_session_t* session);
+
+/** ============================================================================
+  @fn       Session_roll
+  @package  session
+
+  @brief    Moves a level to the top, shifting the levels above it down.
+
+  @details  Session_roll(session, 3) turns "a b c" (c on level 1) into
+            "b c a". Level 1 is a no-op and level 2 is a swap.
+
+  @param    session [in/out]:   Session to update.
+  @param    level   [in]:       Level to move, 1 being the top.
+
+  @return   0 on success.
+            -ENOMEM if session is NULL.
+            -EINVAL if level is 0 or deeper than the stack.
+ =========================================================================== **/
+int Session_roll(rpn_session_t* session, size_t level);
+
+/** ============================================================================
+  @fn       Session_depth
+  @package  session
+
+  @brief    Returns the number of values on the stack.
+
+  @param    session [in]:   Session to query.
+
+  @return   Number of values on success.
+            -ENOMEM if session is NULL.
+ =========================================================================== **/
+int Session_depth(const rpn_session_t* session);
+
+/** ============================================================================
+  @fn       Session_peek
+  @package  session
+
+  @brief    Reads a level without removing it.
+
+  @param    session [in]:   Session to query.
+  @param    level   [in]:   Level to read, 1 being the top.
+  @param    value   [out]:  Receives the value.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -EINVAL if level is 0 or deeper than the stack.
+ =========================================================================== **/
+int Session_peek(const rpn_session_t* session, size_t level, double* value);
+
+/** ============================================================================
+  @fn       Session_apply
+  @package  session
+
+  @brief    Applies an operator or a function to the stack.
+
+  @details  Binary operators take level 2 as left and level 1 as right
+            operand; "!" takes level 1. A function of n arguments takes
+            levels n down to 1 as its arguments in call order. The operands
+            are replaced by the result.
+
+  @param    session [in/out]:   Session to update.
+  @param    token   [in]:       Operator or function name.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -EINVAL if the token is unknown, lacks operands or the operation
+            fails (e.g., division by zero).
+ =========================================================================== **/
+int Session_apply(rpn_session_t* session, const char* token);
+
+/** ============================================================================
+  @fn       Session_edit
+  @package  session
+
+  @brief    Replaces a range of the input line and retokenizes it.
+
+  @param    session [in/out]:   Session to update.
+  @param    offset  [in]:       Start of the replaced range.
+  @param    removed [in]:       Number of characters removed at offset.
+  @param    text    [in]:       Inserted text, not NUL-terminated; may be
+                                NULL if length is 0.
+  @param    length  [in]:       Number of characters inserted.
+
+  @return   0 on success, even if the new input does not tokenize; the
+            error is then reported by Session_preview.
+            -ENOMEM if session is NULL, or text is NULL with length > 0.
+            -EINVAL if the range is outside the input, the text contains a
+            NUL character or the result would not fit the buffer.
+ =========================================================================== **/
+int Session_edit(rpn_session_t* session, size_t offset, size_t removed, const char* text, size_t length);
+
+/** ============================================================================
+  @fn       Session_text
+  @package  session
+
+  @brief    Returns the input line.
+
+  @param    session [in]:   Session to query.
+
+  @return   NUL-terminated input line, or NULL if session is NULL.
+ =========================================================================== **/
+const char* Session_text(const rpn_session_t* session);
+
+/** ============================================================================
+  @fn       Session_preview
+  @package  session
+
+  @brief    Evaluates the input line without changing the stack.
+
+  @param    session [in/out]:   Session to evaluate.
+  @param    result  [out]:      Receives the value of the input line.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -EINVAL if the input is empty, does not tokenize, uses an
+            unknown variable or fails to evaluate.
+ =========================================================================== **/
+int Session_preview(rpn_session_t* session, double* result);
+
+/** ============================================================================
+  @fn       Session_enter
+  @package  session
+
+  @brief    Pushes the value of the input line and clears it.
+
+  @details  On an empty input line, duplicates level 1 instead.
+
+  @param    session [in/out]:   Session to update.
+
+  @return   0 on success.
+            -ENOMEM if session is NULL.
+            -EINVAL if the input does not evaluate or the stack cannot
+            take the value; the input is kept.
+ =========================================================================== **/
+int Session_enter(rpn_session_t* session);
+
+/** ============================================================================
+  @fn       Session_store
+  @package  session
+
+  @brief    Assigns a value to a named variable, creating it if needed.
+
+  @param    session [in/out]:   Session to update.
+  @param    name    [in]:       Variable name.
+  @param    value   [in]:       Value to assign.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -EINVAL if name is not a valid variable name.
+            -ENOSPC if SESSION_MAX_VARIABLES variables already exist.
+ =========================================================================== **/
+int Session_store(rpn_session_t* session, const char* name, double value);
+
+/** ============================================================================
+  @fn       Session_recall
+  @package  session
+
+  @brief    Reads a named variable.
+
+  @param    session [in]:   Session to query.
+  @param    name    [in]:   Variable name.
+  @param    value   [out]:  Receives the value.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -ENOENT if the variable does not exist.
+ =========================================================================== **/
+int Session_recall(const rpn_session_t* session, const char* name, double* value);
+
+/** ============================================================================
+  @fn       Session_define
+  @package  session
+
+  @brief    Compiles an expression and stores it as a named program.
+
+  @details  The compiled block is copied into the session arena. Redefining
+            a name points it to the new block; the space of the old one is
+            not reclaimed. Programs that call natives are refused, since
+            native indices differ from one process to the next.
+
+  @param    session     [in/out]:   Session to update.
+  @param    name        [in]:       Program name.
+  @param    expression  [in]:       Infix expression.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or compilation runs out of
+            memory.
+            -EINVAL if name is not a valid name, the expression is
+            malformed or it calls a native.
+            -ENOSPC if the program table or the arena is full.
+ =========================================================================== **/
+int Session_define(rpn_session_t* session, const char* name, const char* expression);
+
+/** ============================================================================
+  @fn       Session_run
+  @package  session
+
+  @brief    Evaluates a named program and pushes its result.
+
+  @details  The variables of the program are bound to the session variables
+            of the same name.
+
+  @param    session [in/out]:   Session to update.
+  @param    name    [in]:       Program name.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -ENOENT if the program or one of its variables does not exist.
+            -EINVAL if the evaluation fails or the stack is full.
+ =========================================================================== **/
+int Session_run(rpn_session_t* session, const char* name);
+
+/** ============================================================================
+  @fn       Session_save
+  @package  session
+
+  @brief    Atomically writes a snapshot of a session.
+
+  @details  Writes "<path>.tmp", flushes it to disk, renames it over path
+            and flushes the directory so the rename survives a crash.
+
+  @param    session [in]:   Session to save.
+  @param    path    [in]:   Path of the snapshot file.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -EIO if the file or its directory cannot be written.
+ =========================================================================== **/
+int Session_save(const rpn_session_t* session, const char* path);
+
+/** ============================================================================
+  @fn       Session_restore
+  @package  session
+
+  @brief    Maps a snapshot back as a session.
+
+  @details  The file is mapped privately and used in place. Release the
+            session with Session_destroy as usual. Counts, offsets and
+            stored programs are validated before the session is returned.
+
+  @param    path    [in]:   Path of the snapshot file.
+  @param    session [out]:  Receives the restored session.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -ENOENT if the file cannot be opened or mapped.
+            -EINVAL if the file is not a snapshot of this layout or a field
+            is out of range.
+ =========================================================================== **/
+int Session_restore(const char* path, rpn_session_t** session);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SESSION_H_ */
+
+/*< end of header file >*/
@@ -0,0 +1,77 @@
+/** ===========================================================================
+    @addtogroup Shape
+    @addtogroup Shape_Module shape
+
+    @package    shape
+    @brief      This module evaluates large sets of constant expressions by
+                grouping those with the same structure and running each
+                group as one vectorized program.
+
+    @file       shape.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    Expressions such as "2*sin(0.5)+1" and "3*sin(0.25)+7"
+                compile to the same instructions and differ only in their
+                constant pools. Expressions are grouped by their token
+                skeleton, with numbers as wildcards, so only one expression
+                per skeleton is compiled, and skeletons that compile to the
+                same instruction array share a shape group. Each group is
+                then rewritten into a single lane program in which constant
+                `k` becomes variable slot `k`, and the constants of the
+                members are laid out as columns, one row per member, so
+                Program_evaluateBlock decodes the shape once and evaluates
+                every member of the group in the SIMD tiles.
+
+    @note       - Only expressions without variables take part; an
+                  expression with variables fails with -EINVAL.
+                - Results match evaluating each expression on its own.
+
+    @see        - Shape_evaluateMany
+                - Program_evaluateBlock
+ =========================================================================== **/
+
+#ifndef SHAPE_H_
+#define SHAPE_H_
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS PROTOTYPES      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Shape_evaluateMany
+  @package  shape
+
+  @brief    Evaluates many constant expressions grouped by shape.
+
+  @param    expressions [in]:   Infix expressions.
+  @param    count       [in]:   Number of expressions.
+  @param    results     [out]:  Value of each expression, NaN on failure.
+  @param    status      [out]:  0 or the error of each expression.
+  @param    shapes      [out]:  Receives the number of shape groups. May be
+                                NULL.
+
+  @return   Number of failed expressions on success, saturated at INT_MAX.
+            -ENOMEM if an argument is NULL or an allocation fails.
+ =========================================================================== **/
+int Shape_evaluateMany(const char* const* expressions, size_t count, double* results, int* status, size_t* shapes);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHAPE_H_ */
+
+/*< end of header file >*/
@@ -35,6 +35,10 @@
 #ifndef STACKOPS_H_
 #define STACKOPS_H_
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /* ==================================== *\
  *           PUBLIC DEFINES             *
 \* ==================================== */
@@ -253,6 +257,10 @@ double Stack_popVal (stack_val_t *stack_val);
  =========================================================================== **/
 int Stack_isEmptyVal (stack_val_t *stack_val);
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* STACKOPS_H_ */
 
 /*< end of header file >*/
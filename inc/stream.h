@@ -0,0 +1,169 @@
+/** ===========================================================================
+    @addtogroup Stream
+    @addtogroup Stream_Module stream
+
+    @package    stream
+    @brief      This module evaluates postfix (RPN) text directly, in one
+                pass over input delivered in chunks of any size.
+
+    @file       stream.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    Tokens are separated by whitespace and use the vocabulary of
+                RPNCalculator_infixToPostfix output: numbers, the operators
+                + - * / ^ !, and function names. Each token is applied to the
+                value stack as soon as its terminating whitespace arrives, so
+                nothing but the stack and the token being read is kept. A
+                token split across two chunks is carried over in a small
+                pending buffer.
+
+                Unlike RPNCalculator_evaluatePostfix there is no token-count
+                limit: the value stack grows on demand and memory is bounded
+                by the maximum stack depth of the input, not by its length.
+
+    @note       - A number may carry a sign ("-3"); a lone "-" is the
+                  subtraction operator.
+                - After an error the stream ignores further input until
+                  Stream_reset, and reports the same error.
+
+    @see        - Stream_init
+                - Stream_feed
+                - Stream_finish
+                - Stream_evaluate
+ =========================================================================== **/
+
+#ifndef STREAM_H_
+#define STREAM_H_
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+
+#include <RPNCalculator.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================================== *\
+ *       PUBLIC TYPES DEFINITION        *
+\* ==================================== */
+
+/** ============================================================================
+  @struct   rpn_stream_t
+  @package  stream
+
+  @typedef  rpn_stream_t
+
+  @brief    Represents a postfix evaluation in progress.
+============================================================================ **/
+typedef struct
+{
+    double*     values;                     /*< Value stack >*/
+    size_t      depth;                      /*< Values on the stack >*/
+    size_t      capacity;                   /*< Allocated stack entries >*/
+    char        pending[MAX_TOKEN_LEN];     /*< Token read so far >*/
+    size_t      pending_length;             /*< Length of the pending token >*/
+    int         status;                     /*< 0, or the first error >*/
+} rpn_stream_t;
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS PROTOTYPES      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Stream_init
+  @package  stream
+
+  @brief    Initializes an empty stream.
+
+  @param    stream  [out]:  Stream to initialize.
+
+  @return   0 on success.
+            -ENOMEM if stream is NULL.
+ =========================================================================== **/
+int Stream_init(rpn_stream_t* stream);
+
+/** ============================================================================
+  @fn       Stream_release
+  @package  stream
+
+  @brief    Releases the value stack of a stream.
+
+  @param    stream  [in/out]:   Stream to release.
+ =========================================================================== **/
+void Stream_release(rpn_stream_t* stream);
+
+/** ============================================================================
+  @fn       Stream_reset
+  @package  stream
+
+  @brief    Empties a stream and clears its error, keeping its allocation.
+
+  @param    stream  [in/out]:   Stream to reset.
+ =========================================================================== **/
+void Stream_reset(rpn_stream_t* stream);
+
+/** ============================================================================
+  @fn       Stream_feed
+  @package  stream
+
+  @brief    Consumes the next chunk of postfix text.
+
+  @param    stream  [in/out]:   Stream to feed.
+  @param    data    [in]:       Chunk, not NUL-terminated.
+  @param    length  [in]:       Length of the chunk.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or the stack cannot grow.
+            -EINVAL if a token is unknown or too long, an operator lacks
+            operands, or an operation fails (e.g., division by zero).
+ =========================================================================== **/
+int Stream_feed(rpn_stream_t* stream, const char* data, size_t length);
+
+/** ============================================================================
+  @fn       Stream_finish
+  @package  stream
+
+  @brief    Ends the input and returns the value of the expression.
+
+  @details  Applies the last token if the input did not end with whitespace
+            and checks that exactly one value is left. The stream is reset
+            afterwards, ready for the next expression.
+
+  @param    stream  [in/out]:   Stream to finish.
+  @param    result  [out]:      Receives the value of the expression.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -EINVAL if the input was invalid or did not leave exactly one
+            value.
+ =========================================================================== **/
+int Stream_finish(rpn_stream_t* stream, double* result);
+
+/** ============================================================================
+  @fn       Stream_evaluate
+  @package  stream
+
+  @brief    Evaluates a complete postfix text in one call.
+
+  @param    text    [in]:   Postfix text, not NUL-terminated.
+  @param    length  [in]:   Length of the text.
+  @param    result  [out]:  Receives the value of the expression.
+
+  @return   0 on success, or the error of Stream_feed or Stream_finish.
+ =========================================================================== **/
+int Stream_evaluate(const char* text, size_t length, double* result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STREAM_H_ */
+
+/*< end of header file >*/
@@ -0,0 +1,88 @@
+/** ===========================================================================
+    @addtogroup Tree
+    @addtogroup Tree_Module tree
+
+    @package    tree
+    @brief      This module evaluates one very large postfix expression on a
+                work-stealing pool.
+
+    @file       tree.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    A postfix expression is the post-order walk of its tree, so
+                every subtree is a contiguous run of tokens that ends at its
+                root. One pass records the size of each subtree; the child
+                of a node that ends right before it is its last argument,
+                the one ending before that run is the previous argument, and
+                so on.
+
+                Subtrees of at most `grain` tokens are evaluated in place,
+                left to right, as RPNCalculator_evaluatePostfix would.
+                Larger ones follow their heaviest child downwards without
+                recursion, spawn a pool task for every other child larger
+                than the grain, and fold the values back up the path. Each
+                spawned child has at most half the tokens of its parent, so
+                tasks nest only logarithmically deep, however lopsided the
+                tree.
+
+    @note       - The value and the failures are the same as with
+                  RPNCalculator_evaluatePostfix, except that the value stack
+                  is not limited to MAX_STACK_SIZE entries.
+                - Operands are never reassociated, so a long chain such as
+                  "a + b + c + ..." has no independent subtrees to share and
+                  is folded by a single thread.
+
+    @see        - Tree_evaluatePostfix
+ =========================================================================== **/
+
+#ifndef TREE_H_
+#define TREE_H_
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+
+#include <RPNCalculator.h>
+#include <pool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS PROTOTYPES      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Tree_evaluatePostfix
+  @package  tree
+
+  @brief    Evaluates a postfix expression, sharing its large subtrees
+            among the threads of a pool.
+
+  @param    pool    [in]:   Pool to run on. NULL evaluates on the caller.
+  @param    postfix [in]:   Postfix tokens, as RPNCalculator_infixToPostfix
+                            or Parse_infixToPostfix give them.
+  @param    count   [in]:   Number of tokens.
+  @param    grain   [in]:   Largest subtree evaluated without splitting, at
+                            most MAX_STACK_SIZE; 0 uses MAX_STACK_SIZE.
+  @param    result  [out]:  Receives the value.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -EINVAL if the expression is malformed or fails to evaluate.
+ =========================================================================== **/
+int Tree_evaluatePostfix(pool_t* pool, char postfix[][MAX_TOKEN_LEN], size_t count, size_t grain, double* result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TREE_H_ */
+
+/*< end of header file >*/
@@ -26,12 +26,15 @@
                   evaluation.
 
     @see        - RPNCalculator_tokenize
+                - RPNCalculator_tokenizeLength
                 - RPNCalculator_infixToPostfix
                 - RPNCalculator_evaluatePostfix
                 - RPNCalculator_whichOperator
                 - RPNCalculator_whichFunction
+                - RPNCalculator_functionArity
                 - RPNCalculator_checkPrecedence
                 - RPNCalculator_isRightAssociative
+                - RPNCalculator_isVariable
  =========================================================================== **/
  
 /* ==================================== *\
@@ -43,12 +46,13 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <stdint.h>
 #include <math.h>
 #include <errno.h>
 
 /*< Implements >*/
 #include <stackops.h>
-#include <RPNcalculator.h>
+#include <RPNCalculator.h>
 
 /* ==================================== *\
  *            PRIVATE DEFINES           *
@@ -64,7 +68,7 @@
             operation, typically with 
             a value of 0.
  ==================================== **/ 
-#define FUNCTION_SUCCESS         (unsigned int)(0u)
+#define FUNCTION_SUCCESS        (int)(0)
 
 /** ====================================
   @def      EMPTY_TOP
@@ -78,6 +82,14 @@
  ==================================== **/ 
 #define EMPTY_TOP               (int)(-1)
 
+/** ====================================
+  @def      ARGUMENT_SEPARATOR
+  @package  RPN_calculator
+  @brief    Separates the arguments of
+            a function call.
+ ==================================== **/ 
+#define ARGUMENT_SEPARATOR      ","
+
 /* ==================================== *\
  *       PRIVATE TYPES DEFINITION       *
 \* ==================================== */
@@ -103,59 +115,6 @@ typedef enum operationPrecedences
     LAST_PRECEDENCE
 } ops_precedence_t;
 
-/** ============================================================================
-  @enum     funcIndex
-  @package  RPN_calculator
-
-  @typedef  func_index_t
-
-  @brief    Defines indices for mathematical functions.
-
-  @details  Enumerates the indices corresponding to supported mathematical 
-            functions, used for function identification and lookup.
- =========================================================================== **/
-typedef enum funcIndex
-{
-    FUNC_SQRT,     /*< Square root function >*/
-    FUNC_LOG,      /*< Logarithm base 10 function >*/
-    FUNC_LN,       /*< Natural logarithm function >*/
-    FUNC_SIN,      /*< Sine function >*/
-    FUNC_COS,      /*< Cosine function >*/
-    FUNC_TAN,      /*< Tangent function >*/
-    FUNC_COSH,     /*< Hyperbolic cosine function >*/
-    FUNC_SINH,     /*< Hyperbolic sine function >*/
-    FUNC_TANH,     /*< Hyperbolic tangent function >*/
-    FUNC_ASIN,     /*< Inverse sine function >*/
-    FUNC_ACOS,     /*< Inverse cosine function >*/
-    FUNC_ATAN,     /*< Inverse tangent function >*/
-    FUNC_ARCSIN,   /*< Alternate inverse sine function >*/
-    FUNC_ARCCOS,   /*< Alternate inverse cosine function >*/
-    FUNC_ARCTAN,   /*< Alternate inverse tangent function >*/
-    FUNC_COUNT     /*< Total number of functions >*/
-} func_index_t;
-
-/** ============================================================================
-  @enum     operatorIndex
-  @package  RPN_calculator
-
-  @typedef  operator_index_t
-
-  @brief    Defines indices for operators.
-
-  @details  Enumerates the indices corresponding to supported operators,
-            used for operator identification and lookup.
- =========================================================================== **/
-typedef enum operatorIndex
-{
-    OP_ADD,    /*< Addition operator '+' >*/
-    OP_SUB,    /*< Subtraction operator '-' >*/
-    OP_MUL,    /*< Multiplication operator '*' >*/
-    OP_DIV,    /*< Division operator '/' >*/
-    OP_POW,    /*< Exponentiation operator '^' >*/
-    OP_FACT,   /*< Factorial operator '!' >*/
-    OP_COUNT   /*< Total number of operators >*/
-} operator_index_t;
-
 /** ============================================================================
   @enum     rigthLeftAssociative
   @package  RPN_calculator
@@ -262,7 +221,47 @@ const char* functions_str[FUNC_COUNT] =
     [FUNC_ATAN]   = "atan",
     [FUNC_ARCSIN] = "arcsin",
     [FUNC_ARCCOS] = "arccos",
-    [FUNC_ARCTAN] = "arctan"
+    [FUNC_ARCTAN] = "arctan",
+    [FUNC_POW10]  = "pow10",
+    [FUNC_ATAN2]  = "atan2",
+    [FUNC_HYPOT]  = "hypot",
+    [FUNC_MIN]    = "min",
+    [FUNC_MAX]    = "max",
+    [FUNC_FMA]    = "fma"
+};
+
+/** ============================================================================
+  @var      functions_arity
+  @package  RPN_calculator
+
+  @brief    Number of arguments of each function.
+
+  @details  Maps function indices defined in `func_index_t` to the number
+            of operands they pop from the value stack.
+ =========================================================================== **/
+static const unsigned int functions_arity[FUNC_COUNT] =
+{
+    [FUNC_SQRT]                 = 1u,
+    [FUNC_LOG]                  = 1u,
+    [FUNC_LN]                   = 1u,
+    [FUNC_SIN]                  = 1u,
+    [FUNC_COS]                  = 1u,
+    [FUNC_TAN]                  = 1u,
+    [FUNC_COSH]                 = 1u,
+    [FUNC_SINH]                 = 1u,
+    [FUNC_TANH]                 = 1u,
+    [FUNC_ASIN]                 = 1u,
+    [FUNC_ACOS]                 = 1u,
+    [FUNC_ATAN]                 = 1u,
+    [FUNC_ARCSIN]               = 1u,
+    [FUNC_ARCCOS]               = 1u,
+    [FUNC_ARCTAN]               = 1u,
+    [FUNC_POW10]                = 1u,
+    [FUNC_ATAN2]                = 2u,
+    [FUNC_HYPOT]                = 2u,
+    [FUNC_MIN]                  = 2u,
+    [FUNC_MAX]                  = 2u,
+    [FUNC_FMA]                  = 3u
 };
 
 /** ============================================================================
@@ -492,6 +491,193 @@ end_of_function:
     return ret;
 }
 
+/** ============================================================================
+  @fn       RPNCalculator_isVariable
+  @package  RPN_calculator
+  
+  @brief    Checks if a given token names a variable.
+ 
+  @details  A variable is an identifier (a letter or '_' followed by letters,
+            digits or '_') that is not a function name. Variables are operands
+            for RPNCalculator_infixToPostfix; RPNCalculator_evaluatePostfix
+            has no bindings and rejects them, while compiled programs bind
+            them through Program_evaluateWith.
+ 
+  @param    token    [in]:   String representing the token to check.
+ 
+  @return   0 if the token is a variable.
+            -ENOMEM if token is NULL.
+            -EINVAL if the token is not a variable.
+ =========================================================================== **/
+int RPNCalculator_isVariable(const char* token) 
+{
+    /*< Variable Declarations >*/
+    int ret         = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t iterator = 0u;
+
+    /*< Security Checks >*/
+    if(token == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    if (
+            ( !isalpha(token[FIRST_VALUE]) && (token[FIRST_VALUE] != '_') )
+                                    ||
+            ( RPNCalculator_whichFunction(token) >= FUNCTION_SUCCESS )
+        )
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    for (iterator = 1u; token[iterator] != '\0'; iterator++)
+    {
+        if (!isalnum(token[iterator]) && (token[iterator] != '_'))
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       RPNCalculator_nextToken
+  @package  RPN_calculator
+  
+  @brief    Reads the next token of an expression.
+ 
+  @details  Skips whitespace from the given position and extracts one number,
+            identifier, operator or bracket, using the same rules as
+            RPNCalculator_tokenize. On success the position is moved past the
+            token, so the token starts at the new position minus its length.
+ 
+  @param    expression   [in]:       String representing the mathematical
+                                     expression.
+  @param    position     [in/out]:   Offset to read from; advanced past the
+                                     token.
+  @param    token        [out]:      Receives the NUL-terminated token.
+ 
+  @return   Length of the token on success, 0 at the end of the expression.
+            -ENOMEM if an argument is NULL.
+            -EINVAL if the character is not recognized.
+ =========================================================================== **/
+int RPNCalculator_nextToken(const char* expression, size_t* position, char token[MAX_TOKEN_LEN]) 
+{
+    return RPNCalculator_nextTokenLength(expression, SIZE_MAX, position, token);
+}
+
+/** ============================================================================
+  @fn       RPNCalculator_nextTokenLength
+  @package  RPN_calculator
+  
+  @brief    Reads the next token of an expression of known length.
+ 
+  @details  Works as RPNCalculator_nextToken, but never reads at or past
+            `length`, so the expression does not need a NUL terminator.
+ 
+  @param    expression   [in]:       String representing the mathematical
+                                     expression.
+  @param    length       [in]:       Number of characters of the expression;
+                                     a NUL before it also ends it.
+  @param    position     [in/out]:   Offset to read from; advanced past the
+                                     token.
+  @param    token        [out]:      Receives the NUL-terminated token.
+ 
+  @return   Length of the token on success, 0 at the end of the expression.
+            -ENOMEM if an argument is NULL.
+            -EINVAL if the character is not recognized.
+ =========================================================================== **/
+int RPNCalculator_nextTokenLength(const char* expression, size_t length, size_t* position, char token[MAX_TOKEN_LEN])
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t  iterator        = 0u;
+    size_t  char_index      = 0u;
+
+    /*< Security Checks >*/
+    if((expression == NULL) || (position == NULL) || (token == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    iterator = *position;
+
+    /*< Start Function Algorithm >*/
+    /*< Ignore whitespace >*/
+    while ((iterator < length) && isspace(expression[iterator]))
+    {
+        iterator++;
+    }
+
+    if ((iterator >= length) || (expression[iterator] == '\0'))
+    {
+        *position = iterator;
+        goto end_of_function;
+    }
+
+    /*< Tokenization of numbers - integer or decimal >*/
+    if ( ( isdigit(expression[iterator]) ) || ( expression[iterator] == '.' ) ) 
+    {
+        while ( 
+                    ( iterator < length )
+                                                        &&
+                    ( ( isdigit(expression[iterator]) ) || ( expression[iterator] == '.' ) )
+                                                        &&
+                                    ( char_index < (MAX_TOKEN_LENGTH - 1u) )
+                ) 
+        {
+            token[char_index++] = expression[iterator++];
+        }
+    }
+    /*< Tokenization of functions or variables - identifiers >*/
+    else if (isalpha(expression[iterator]) || (expression[iterator] == '_')) 
+    {
+        while ( 
+            ( iterator < length )
+                                      &&
+            ( isalnum(expression[iterator]) || (expression[iterator] == '_') ) 
+                                      && 
+                    ( char_index < (MAX_TOKEN_LENGTH - 1u) )
+                ) 
+        {
+            token[char_index++] = expression[iterator++];
+        }
+    }
+    /*< Tokenization of operators and parentheses >*/
+    else if (strchr("+-*/^!()[]{},", expression[iterator]) != NULL) 
+    {
+        token[char_index++] = expression[iterator++];
+    }
+    /*< Unmapped character >*/
+    else
+    {
+        printf("Caractere desconhecido: %c\n", expression[iterator]);
+
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    token[char_index]   = '\0';
+    *position           = iterator;
+
+    ret = (int)(char_index);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
 /** ============================================================================
   @fn       RPNCalculator_tokenize
   @package  RPN_calculator
@@ -514,14 +700,40 @@ end_of_function:
             -EINVAL if the function is not recognized.
  =========================================================================== **/
 int RPNCalculator_tokenize(const char* expression, char tokens[][MAX_TOKEN_LEN]) 
+{
+    return RPNCalculator_tokenizeLength(expression, SIZE_MAX, tokens);
+}
+
+/** ============================================================================
+  @fn       RPNCalculator_tokenizeLength
+  @package  RPN_calculator
+  
+  @brief    Tokenizes an expression of known length into individual tokens.
+ 
+  @details  Works as RPNCalculator_tokenize on the first `length`
+            characters, without needing a NUL terminator, so views into a
+            larger buffer are tokenized in place.
+ 
+  @param    expression   [in]:   String representing the mathematical expression 
+                                 to tokenize.
+  @param    length       [in]:   Number of characters of the expression.
+  @param    tokens       [out]:  Array to store the extracted tokens.
+ 
+  @return   Number of tokens on success,
+            -ENOMEM if token is NULL.
+            -EINVAL if the function is not recognized.
+ =========================================================================== **/
+int RPNCalculator_tokenizeLength(const char* expression, size_t length, char tokens[][MAX_TOKEN_LEN])
 {
     /*< Variable Declarations >*/
     int ret                 = FUNCTION_SUCCESS; /*< Return Control >*/
 
-    size_t  iterator        = 0u;
-    size_t  char_index      = 0u;
+    int     size            = 0;
+    size_t  position        = 0u;
     size_t  total_tokens    = 0u;
 
+    char    token[MAX_TOKEN_LEN];
+
     /*< Security Checks >*/
     if((expression == NULL) || (tokens == NULL))
     {
@@ -530,101 +742,27 @@ int RPNCalculator_tokenize(const char* expression, char tokens[][MAX_TOKEN_LEN])
     }
 
     /*< Start Function Algorithm >*/
-    while (expression[iterator] != '\0') 
+    for (;;)
     {
-        /*< Ignore whitespace >*/
-        if (isspace(expression[iterator])) 
-        {
-            iterator++;
-            continue;
-        }
-
-        /*< Tokenization of numbers - integer or decimal >*/
-        if ( 
-                ( ( isdigit(expression[iterator]) ) || ( expression[iterator] == '.' ) ) 
-                                                   && 
-                                ( char_index < (MAX_TOKEN_LENGTH - 1u) )
-            ) 
+        size = RPNCalculator_nextTokenLength(expression, length, &position, token);
+        if (size < FUNCTION_SUCCESS)
         {
-            if(total_tokens >= MAX_NUM_TOKENS)
-            {
-                ret = -(EINVAL);
-                goto end_of_function;
-            }
-
-            char_index = 0u;
-
-            while ( 
-                        ( ( isdigit(expression[iterator]) ) || ( expression[iterator] == '.' ) )
-                                                            &&
-                                        ( char_index < (MAX_TOKEN_LENGTH - 1u) )
-                                                            &&
-                                            ( expression[iterator] != '\0' )
-                                                           
-                    ) 
-            {
-                tokens[total_tokens][char_index++] = expression[iterator++];
-            }
-
-            tokens[total_tokens][char_index] = '\0';
-
-            total_tokens++;
-
-            continue;
+            ret = size;
+            goto end_of_function;
         }
 
-        /*< Tokenization of functions or variables - sequence of letters >*/
-        if (isalpha(expression[iterator])) 
+        if (size == 0)
         {
-            if(total_tokens >= MAX_NUM_TOKENS)
-            {
-                ret = -(EINVAL);
-                goto end_of_function;
-            }
-
-            char_index = 0u;
-
-            while ( 
-                            ( isalpha(expression[iterator]) ) 
-                                          && 
-                        ( char_index < (MAX_TOKEN_LENGTH - 1u) )
-                                          &&
-                            ( expression[iterator] != '\0' )
-                    ) 
-            {
-                tokens[total_tokens][char_index++] = expression[iterator++];
-            }
-
-            tokens[total_tokens][char_index] = '\0';
-
-            total_tokens++;
-
-            continue;
+            break;
         }
 
-        /*< Tokenization of operators and parentheses >*/
-        if (strchr("+-*/^!()[]{}", expression[iterator]) != NULL) 
+        if(total_tokens >= MAX_NUM_TOKENS)
         {
-            if(total_tokens >= MAX_NUM_TOKENS)
-            {
-                ret = -(EINVAL);
-                goto end_of_function;
-            }
-
-            tokens[total_tokens][FIRST_VALUE]   = expression[iterator];
-            tokens[total_tokens][SECOND_VALUE]  = '\0';
-
-            total_tokens++;
-            iterator++;
-
-            continue;
+            ret = -(EINVAL);
+            goto end_of_function;
         }
 
-        /*< Unmapped character >*/
-        printf("Caractere desconhecido: %c\n", expression[iterator]);
-
-        ret = -(EINVAL);
-        goto end_of_function;
+        memcpy(tokens[total_tokens++], token, (size_t)size + 1u);
     }
 
     ret = (int)(total_tokens);
@@ -643,6 +781,9 @@ end_of_function:
   @details  Implements the Shunting Yard algorithm to convert an infix expression
             represented by tokens into a postfix expression, considering operator
             precedence and associativity.
+            An identifier directly followed by an open bracket is a user
+            function call: it is emitted after its arguments, which are
+            separated by commas, like the built-in functions.
 
   @param    tokens    [in]:  Array of strings representing the infix expression 
                              tokens.
@@ -692,6 +833,29 @@ int RPNCalculator_infixToPostfix(char tokens[][MAX_TOKEN_LEN], char output[][MAX
             continue;
         }
 
+        /*< Token is a variable, or a user function call if a bracket follows >*/
+        if (RPNCalculator_isVariable(token) == FUNCTION_SUCCESS) 
+        {
+            if (
+                    ( (iterator + 1u) < (size_t)number )
+                                    &&
+                    (
+                        ( strcmp(tokens[iterator + 1u], brackets_str[PARENTHESES][LEFT_ASSOCIATIVE])  == FUNCTION_SUCCESS )
+                                                    ||
+                        ( strcmp(tokens[iterator + 1u], brackets_str[BRACKETS][LEFT_ASSOCIATIVE])     == FUNCTION_SUCCESS )
+                                                    ||
+                        ( strcmp(tokens[iterator + 1u], brackets_str[BRACES][LEFT_ASSOCIATIVE])       == FUNCTION_SUCCESS )
+                    )
+                )
+            {
+                Stack_pushOp(&op_stack, token);
+                continue;
+            }
+
+            strcpy(output[total_tokens++], token);
+            continue;
+        }
+
         /*< Token is a function >*/
         if (RPNCalculator_whichFunction(token) >= FUNCTION_SUCCESS) 
         {
@@ -712,6 +876,34 @@ int RPNCalculator_infixToPostfix(char tokens[][MAX_TOKEN_LEN], char output[][MAX
             continue;
         }
 
+        /*< Token is an argument separator - flush the current argument >*/
+        if (strcmp(token, ARGUMENT_SEPARATOR) == FUNCTION_SUCCESS)
+        {
+            top_token = Stack_peekOp(&op_stack);
+
+            while (
+                                            ( top_token != NULL )
+                                                    &&
+                        ( strcmp(top_token, brackets_str[PARENTHESES][LEFT_ASSOCIATIVE])    != FUNCTION_SUCCESS )
+                                                    &&
+                        ( strcmp(top_token,  brackets_str[BRACKETS][LEFT_ASSOCIATIVE])      != FUNCTION_SUCCESS )
+                                                    &&
+                        ( strcmp(top_token, brackets_str[BRACES][LEFT_ASSOCIATIVE])         != FUNCTION_SUCCESS )
+                   ) 
+            {
+                strcpy(output[total_tokens++], Stack_popOp(&op_stack));
+                top_token = Stack_peekOp(&op_stack);
+            }
+
+            if (top_token == NULL) 
+            {
+                ret = -(EINVAL);
+                goto end_of_function;
+            }
+
+            continue;
+        }
+
         /*< Token is a close bracket >*/
         if (
                 ( strcmp(token, brackets_str[PARENTHESES][RIGHT_ASSOCIATIVE])   == FUNCTION_SUCCESS ) 
@@ -748,7 +940,15 @@ int RPNCalculator_infixToPostfix(char tokens[][MAX_TOKEN_LEN], char output[][MAX
             /*< If top is a function, pop to output >*/
             top_token = Stack_peekOp(&op_stack);
 
-            if ((top_token != NULL) && (RPNCalculator_whichFunction(top_token) >= FUNCTION_SUCCESS) ) 
+            if (
+                    ( top_token != NULL )
+                            &&
+                    (
+                        ( RPNCalculator_whichFunction(top_token) >= FUNCTION_SUCCESS )
+                                            ||
+                        ( RPNCalculator_isVariable(top_token) == FUNCTION_SUCCESS )
+                    )
+                ) 
             {
                 strcpy(output[total_tokens++], Stack_popOp(&op_stack));
             }
@@ -766,6 +966,8 @@ int RPNCalculator_infixToPostfix(char tokens[][MAX_TOKEN_LEN], char output[][MAX
                 if (
                         (RPNCalculator_whichFunction(top_token) >= FUNCTION_SUCCESS) 
                                                         ||
+                        (RPNCalculator_isVariable(top_token) == FUNCTION_SUCCESS) 
+                                                        ||
                         (
                             (RPNCalculator_whichOperator(top_token) >= FUNCTION_SUCCESS) 
                                                         &&
@@ -917,7 +1119,8 @@ end_of_function:
   @param    number      [in]:  The operand to apply the function to.
 
   @return   The result of the function as a double.
-            Returns NAN if the function is invalid.
+            Returns NAN if the function is invalid or takes more than one
+            argument.
  =========================================================================== **/
 double RPNCalculator_applyFunction(const char* function, double number) 
 {
@@ -948,7 +1151,90 @@ double RPNCalculator_applyFunction(const char* function, double number)
           (function_index == FUNC_TANH)                                     ? ret = tanh(number)    :
           (function_index == FUNC_ASIN || function_index == FUNC_ARCSIN)    ? ret = asin(number)    :
           (function_index == FUNC_ACOS || function_index == FUNC_ARCCOS)    ? ret = acos(number)    :
-          (function_index == FUNC_ATAN || function_index == FUNC_ARCTAN)    ? ret = atan(number)    : -(EINVAL);
+          (function_index == FUNC_ATAN || function_index == FUNC_ARCTAN)    ? ret = atan(number)    :
+          (function_index == FUNC_POW10)                                    ? ret = pow(10.0, number) : -(EINVAL);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       RPNCalculator_functionArity
+  @package  RPN_calculator
+
+  @brief    Returns the number of arguments a function takes.
+
+  @param    token    [in]:   String representing the function.
+
+  @return   Arity on success, between 1 and MAX_FUNCTION_ARITY.
+            -ENOMEM if token is NULL.
+            -EINVAL if the function is not recognized.
+ =========================================================================== **/
+int RPNCalculator_functionArity(const char* token) 
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    /*< Security Checks >*/
+    if(token == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    ret = RPNCalculator_whichFunction(token);
+    if (ret >= FUNCTION_SUCCESS)
+    {
+        ret = (int)functions_arity[ret];
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       RPNCalculator_applyFunctionArgs
+  @package  RPN_calculator
+
+  @brief    Applies a mathematical function to its arguments.
+
+  @details  Extends RPNCalculator_applyFunction to functions of any arity.
+            The arguments are given in call order, so "atan2(y, x)" receives
+            y first.
+
+  @param    function    [in]:  String representing the function.
+  @param    arguments   [in]:  As many operands as the function takes.
+
+  @return   The result of the function as a double.
+            -EINVAL if the function is invalid.
+ =========================================================================== **/
+double RPNCalculator_applyFunctionArgs(const char* function, const double* arguments) 
+{
+    /*< Variable Declarations >*/
+    double ret          = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    int function_index  = 0;
+
+    /*< Security Checks >*/
+    if((function == NULL) || (arguments == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    function_index = RPNCalculator_whichFunction(function);
+
+    /*< Start Function Algorithm >*/
+    ret = (function_index == FUNC_ATAN2)    ? atan2(arguments[0], arguments[1])                 :
+          (function_index == FUNC_HYPOT)    ? hypot(arguments[0], arguments[1])                 :
+          (function_index == FUNC_MIN)      ? fmin(arguments[0], arguments[1])                  :
+          (function_index == FUNC_MAX)      ? fmax(arguments[0], arguments[1])                  :
+          (function_index == FUNC_FMA)      ? fma(arguments[0], arguments[1], arguments[2])     :
+                                              RPNCalculator_applyFunction(function, arguments[0]);
 
     /*< Function Output >*/
 end_of_function:
@@ -984,8 +1270,10 @@ double RPNCalculator_evaluatePostfix(char output[][MAX_TOKEN_LEN], int number)
     double operand_a        = 0.0;
     double operand_b        = 0.0;
     double result_value     = 0.0;
+    double arguments[MAX_FUNCTION_ARITY];
 
     int status              = FUNCTION_SUCCESS;
+    int arity               = 0;
 
     stack_val_t val_stack   = {0u};
 
@@ -1051,7 +1339,7 @@ double RPNCalculator_evaluatePostfix(char output[][MAX_TOKEN_LEN], int number)
             else
             {
                 /*< Token is a binary operator >*/
-                if (val_stack.top < 1u)
+                if (val_stack.top < 1)
                 {
                     ret = -(EINVAL);
                     goto end_of_function;
@@ -1080,15 +1368,20 @@ double RPNCalculator_evaluatePostfix(char output[][MAX_TOKEN_LEN], int number)
         /*< Token is a function >*/
         if (RPNCalculator_whichFunction(token) >= FUNCTION_SUCCESS)
         {
-            if (Stack_isEmptyVal(&val_stack) == STACK_EMPTY)
+            arity = RPNCalculator_functionArity(token);
+            if (val_stack.top < (arity - 1))
             {
                 ret = -(EINVAL);
                 goto end_of_function;
             }
 
-            operand_a = Stack_popVal(&val_stack);
+            /*< The last argument is on top of the stack >*/
+            while (arity > 0)
+            {
+                arguments[--arity] = Stack_popVal(&val_stack);
+            }
 
-            result_value = RPNCalculator_applyFunction(token, operand_a);
+            result_value = RPNCalculator_applyFunctionArgs(token, arguments);
             if (result_value == -(EINVAL))
             {
                 ret = -(EINVAL);
@@ -1110,7 +1403,7 @@ double RPNCalculator_evaluatePostfix(char output[][MAX_TOKEN_LEN], int number)
     }
 
     /*< Checks if there is exactly one value on the stack >*/
-    if (val_stack.top != 0u)
+    if (val_stack.top != 0)
     {
         ret = -(EINVAL);
         goto end_of_function;
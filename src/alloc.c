@@ -0,0 +1,870 @@
+/** ===========================================================================
+    @ingroup    Alloc
+    @addtogroup Alloc_Module alloc
+
+    @package    alloc
+    @brief      This module routes every allocation of the library through
+                replaceable allocator hooks.
+
+    @file       alloc.c
+    @headerfile alloc.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    Every block starts with an alloc_header_t placed right
+                before the pointer handed out. It records the allocator,
+                the size, the alignment and the distance back to what the
+                allocator returned, so blocks can be resized and released
+                without asking the caller for any of them.
+
+                An arena is a list of chunks taken from the allocator that
+                was current when the arena was created. Allocation bumps a
+                cursor through the current chunk and moves on to the next
+                chunk, or appends one, when it runs out. Resetting or
+                rewinding only moves the cursor back, so the chunks are
+                reused rather than returned.
+
+                The scratch arena of a thread is cached in a thread-local
+                pointer and also registered under a pthread key, whose
+                destructor returns its chunks when the thread exits.
+
+    @see        - Alloc_malloc
+                - Alloc_free
+                - Alloc_arenaCreate
+                - Alloc_scratch
+ =========================================================================== **/
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <errno.h>
+#include <pthread.h>
+
+/*< Implements >*/
+#include <alloc.h>
+
+/* ==================================== *\
+ *            PRIVATE DEFINES           *
+\* ==================================== */
+
+/** ====================================
+  @def      FUNCTION_SUCCESS
+  @package  alloc
+  @brief    Indicates successful function
+            execution.
+
+  @details  Represents a successful
+            operation, typically with
+            a value of 0.
+ ==================================== **/
+#define FUNCTION_SUCCESS        (int)(0)
+
+/** ====================================
+  @def      ALIGN_UP
+  @package  alloc
+  @brief    Rounds a size up to a power
+            of two.
+ ==================================== **/
+#define ALIGN_UP(value, alignment)  (((value) + ((alignment) - 1u)) & ~((alignment) - 1u))
+
+/* ==================================== *\
+ *       PRIVATE TYPES DEFINITION       *
+\* ==================================== */
+
+/** ============================================================================
+  @struct   alloc_header_t
+  @package  alloc
+
+  @typedef  alloc_header_t
+
+  @brief    Represents the bookkeeping in front of every block.
+ =========================================================================== **/
+typedef struct
+{
+    const alloc_t*  owner;          /*< Allocator that made the block >*/
+    size_t          size;           /*< Bytes requested >*/
+    size_t          alignment;      /*< Alignment requested >*/
+    size_t          offset;         /*< Distance from what owner returned >*/
+} alloc_header_t;
+
+/** ============================================================================
+  @struct   alloc_chunk_t
+  @package  alloc
+
+  @typedef  alloc_chunk_t
+
+  @brief    Represents a chunk of an arena; its bytes follow it.
+ =========================================================================== **/
+typedef struct alloc_chunk
+{
+    struct alloc_chunk* next;       /*< Next chunk >*/
+    size_t              size;       /*< Bytes after the chunk header >*/
+} alloc_chunk_t;
+
+/** ============================================================================
+  @struct   alloc_arena
+  @package  alloc
+
+  @brief    Represents a bump-pointer arena.
+ =========================================================================== **/
+struct alloc_arena
+{
+    alloc_t             allocator;  /*< Hooks of the arena, context is the arena >*/
+    const alloc_t*      parent;     /*< Allocator of the chunks >*/
+    alloc_chunk_t*      first;      /*< First chunk >*/
+    alloc_chunk_t*      current;    /*< Chunk being filled >*/
+    uintptr_t           cursor;     /*< Next free byte of current >*/
+    uintptr_t           limit;      /*< End of current >*/
+    uintptr_t           last;       /*< Most recent block, 0 if released >*/
+    size_t              chunk;      /*< Smallest chunk to request >*/
+};
+
+/* ==================================== *\
+ *  PRIVATE GLOBAL VARIABLES DEFINITION *
+\* ==================================== */
+
+static void* Alloc_systemAllocate(void* context, size_t size, size_t alignment);
+static void* Alloc_systemReallocate(void* context, void* pointer, size_t old_size, size_t size);
+static void Alloc_systemRelease(void* context, void* pointer, size_t size);
+
+/** ============================================================================
+  @var      alloc_system
+  @package  alloc
+
+  @brief    Allocator backed by malloc, realloc and free.
+ =========================================================================== **/
+static const alloc_t alloc_system =
+{
+    .allocate   = Alloc_systemAllocate,
+    .reallocate = Alloc_systemReallocate,
+    .release    = Alloc_systemRelease,
+    .context    = NULL
+};
+
+/** ============================================================================
+  @var      alloc_global
+  @package  alloc
+
+  @brief    Allocator of threads that have none of their own.
+ =========================================================================== **/
+static _Atomic(const alloc_t*) alloc_global = &alloc_system;
+
+/** ============================================================================
+  @var      alloc_thread
+  @package  alloc
+
+  @brief    Allocator of the calling thread, NULL to use `alloc_global`.
+ =========================================================================== **/
+static _Thread_local const alloc_t* alloc_thread;
+
+/** ============================================================================
+  @var      alloc_scratch
+  @package  alloc
+
+  @brief    Scratch arena of the calling thread, NULL until first used.
+ =========================================================================== **/
+static _Thread_local alloc_arena_t* alloc_scratch;
+
+/** ============================================================================
+  @var      alloc_scratch_key
+  @package  alloc
+
+  @brief    Key whose destructor releases the scratch arena of a thread.
+ =========================================================================== **/
+static pthread_key_t alloc_scratch_key;
+
+/** ============================================================================
+  @var      alloc_scratch_once
+  @package  alloc
+
+  @brief    Guards the creation of `alloc_scratch_key`.
+ =========================================================================== **/
+static pthread_once_t alloc_scratch_once = PTHREAD_ONCE_INIT;
+
+/* ==================================== *\
+ *     PRIVATE FUNCTIONS DEFINITION     *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Alloc_systemAllocate
+  @package  alloc
+
+  @brief    Allocates from the C library.
+ =========================================================================== **/
+static void* Alloc_systemAllocate(void* context, size_t size, size_t alignment)
+{
+    (void)context;
+
+    return (alignment <= ALLOC_ALIGNMENT) ? malloc(size) : aligned_alloc(alignment, ALIGN_UP(size, alignment));
+}
+
+/** ============================================================================
+  @fn       Alloc_systemReallocate
+  @package  alloc
+
+  @brief    Resizes a block of the C library.
+ =========================================================================== **/
+static void* Alloc_systemReallocate(void* context, void* pointer, size_t old_size, size_t size)
+{
+    (void)context;
+    (void)old_size;
+
+    return realloc(pointer, size);
+}
+
+/** ============================================================================
+  @fn       Alloc_systemRelease
+  @package  alloc
+
+  @brief    Returns a block to the C library.
+ =========================================================================== **/
+static void Alloc_systemRelease(void* context, void* pointer, size_t size)
+{
+    (void)context;
+    (void)size;
+
+    free(pointer);
+}
+
+/** ============================================================================
+  @fn       Alloc_header
+  @package  alloc
+
+  @brief    Returns the header of a block.
+ =========================================================================== **/
+static alloc_header_t* Alloc_header(void* pointer)
+{
+    return (alloc_header_t*)((char*)pointer - sizeof(alloc_header_t));
+}
+
+/** ============================================================================
+  @fn       Alloc_place
+  @package  alloc
+
+  @brief    Allocates a block with its header from a given allocator.
+
+  @param    owner       [in]:   Allocator to use.
+  @param    size        [in]:   Bytes requested.
+  @param    alignment   [in]:   Power of two, at least ALLOC_ALIGNMENT.
+
+  @return   The block, or NULL if the size overflows or the allocator fails.
+ =========================================================================== **/
+static void* Alloc_place(const alloc_t* owner, size_t size, size_t alignment)
+{
+    /*< The header fits in the padding of stricter alignments >*/
+    size_t offset       = (alignment > sizeof(alloc_header_t)) ? alignment : sizeof(alloc_header_t);
+    char* raw           = NULL;
+    alloc_header_t* header = NULL;
+
+    if (size > (SIZE_MAX - offset))
+    {
+        return NULL;
+    }
+
+    raw = owner->allocate(owner->context, offset + size, alignment);
+    if (raw == NULL)
+    {
+        return NULL;
+    }
+
+    header              = Alloc_header(raw + offset);
+    header->owner       = owner;
+    header->size        = size;
+    header->alignment   = alignment;
+    header->offset      = offset;
+
+    return raw + offset;
+}
+
+/** ============================================================================
+  @fn       Alloc_arenaNext
+  @package  alloc
+
+  @brief    Moves an arena to a chunk that can hold a request.
+
+  @details  Chunks kept by a reset are tried first; a chunk too small for
+            the request is skipped, not freed. A new chunk is linked right
+            after the current one.
+
+  @param    arena   [in/out]:   Arena to grow.
+  @param    need    [in]:       Bytes the chunk must hold, padding included.
+
+  @return   0 on success.
+            -ENOMEM if the parent allocator fails.
+ =========================================================================== **/
+static int Alloc_arenaNext(alloc_arena_t* arena, size_t need)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    alloc_chunk_t* chunk    = (arena->current != NULL) ? arena->current->next : arena->first;
+    size_t size             = 0u;
+
+    /*< Start Function Algorithm >*/
+    while ((chunk != NULL) && (chunk->size < need))
+    {
+        chunk = chunk->next;
+    }
+
+    if (chunk == NULL)
+    {
+        size = (need > arena->chunk) ? need : arena->chunk;
+        if (size > (SIZE_MAX - sizeof(alloc_chunk_t)))
+        {
+            ret = -(ENOMEM);
+            goto end_of_function;
+        }
+
+        chunk = arena->parent->allocate(arena->parent->context, sizeof(alloc_chunk_t) + size, ALLOC_ALIGNMENT);
+        if (chunk == NULL)
+        {
+            ret = -(ENOMEM);
+            goto end_of_function;
+        }
+
+        chunk->size = size;
+        if (arena->current != NULL)
+        {
+            chunk->next             = arena->current->next;
+            arena->current->next    = chunk;
+        }
+        else
+        {
+            chunk->next     = arena->first;
+            arena->first    = chunk;
+        }
+    }
+
+    arena->current  = chunk;
+    arena->cursor   = (uintptr_t)(chunk + 1);
+    arena->limit    = arena->cursor + chunk->size;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Alloc_arenaAllocate
+  @package  alloc
+
+  @brief    Bumps the cursor of an arena.
+ =========================================================================== **/
+static void* Alloc_arenaAllocate(void* context, size_t size, size_t alignment)
+{
+    alloc_arena_t* arena    = context;
+    uintptr_t start         = ALIGN_UP(arena->cursor, (uintptr_t)alignment);
+
+    if ((arena->current == NULL) || (start > arena->limit) || (size > (arena->limit - start)))
+    {
+        if ((size > (SIZE_MAX - alignment)) || (Alloc_arenaNext(arena, size + alignment) != FUNCTION_SUCCESS))
+        {
+            return NULL;
+        }
+
+        start = ALIGN_UP(arena->cursor, (uintptr_t)alignment);
+    }
+
+    arena->cursor   = start + size;
+    arena->last     = start;
+
+    return (void*)start;
+}
+
+/** ============================================================================
+  @fn       Alloc_arenaReallocate
+  @package  alloc
+
+  @brief    Grows the most recent block of an arena in place, or moves a
+            block to a new one.
+ =========================================================================== **/
+static void* Alloc_arenaReallocate(void* context, void* pointer, size_t old_size, size_t size)
+{
+    alloc_arena_t* arena    = context;
+    void* moved             = NULL;
+
+    if (((uintptr_t)pointer == arena->last) && (size <= (arena->limit - arena->last)))
+    {
+        arena->cursor = arena->last + size;
+        return pointer;
+    }
+
+    moved = Alloc_arenaAllocate(context, size, ALLOC_ALIGNMENT);
+    if (moved != NULL)
+    {
+        memcpy(moved, pointer, (old_size < size) ? old_size : size);
+    }
+
+    return moved;
+}
+
+/** ============================================================================
+  @fn       Alloc_arenaRelease
+  @package  alloc
+
+  @brief    Rolls the cursor back over the most recent block; other blocks
+            wait for the next reset.
+ =========================================================================== **/
+static void Alloc_arenaRelease(void* context, void* pointer, size_t size)
+{
+    alloc_arena_t* arena = context;
+
+    (void)size;
+
+    if ((uintptr_t)pointer == arena->last)
+    {
+        arena->cursor   = arena->last;
+        arena->last     = 0u;
+    }
+}
+
+/** ============================================================================
+  @fn       Alloc_scratchRelease
+  @package  alloc
+
+  @brief    Destroys the scratch arena of an exiting thread.
+ =========================================================================== **/
+static void Alloc_scratchRelease(void* arena)
+{
+    Alloc_arenaDestroy(arena);
+}
+
+/** ============================================================================
+  @fn       Alloc_scratchKey
+  @package  alloc
+
+  @brief    Creates the key of the scratch arenas; runs once.
+ =========================================================================== **/
+static void Alloc_scratchKey(void)
+{
+    (void)pthread_key_create(&alloc_scratch_key, Alloc_scratchRelease);
+}
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS DEFINITION      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Alloc_setGlobal
+  @package  alloc
+
+  @brief    Selects the allocator of threads that have none of their own.
+
+  @param    allocator   [in]:   Allocator to use, NULL for the C library.
+
+  @return   0 on success.
+            -EINVAL if allocate or release is missing.
+ =========================================================================== **/
+int Alloc_setGlobal(const alloc_t* allocator)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    /*< Security Checks >*/
+    if ((allocator != NULL) && ((allocator->allocate == NULL) || (allocator->release == NULL)))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    atomic_store(&alloc_global, (allocator != NULL) ? allocator : &alloc_system);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Alloc_setThread
+  @package  alloc
+
+  @brief    Selects the allocator of the calling thread.
+
+  @param    allocator   [in]:   Allocator to use, NULL for the global one.
+
+  @return   The previous allocator of the thread, NULL if it had none, so
+            that the caller can restore it.
+ =========================================================================== **/
+const alloc_t* Alloc_setThread(const alloc_t* allocator)
+{
+    const alloc_t* previous = alloc_thread;
+
+    alloc_thread = allocator;
+
+    return previous;
+}
+
+/** ============================================================================
+  @fn       Alloc_current
+  @package  alloc
+
+  @brief    Returns the allocator the calling thread allocates from.
+ =========================================================================== **/
+const alloc_t* Alloc_current(void)
+{
+    return (alloc_thread != NULL) ? alloc_thread : atomic_load_explicit(&alloc_global, memory_order_acquire);
+}
+
+/** ============================================================================
+  @fn       Alloc_malloc
+  @package  alloc
+
+  @brief    Allocates a block of ALLOC_ALIGNMENT like malloc.
+
+  @param    size    [in]:   Number of bytes.
+
+  @return   The block, or NULL if the allocator fails.
+ =========================================================================== **/
+void* Alloc_malloc(size_t size)
+{
+    return Alloc_place(Alloc_current(), size, ALLOC_ALIGNMENT);
+}
+
+/** ============================================================================
+  @fn       Alloc_calloc
+  @package  alloc
+
+  @brief    Allocates a zeroed array like calloc.
+
+  @param    count   [in]:   Number of elements.
+  @param    size    [in]:   Size of an element.
+
+  @return   The block, or NULL if the size overflows or the allocator
+            fails.
+ =========================================================================== **/
+void* Alloc_calloc(size_t count, size_t size)
+{
+    void* block = NULL;
+
+    if ((size != 0u) && (count > (SIZE_MAX / size)))
+    {
+        return NULL;
+    }
+
+    block = Alloc_malloc(count * size);
+    if (block != NULL)
+    {
+        memset(block, 0, count * size);
+    }
+
+    return block;
+}
+
+/** ============================================================================
+  @fn       Alloc_realloc
+  @package  alloc
+
+  @brief    Resizes a block like realloc, with the allocator that made it.
+
+  @param    pointer [in]:   Block from any Alloc_ function, or NULL.
+  @param    size    [in]:   New number of bytes.
+
+  @return   The block, or NULL if the allocator fails; the old block is
+            then left untouched.
+ =========================================================================== **/
+void* Alloc_realloc(void* pointer, size_t size)
+{
+    alloc_header_t* header  = NULL;
+    alloc_header_t saved    = { 0 };
+    char* raw               = NULL;
+    void* moved             = NULL;
+
+    if (pointer == NULL)
+    {
+        return Alloc_malloc(size);
+    }
+
+    header  = Alloc_header(pointer);
+    saved   = *header;
+
+    if ((saved.owner->reallocate != NULL) && (saved.alignment == ALLOC_ALIGNMENT))
+    {
+        if (size > (SIZE_MAX - saved.offset))
+        {
+            return NULL;
+        }
+
+        raw = saved.owner->reallocate(saved.owner->context, (char*)pointer - saved.offset, saved.offset + saved.size, saved.offset + size);
+        if (raw == NULL)
+        {
+            return NULL;
+        }
+
+        Alloc_header(raw + saved.offset)->size = size;
+        return raw + saved.offset;
+    }
+
+    moved = Alloc_place(saved.owner, size, saved.alignment);
+    if (moved != NULL)
+    {
+        memcpy(moved, pointer, (saved.size < size) ? saved.size : size);
+        Alloc_free(pointer);
+    }
+
+    return moved;
+}
+
+/** ============================================================================
+  @fn       Alloc_aligned
+  @package  alloc
+
+  @brief    Allocates a block with a stricter alignment.
+
+  @param    alignment   [in]:   Power of two.
+  @param    size        [in]:   Number of bytes.
+
+  @return   The block, or NULL if the alignment is invalid or the allocator
+            fails.
+ =========================================================================== **/
+void* Alloc_aligned(size_t alignment, size_t size)
+{
+    if ((alignment == 0u) || ((alignment & (alignment - 1u)) != 0u))
+    {
+        return NULL;
+    }
+
+    return Alloc_place(Alloc_current(), size, (alignment > ALLOC_ALIGNMENT) ? alignment : ALLOC_ALIGNMENT);
+}
+
+/** ============================================================================
+  @fn       Alloc_free
+  @package  alloc
+
+  @brief    Returns a block to the allocator that made it.
+
+  @param    pointer [in]:   Block from any Alloc_ function, or NULL.
+ =========================================================================== **/
+void Alloc_free(void* pointer)
+{
+    alloc_header_t* header = NULL;
+
+    if (pointer == NULL)
+    {
+        return;
+    }
+
+    header = Alloc_header(pointer);
+    header->owner->release(header->owner->context, (char*)pointer - header->offset, header->offset + header->size);
+}
+
+/** ============================================================================
+  @fn       Alloc_arenaCreate
+  @package  alloc
+
+  @brief    Creates a bump-pointer arena.
+
+  @param    chunk   [in]:   Bytes requested from the current allocator at
+                            a time; 0 uses ALLOC_ARENA_CHUNK.
+  @param    arena   [out]:  Receives the new arena.
+
+  @return   0 on success.
+            -ENOMEM if arena is NULL or an allocation fails.
+ =========================================================================== **/
+int Alloc_arenaCreate(size_t chunk, alloc_arena_t** arena)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    alloc_arena_t* created  = NULL;
+
+    /*< Security Checks >*/
+    if (arena == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    created = Alloc_calloc(1u, sizeof(alloc_arena_t));
+    if (created == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    created->allocator.allocate     = Alloc_arenaAllocate;
+    created->allocator.reallocate   = Alloc_arenaReallocate;
+    created->allocator.release      = Alloc_arenaRelease;
+    created->allocator.context      = created;
+    created->parent                 = Alloc_current();
+    created->chunk                  = (chunk != 0u) ? chunk : ALLOC_ARENA_CHUNK;
+
+    *arena = created;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Alloc_arenaAllocator
+  @package  alloc
+
+  @brief    Returns the allocator that allocates from an arena.
+
+  @param    arena   [in]:   Arena to allocate from.
+
+  @return   The allocator, valid until the arena is destroyed.
+ =========================================================================== **/
+const alloc_t* Alloc_arenaAllocator(alloc_arena_t* arena)
+{
+    return (arena != NULL) ? &arena->allocator : NULL;
+}
+
+/** ============================================================================
+  @fn       Alloc_arenaMalloc
+  @package  alloc
+
+  @brief    Allocates straight from an arena, without a block header.
+
+  @param    arena   [in]:   Arena to allocate from.
+  @param    size    [in]:   Number of bytes, aligned to ALLOC_ALIGNMENT.
+
+  @return   The block, or NULL if arena is NULL or the allocator fails.
+ =========================================================================== **/
+void* Alloc_arenaMalloc(alloc_arena_t* arena, size_t size)
+{
+    return (arena != NULL) ? Alloc_arenaAllocate(arena, size, ALLOC_ALIGNMENT) : NULL;
+}
+
+/** ============================================================================
+  @fn       Alloc_arenaMark
+  @package  alloc
+
+  @brief    Returns the current position of an arena.
+
+  @param    arena   [in]:   Arena to query.
+
+  @return   A mark for Alloc_arenaRewind.
+ =========================================================================== **/
+alloc_mark_t Alloc_arenaMark(const alloc_arena_t* arena)
+{
+    alloc_mark_t mark = { NULL, 0u };
+
+    if (arena != NULL)
+    {
+        mark.chunk  = arena->current;
+        mark.cursor = arena->cursor;
+    }
+
+    return mark;
+}
+
+/** ============================================================================
+  @fn       Alloc_arenaRewind
+  @package  alloc
+
+  @brief    Releases every block allocated from an arena since a mark.
+
+  @details  The chunks filled after the mark stay linked behind it and are
+            reused by the next allocations.
+
+  @param    arena   [in]:   Arena to rewind. NULL is ignored.
+  @param    mark    [in]:   Mark from Alloc_arenaMark on the same arena.
+ =========================================================================== **/
+void Alloc_arenaRewind(alloc_arena_t* arena, alloc_mark_t mark)
+{
+    alloc_chunk_t* chunk = mark.chunk;
+
+    if (arena == NULL)
+    {
+        return;
+    }
+
+    arena->current  = chunk;
+    arena->cursor   = mark.cursor;
+    arena->limit    = (chunk != NULL) ? ((uintptr_t)(chunk + 1) + chunk->size) : 0u;
+    arena->last     = 0u;
+}
+
+/** ============================================================================
+  @fn       Alloc_arenaReset
+  @package  alloc
+
+  @brief    Releases every block of an arena at once, keeping its chunks for
+            reuse.
+
+  @param    arena   [in]:   Arena to reset. NULL is ignored.
+ =========================================================================== **/
+void Alloc_arenaReset(alloc_arena_t* arena)
+{
+    if ((arena == NULL) || (arena->first == NULL))
+    {
+        return;
+    }
+
+    arena->current  = arena->first;
+    arena->cursor   = (uintptr_t)(arena->first + 1);
+    arena->limit    = arena->cursor + arena->first->size;
+    arena->last     = 0u;
+}
+
+/** ============================================================================
+  @fn       Alloc_arenaDestroy
+  @package  alloc
+
+  @brief    Returns the chunks of an arena and releases it.
+
+  @param    arena   [in]:   Arena to release. NULL is ignored.
+ =========================================================================== **/
+void Alloc_arenaDestroy(alloc_arena_t* arena)
+{
+    alloc_chunk_t* chunk    = NULL;
+    alloc_chunk_t* next     = NULL;
+
+    if (arena == NULL)
+    {
+        return;
+    }
+
+    for (chunk = arena->first; chunk != NULL; chunk = next)
+    {
+        next = chunk->next;
+        arena->parent->release(arena->parent->context, chunk, sizeof(alloc_chunk_t) + chunk->size);
+    }
+
+    Alloc_free(arena);
+}
+
+/** ============================================================================
+  @fn       Alloc_scratch
+  @package  alloc
+
+  @brief    Returns the scratch arena of the calling thread.
+
+  @details  The chunks come from the global allocator even when the thread
+            has one of its own, since the arena outlives any selection the
+            thread makes.
+
+  @return   The arena, or NULL if it cannot be created.
+ =========================================================================== **/
+alloc_arena_t* Alloc_scratch(void)
+{
+    const alloc_t* previous = NULL;
+    alloc_arena_t* created  = NULL;
+
+    if (alloc_scratch == NULL)
+    {
+        (void)pthread_once(&alloc_scratch_once, Alloc_scratchKey);
+
+        previous = Alloc_setThread(NULL);
+        if (Alloc_arenaCreate(0u, &created) == FUNCTION_SUCCESS)
+        {
+            (void)pthread_setspecific(alloc_scratch_key, created);
+            alloc_scratch = created;
+        }
+        (void)Alloc_setThread(previous);
+    }
+
+    return alloc_scratch;
+}
+
+/*< end of file >*/
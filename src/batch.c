@@ -0,0 +1,1089 @@
+/** ===========================================================================
+    @ingroup    Batch
+    @addtogroup Batch_Module batch
+
+    @package    batch
+    @brief      This module evaluates files of expressions, one expression
+                per line, in process or across isolated worker processes.
+
+    @file       batch.c
+    @headerfile batch.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    The input file is mapped read-only and indexed by line. Each
+                line is evaluated through RPNCalculator_tokenize,
+                RPNCalculator_infixToPostfix and
+                RPNCalculator_evaluatePostfix, and its value and status are
+                stored at the row's own index of a column-oriented output.
+
+                In sharded mode the rows are split into one shard per worker
+                process. Children inherit the read-only input mapping and
+                write straight into an output region mapped with MAP_SHARED,
+                so nothing is copied back. A shard whose process crashes or
+                exits abnormally is re-run from the last row it completed;
+                the other shards are left untouched. A row that brings its
+                shard down twice is marked as failed and skipped.
+
+                In checkpointed mode the rows are processed in fixed-size
+                chunks and appended to the output file, either as text with
+                one result per line or as `columnar` blocks of raw doubles
+                and status bits, one block per chunk. Progress is persisted with the `checkpoint` module
+                every few chunks, so an interrupted run restarts after the
+                last checkpointed chunk instead of from the first row.
+
+    @note       - Statuses are 0 on success or a negative errno value, as
+                  everywhere else in the library.
+                - Row order in the output always matches the input.
+                - A checkpointed run must be resumed with the format it was
+                  started with.
+
+    @see        - Batch_mapInput
+                - Batch_createOutput
+                - Batch_evaluateRange
+                - Batch_evaluateSharded
+                - Batch_evaluateCheckpointed
+ =========================================================================== **/
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <limits.h>
+#include <errno.h>
+#include <signal.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+/*< Implements >*/
+#include <alloc.h>
+#include <RPNCalculator.h>
+#include <checkpoint.h>
+#include <columnar.h>
+#include <format.h>
+#include <batch.h>
+
+/* ==================================== *\
+ *            PRIVATE DEFINES           *
+\* ==================================== */
+
+/** ====================================
+  @def      FUNCTION_SUCCESS
+  @package  batch
+  @brief    Indicates successful function
+            execution.
+
+  @details  Represents a successful
+            operation, typically with
+            a value of 0.
+ ==================================== **/
+#define FUNCTION_SUCCESS        (int)(0)
+
+/** ====================================
+  @def      NO_CRASH
+  @package  batch
+  @brief    Marks a shard that has not
+            failed at its current row.
+ ==================================== **/
+#define NO_CRASH                (size_t)(SIZE_MAX)
+
+/* ==================================== *\
+ *       PRIVATE TYPES DEFINITION       *
+\* ==================================== */
+
+/** ============================================================================
+  @struct   batch_shard_t
+  @package  batch
+
+  @typedef  batch_shard_t
+
+  @brief    Represents the progress of one shard.
+
+  @details  `next_row` lives in memory shared with the worker process, which
+            advances it after storing each result; the parent only reads it
+            once the worker has been reaped.
+ =========================================================================== **/
+typedef struct
+{
+    volatile size_t next_row;   /*< First row not completed yet >*/
+    size_t          last;       /*< Row after the last row of the shard >*/
+    size_t          crash_row;  /*< Row at which the previous attempt died >*/
+    pid_t           worker;     /*< Running worker, 0 when idle >*/
+} batch_shard_t;
+
+/* ==================================== *\
+ *     PRIVATE FUNCTIONS DEFINITION     *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Batch_lineLength
+  @package  batch
+
+  @brief    Returns the length of a row without its line terminator.
+
+  @param    input   [in]:   Mapped input.
+  @param    row     [in]:   Row index.
+
+  @return   Length of the row, "\n" and "\r\n" excluded.
+ =========================================================================== **/
+static size_t Batch_lineLength(const batch_input_t* input, size_t row)
+{
+    size_t length = input->offsets[row + 1u] - input->offsets[row];
+
+    if ((length > 0u) && (input->data[input->offsets[row] + length - 1u] == '\n'))
+    {
+        length--;
+    }
+
+    if ((length > 0u) && (input->data[input->offsets[row] + length - 1u] == '\r'))
+    {
+        length--;
+    }
+
+    return length;
+}
+
+/** ============================================================================
+  @fn       Batch_runShard
+  @package  batch
+
+  @brief    Body of a worker process.
+
+  @details  Evaluates the remaining rows of a shard, publishing its progress
+            after each row so a crash can be resumed from the right place.
+
+  @param    input   [in]:       Mapped input.
+  @param    shard   [in/out]:   Shard to complete, in shared memory.
+  @param    output  [in/out]:   Shared result columns.
+ =========================================================================== **/
+static void Batch_runShard(const batch_input_t* input, batch_shard_t* shard, batch_output_t* output)
+{
+    size_t row = 0u;
+
+    for (row = shard->next_row; row < shard->last; row++)
+    {
+        output->status[row] = Batch_evaluateLine(&input->data[input->offsets[row]],
+                                                 Batch_lineLength(input, row),
+                                                 &output->values[row]);
+        shard->next_row = row + 1u;
+    }
+}
+
+/** ============================================================================
+  @fn       Batch_stopShards
+  @package  batch
+
+  @brief    Kills and reaps every shard worker still running.
+
+  @details  Used when the workers can no longer be waited for one by one,
+            so none of them keeps writing into the shared output after the
+            call returns. Interrupted waits are retried.
+
+  @param    shards      [in/out]:   Shard table.
+  @param    shard_count [in]:       Number of shards.
+ =========================================================================== **/
+static void Batch_stopShards(batch_shard_t* shards, size_t shard_count)
+{
+    size_t iterator = 0u;
+    pid_t pid       = 0;
+
+    for (iterator = 0u; iterator < shard_count; iterator++)
+    {
+        if (shards[iterator].worker == 0)
+        {
+            continue;
+        }
+
+        (void)kill(shards[iterator].worker, SIGKILL);
+
+        do
+        {
+            pid = waitpid(shards[iterator].worker, NULL, 0);
+        } while ((pid < 0) && (errno == EINTR));
+
+        shards[iterator].worker = 0;
+    }
+}
+
+/** ============================================================================
+  @fn       Batch_waitShard
+  @package  batch
+
+  @brief    Reaps one of the shard workers.
+
+  @details  Only the stored worker pids are waited for, so children started
+            by the host application keep their exit status. Finished workers
+            are collected without blocking first; if none has finished, the
+            call blocks on the first running one. Interrupted waits are
+            retried.
+
+  @param    shards      [in]:   Shard table.
+  @param    shard_count [in]:   Number of shards.
+  @param    index       [out]:  Receives the shard of the reaped worker.
+  @param    wait_status [out]:  Receives its status from waitpid.
+
+  @return   Pid of the reaped worker.
+            -1 if waitpid fails, with errno set.
+ =========================================================================== **/
+static pid_t Batch_waitShard(const batch_shard_t* shards, size_t shard_count, size_t* index, int* wait_status)
+{
+    size_t iterator = 0u;
+    size_t first    = shard_count;
+    pid_t pid       = 0;
+
+    for (iterator = 0u; iterator < shard_count; iterator++)
+    {
+        if (shards[iterator].worker == 0)
+        {
+            continue;
+        }
+
+        first = (first == shard_count) ? iterator : first;
+
+        do
+        {
+            pid = waitpid(shards[iterator].worker, wait_status, WNOHANG);
+        } while ((pid < 0) && (errno == EINTR));
+
+        if (pid != 0)
+        {
+            *index = iterator;
+            return pid;
+        }
+    }
+
+    if (first == shard_count)
+    {
+        errno = ECHILD;
+        return -1;
+    }
+
+    do
+    {
+        pid = waitpid(shards[first].worker, wait_status, 0);
+    } while ((pid < 0) && (errno == EINTR));
+
+    *index = first;
+    return pid;
+}
+
+/** ============================================================================
+  @fn       Batch_writeAll
+  @package  batch
+
+  @brief    Writes a whole buffer, retrying on short writes.
+
+  @param    descriptor  [in]:   File descriptor.
+  @param    buffer      [in]:   Bytes to write.
+  @param    length      [in]:   Number of bytes.
+
+  @return   0 on success.
+            -EIO if the write fails.
+ =========================================================================== **/
+static int Batch_writeAll(int descriptor, const char* buffer, size_t length)
+{
+    ssize_t written = 0;
+
+    while (length > 0u)
+    {
+        written = write(descriptor, buffer, length);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return -(EIO);
+        }
+
+        buffer += written;
+        length -= (size_t)written;
+    }
+
+    return FUNCTION_SUCCESS;
+}
+
+/** ============================================================================
+  @fn       Batch_formatValue
+  @package  batch
+
+  @brief    Formats one result line of the text output.
+
+  @param    buffer  [out]:  Receives at most MAX_VALUE_TEXT characters.
+  @param    value   [in]:   Value of the row.
+  @param    status  [in]:   Status of the row.
+
+  @return   Number of characters written, newline included.
+ =========================================================================== **/
+static size_t Batch_formatValue(char* buffer, double value, int status)
+{
+    int length = 0;
+
+    if (status != FUNCTION_SUCCESS)
+    {
+        memcpy(buffer, "nan\n", 4u);
+        return 4u;
+    }
+
+    length = Format_double(value, buffer);
+    buffer[length++] = '\n';
+
+    return (size_t)length;
+}
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS DEFINITION      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Batch_mapInput
+  @package  batch
+
+  @brief    Maps a file of expressions and indexes its lines.
+
+  @param    path    [in]:   Path of the input file.
+  @param    input   [out]:  Receives the mapping and the line index.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -ENOENT if the file cannot be opened or mapped.
+ =========================================================================== **/
+int Batch_mapInput(const char* path, batch_input_t* input)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    int descriptor          = -1;
+    struct stat info        = {0};
+
+    const char* cursor      = NULL;
+    const char* end         = NULL;
+    const char* newline     = NULL;
+
+    size_t rows             = 0u;
+
+    /*< Security Checks >*/
+    if ((path == NULL) || (input == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    memset(input, 0, sizeof(batch_input_t));
+
+    descriptor = open(path, O_RDONLY);
+    if ((descriptor < 0) || (fstat(descriptor, &info) != 0))
+    {
+        ret = -(ENOENT);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    if (info.st_size > 0)
+    {
+        input->data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (input->data == MAP_FAILED)
+        {
+            input->data = NULL;
+            ret = -(ENOENT);
+            goto end_of_function;
+        }
+
+        input->size = (size_t)info.st_size;
+        (void)madvise((void*)input->data, input->size, MADV_SEQUENTIAL);
+    }
+
+    /*< First pass counts the rows, second pass records their offsets >*/
+    end = input->data + input->size;
+
+    for (cursor = input->data; cursor < end; cursor = newline + 1)
+    {
+        newline = memchr(cursor, '\n', (size_t)(end - cursor));
+        newline = (newline == NULL) ? (end - 1) : newline;
+        rows++;
+    }
+
+    input->offsets = Alloc_malloc((rows + 1u) * sizeof(size_t));
+    if (input->offsets == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    rows = 0u;
+
+    for (cursor = input->data; cursor < end; cursor = newline + 1)
+    {
+        input->offsets[rows++] = (size_t)(cursor - input->data);
+
+        newline = memchr(cursor, '\n', (size_t)(end - cursor));
+        newline = (newline == NULL) ? (end - 1) : newline;
+    }
+
+    input->offsets[rows] = input->size;
+    input->rows = rows;
+
+    /*< Function Output >*/
+end_of_function:
+    if (descriptor >= 0)
+    {
+        close(descriptor);
+    }
+    if ((ret != FUNCTION_SUCCESS) && (input != NULL))
+    {
+        Batch_unmapInput(input);
+    }
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Batch_unmapInput
+  @package  batch
+
+  @brief    Releases an input mapped by Batch_mapInput.
+
+  @param    input   [in/out]:   Input to release.
+ =========================================================================== **/
+void Batch_unmapInput(batch_input_t* input)
+{
+    if (input == NULL)
+    {
+        return;
+    }
+
+    if (input->data != NULL)
+    {
+        munmap((void*)input->data, input->size);
+    }
+
+    Alloc_free(input->offsets);
+    memset(input, 0, sizeof(batch_input_t));
+}
+
+/** ============================================================================
+  @fn       Batch_createOutput
+  @package  batch
+
+  @brief    Allocates the result columns of a batch.
+
+  @details  The columns live in one anonymous MAP_SHARED mapping, so worker
+            processes forked afterwards write into the caller's memory.
+
+  @param    output  [out]:  Receives the result columns.
+  @param    rows    [in]:   Number of rows.
+
+  @return   0 on success.
+            -ENOMEM if output is NULL or the mapping fails.
+ =========================================================================== **/
+int Batch_createOutput(batch_output_t* output, size_t rows)
+{
+    /*< Variable Declarations >*/
+    int ret     = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t size = 0u;
+
+    /*< Security Checks >*/
+    if (output == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    size = (rows * sizeof(double)) + (rows * sizeof(int));
+    size = (size == 0u) ? sizeof(double) : size;
+
+    output->region = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (output->region == MAP_FAILED)
+    {
+        memset(output, 0, sizeof(batch_output_t));
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    output->region_size = size;
+    output->rows        = rows;
+    output->values      = (double*)output->region;
+    output->status      = (int*)(output->values + rows);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Batch_destroyOutput
+  @package  batch
+
+  @brief    Releases result columns allocated by Batch_createOutput.
+
+  @param    output  [in/out]:   Output to release.
+ =========================================================================== **/
+void Batch_destroyOutput(batch_output_t* output)
+{
+    if ((output != NULL) && (output->region != NULL))
+    {
+        munmap(output->region, output->region_size);
+        memset(output, 0, sizeof(batch_output_t));
+    }
+}
+
+/** ============================================================================
+  @fn       Batch_evaluateLine
+  @package  batch
+
+  @brief    Evaluates one expression that is not NUL-terminated.
+
+  @param    line    [in]:   Start of the expression.
+  @param    length  [in]:   Length of the expression, terminator excluded.
+  @param    value   [out]:  Receives the value of the expression.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -EINVAL if the expression is empty, too long or invalid.
+ =========================================================================== **/
+int Batch_evaluateLine(const char* line, size_t length, double* value)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    int token_count     = 0;
+    int postfix_count   = 0;
+
+    char expression[MAX_EXPRESSION_SIZE];
+    char tokens[MAX_NUM_TOKENS][MAX_TOKEN_LEN];
+    char postfix[MAX_NUM_TOKENS][MAX_TOKEN_LEN];
+
+    /*< Security Checks >*/
+    if ((line == NULL) || (value == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if (length >= MAX_EXPRESSION_SIZE)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    memcpy(expression, line, length);
+    expression[length] = '\0';
+
+    *value = NAN;
+
+    /*< Start Function Algorithm >*/
+    token_count = RPNCalculator_tokenize(expression, tokens);
+    if (token_count <= 0)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    postfix_count = RPNCalculator_infixToPostfix(tokens, postfix, token_count);
+    if (postfix_count <= 0)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    *value = RPNCalculator_evaluatePostfix(postfix, postfix_count);
+    if (*value == -(EINVAL))
+    {
+        *value  = NAN;
+        ret     = -(EINVAL);
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Batch_evaluateRange
+  @package  batch
+
+  @brief    Evaluates rows [first, last) in the calling process.
+
+  @param    input   [in]:       Mapped input.
+  @param    first   [in]:       First row to evaluate.
+  @param    last    [in]:       Row after the last one to evaluate.
+  @param    output  [in/out]:   Result columns, at least input->rows long.
+
+  @return   Number of failed rows on success, saturated at INT_MAX.
+            -ENOMEM if an argument is NULL.
+            -EINVAL if the range is outside the input.
+ =========================================================================== **/
+int Batch_evaluateRange(const batch_input_t* input, size_t first, size_t last, batch_output_t* output)
+{
+    /*< Variable Declarations >*/
+    int ret         = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t row      = 0u;
+
+    /*< Security Checks >*/
+    if ((input == NULL) || (output == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if ((first > last) || (last > input->rows) || (output->rows < input->rows))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    for (row = first; row < last; row++)
+    {
+        output->status[row] = Batch_evaluateLine(&input->data[input->offsets[row]],
+                                                 Batch_lineLength(input, row),
+                                                 &output->values[row]);
+        ret += ((output->status[row] != FUNCTION_SUCCESS) && (ret < INT_MAX)) ? 1 : 0;
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Batch_evaluateSharded
+  @package  batch
+
+  @brief    Evaluates every row across isolated worker processes.
+
+  @details  Forks one process per shard and reaps them as they finish,
+            waiting only for their own pids. A shard that did not exit
+            cleanly is forked again from the first row it had not completed;
+            if it dies twice on the same row, that row is marked -EFAULT and
+            skipped. Shards that succeeded are never re-run. If the workers
+            cannot be waited for, the remaining ones are killed and reaped
+            before returning.
+
+  @param    input   [in]:       Mapped input.
+  @param    output  [in/out]:   Result columns from Batch_createOutput.
+  @param    workers [in]:       Number of worker processes, 1 to
+                                MAX_BATCH_WORKERS.
+
+  @return   Number of failed rows on success, saturated at INT_MAX.
+            -ENOMEM if an argument is NULL or the shard state cannot be
+            mapped.
+            -EINVAL if workers is out of range or output is too small.
+            -EAGAIN if no worker process can be forked.
+            -ECHILD if the workers cannot be waited for.
+ =========================================================================== **/
+int Batch_evaluateSharded(const batch_input_t* input, batch_output_t* output, size_t workers)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t shard_count      = 0u;
+    size_t iterator         = 0u;
+    size_t running          = 0u;
+    size_t row              = 0u;
+
+    int wait_status         = 0;
+    pid_t pid               = 0;
+
+    batch_shard_t* shards   = NULL;
+    batch_shard_t* shard    = NULL;
+
+    /*< Security Checks >*/
+    if ((input == NULL) || (output == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if ((workers == 0u) || (workers > MAX_BATCH_WORKERS) || (output->rows < input->rows))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    if (input->rows == 0u)
+    {
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    shard_count = (workers < input->rows) ? workers : input->rows;
+
+    shards = mmap(NULL, shard_count * sizeof(batch_shard_t), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (shards == MAP_FAILED)
+    {
+        shards = NULL;
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    for (iterator = 0u; iterator < shard_count; iterator++)
+    {
+        shards[iterator].next_row   = (input->rows * iterator) / shard_count;
+        shards[iterator].last       = (input->rows * (iterator + 1u)) / shard_count;
+        shards[iterator].crash_row  = NO_CRASH;
+        shards[iterator].worker     = 0;
+    }
+
+    fflush(NULL);
+
+    /*< Start Function Algorithm >*/
+    for (;;)
+    {
+        /*< Start every unfinished shard that has no worker >*/
+        for (iterator = 0u; iterator < shard_count; iterator++)
+        {
+            shard = &shards[iterator];
+
+            if ((shard->worker != 0) || (shard->next_row >= shard->last))
+            {
+                continue;
+            }
+
+            pid = fork();
+            if (pid == 0)
+            {
+                Batch_runShard(input, shard, output);
+                _exit(EXIT_SUCCESS);
+            }
+
+            if (pid > 0)
+            {
+                shard->worker = pid;
+                running++;
+            }
+        }
+
+        if (running == 0u)
+        {
+            break;
+        }
+
+        pid = Batch_waitShard(shards, shard_count, &iterator, &wait_status);
+        if (pid < 0)
+        {
+            /*< e.g. ECHILD when the host ignores SIGCHLD: stop the rest before unmapping >*/
+            Batch_stopShards(shards, shard_count);
+            ret = -(ECHILD);
+            goto end_of_function;
+        }
+
+        shard           = &shards[iterator];
+        shard->worker   = 0;
+        running--;
+
+        if ((WIFEXITED(wait_status)) && (WEXITSTATUS(wait_status) == EXIT_SUCCESS))
+        {
+            continue;
+        }
+
+        /*< The worker died: skip the row only if it failed there twice >*/
+        row = shard->next_row;
+
+        if ((row < shard->last) && (row == shard->crash_row))
+        {
+            output->values[row] = NAN;
+            output->status[row] = -(EFAULT);
+            shard->next_row     = row + 1u;
+            shard->crash_row    = NO_CRASH;
+        }
+        else
+        {
+            shard->crash_row    = row;
+        }
+    }
+
+    /*< A shard left unfinished means fork kept failing >*/
+    for (iterator = 0u; iterator < shard_count; iterator++)
+    {
+        if (shards[iterator].next_row < shards[iterator].last)
+        {
+            ret = -(EAGAIN);
+            goto end_of_function;
+        }
+    }
+
+    for (row = 0u; row < input->rows; row++)
+    {
+        ret += ((output->status[row] != FUNCTION_SUCCESS) && (ret < INT_MAX)) ? 1 : 0;
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    if (shards != NULL)
+    {
+        munmap(shards, shard_count * sizeof(batch_shard_t));
+    }
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Batch_evaluateCheckpointed
+  @package  batch
+
+  @brief    Evaluates a file chunk by chunk with periodic checkpoints.
+
+  @details  Starts a new run when the checkpoint file does not exist, or
+            resumes the run it describes: the output is truncated to the last
+            durable offset, completed chunks are skipped and new results are
+            appended. Chunks are always completed in input order, so the set
+            of completed chunks of a valid checkpoint is a prefix. Each chunk
+            is evaluated into a value and a status column, which are then
+            either formatted as text or handed to Columnar_writeBlock as they
+            are. The output is flushed to disk before every checkpoint is
+            written.
+
+  @param    input_path      [in]:   File of expressions, one per line.
+  @param    output_path     [in]:   Output file.
+  @param    checkpoint_path [in]:   Checkpoint file.
+  @param    chunk_rows      [in]:   Rows per chunk, at least 1.
+  @param    interval        [in]:   Chunks between checkpoints, at least 1.
+  @param    format          [in]:   Layout of the output file.
+
+  @return   Number of failed rows of the whole run on success, saturated
+            at INT_MAX.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -ENOENT if the input cannot be mapped.
+            -EINVAL if a parameter is 0 or out of range, or the checkpoint
+            belongs to a different run (input, chunk_rows or format), or
+            the output is shorter than the checkpoint records.
+            -EIO if the output or the checkpoint cannot be written.
+ =========================================================================== **/
+int Batch_evaluateCheckpointed(const char* input_path, const char* output_path, const char* checkpoint_path, size_t chunk_rows, size_t interval, batch_format_t format)
+{
+    /*< Variable Declarations >*/
+    int ret                     = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    int descriptor              = -1;
+    int resumed_gap             = 0;
+    long written                = 0;
+
+    uint64_t chunk              = 0u;
+    size_t row                  = 0u;
+    size_t first                = 0u;
+    size_t last                 = 0u;
+    size_t length               = 0u;
+    size_t since_checkpoint     = 0u;
+
+    double* values              = NULL;
+    int* status                 = NULL;
+    char* text                  = NULL;
+
+    batch_input_t input         = {0};
+    checkpoint_t checkpoint     = {0};
+    struct stat output_stat;
+
+    /*< Security Checks >*/
+    if ((input_path == NULL) || (output_path == NULL) || (checkpoint_path == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if ((chunk_rows == 0u) || (interval == 0u) || (chunk_rows > UINT32_MAX) || (format >= BATCH_FORMAT_COUNT))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    ret = Batch_mapInput(input_path, &input);
+    if (ret != FUNCTION_SUCCESS)
+    {
+        goto end_of_function;
+    }
+
+    ret = Checkpoint_load(checkpoint_path, &checkpoint);
+    if (ret == -(ENOENT))
+    {
+        ret = Checkpoint_init(&checkpoint, input.size, input.rows, chunk_rows);
+        checkpoint.format = (uint64_t)format;
+    }
+    else if (
+                (ret == FUNCTION_SUCCESS)
+                            &&
+                (
+                    (checkpoint.input_size != input.size)
+                                ||
+                    (checkpoint.total_rows != input.rows)
+                                ||
+                    (checkpoint.chunk_rows != chunk_rows)
+                                ||
+                    (checkpoint.format != (uint64_t)format)
+                )
+            )
+    {
+        ret = -(EINVAL);
+    }
+
+    if (ret != FUNCTION_SUCCESS)
+    {
+        goto end_of_function;
+    }
+
+    for (chunk = 0u; chunk < checkpoint.chunk_count; chunk++)
+    {
+        if (!Checkpoint_isChunkDone(&checkpoint, chunk))
+        {
+            resumed_gap = 1;
+        }
+        else if (resumed_gap)
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+    }
+
+    values  = Alloc_malloc(chunk_rows * sizeof(double));
+    status  = Alloc_malloc(chunk_rows * sizeof(int));
+    text    = (format == BATCH_FORMAT_TEXT) ? Alloc_malloc(chunk_rows * MAX_VALUE_TEXT) : NULL;
+
+    if ((values == NULL) || (status == NULL) || ((format == BATCH_FORMAT_TEXT) && (text == NULL)))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Drop whatever was appended after the last checkpoint >*/
+    descriptor = open(output_path, O_WRONLY | O_CREAT, 0644);
+    if ((descriptor < 0) || (fstat(descriptor, &output_stat) != 0))
+    {
+        ret = -(EIO);
+        goto end_of_function;
+    }
+
+    /*< A shorter file was truncated or replaced: padding it would fake results >*/
+    if ((uint64_t)output_stat.st_size < checkpoint.output_offset)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    if (
+            (ftruncate(descriptor, (off_t)checkpoint.output_offset) != 0)
+                    ||
+            (lseek(descriptor, 0, SEEK_END) < 0)
+        )
+    {
+        ret = -(EIO);
+        goto end_of_function;
+    }
+
+    if ((format == BATCH_FORMAT_COLUMNAR) && (checkpoint.output_offset == 0u))
+    {
+        written = Columnar_writeHeader(descriptor);
+        if (written < 0)
+        {
+            ret = (int)written;
+            goto end_of_function;
+        }
+
+        checkpoint.output_offset += (uint64_t)written;
+    }
+
+    /*< Start Function Algorithm >*/
+    for (chunk = 0u; chunk < checkpoint.chunk_count; chunk++)
+    {
+        if (Checkpoint_isChunkDone(&checkpoint, chunk))
+        {
+            continue;
+        }
+
+        first   = (size_t)chunk * chunk_rows;
+        last    = ((first + chunk_rows) < input.rows) ? (first + chunk_rows) : input.rows;
+        length  = 0u;
+
+        for (row = first; row < last; row++)
+        {
+            status[row - first] = Batch_evaluateLine(&input.data[input.offsets[row]],
+                                                     Batch_lineLength(&input, row),
+                                                     &values[row - first]);
+
+            checkpoint.failed_rows += (status[row - first] != FUNCTION_SUCCESS) ? 1u : 0u;
+        }
+
+        if (format == BATCH_FORMAT_COLUMNAR)
+        {
+            written = Columnar_writeBlock(descriptor, values, status, last - first);
+            if (written < 0)
+            {
+                ret = (int)written;
+                goto end_of_function;
+            }
+
+            length = (size_t)written;
+        }
+        else
+        {
+            for (row = first; row < last; row++)
+            {
+                length += Batch_formatValue(&text[length], values[row - first], status[row - first]);
+            }
+
+            ret = Batch_writeAll(descriptor, text, length);
+            if (ret != FUNCTION_SUCCESS)
+            {
+                goto end_of_function;
+            }
+        }
+
+        checkpoint.output_offset    += length;
+        checkpoint.rows_done        += (last - first);
+        Checkpoint_markChunkDone(&checkpoint, chunk);
+
+        if (++since_checkpoint >= interval)
+        {
+            if (fdatasync(descriptor) != 0)
+            {
+                ret = -(EIO);
+                goto end_of_function;
+            }
+
+            ret = Checkpoint_save(checkpoint_path, &checkpoint);
+            if (ret != FUNCTION_SUCCESS)
+            {
+                goto end_of_function;
+            }
+
+            since_checkpoint = 0u;
+        }
+    }
+
+    if ((fdatasync(descriptor) != 0) || (Checkpoint_save(checkpoint_path, &checkpoint) != FUNCTION_SUCCESS))
+    {
+        ret = -(EIO);
+        goto end_of_function;
+    }
+
+    ret = (checkpoint.failed_rows > (uint64_t)INT_MAX) ? INT_MAX : (int)checkpoint.failed_rows;
+
+    /*< Function Output >*/
+end_of_function:
+    if (descriptor >= 0)
+    {
+        close(descriptor);
+    }
+    Alloc_free(values);
+    Alloc_free(status);
+    Alloc_free(text);
+    Checkpoint_release(&checkpoint);
+    Batch_unmapInput(&input);
+    return ret;
+}
+
+/*< end of file >*/
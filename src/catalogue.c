@@ -0,0 +1,859 @@
+/** ===========================================================================
+    @ingroup    Catalogue
+    @addtogroup Catalogue_Module catalogue
+
+    @package    catalogue
+    @brief      This module provides a hot-reloadable catalogue of named,
+                compiled formulas.
+
+    @file       catalogue.c
+    @headerfile catalogue.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    A catalogue maps formula names to compiled programs. Each
+                reload compiles a complete new version from a text file and
+                publishes it with a single atomic pointer swap; the previous
+                version is released after an epoch grace period (see the
+                `epoch` module). Reader threads keep evaluating throughout a
+                reload without locks and without pausing: they see either the
+                old or the new version, never a mix of both.
+
+    @note       - A reload is all or nothing. If any line fails to compile,
+                  the current version stays in place and an error is
+                  returned.
+                - Every reader thread registers once with
+                  Catalogue_registerReader and passes the returned slot to
+                  Catalogue_evaluate or Catalogue_evaluateWith.
+
+    @see        - Catalogue_create
+                - Catalogue_reload
+                - Catalogue_reloadAsync
+                - Catalogue_waitReload
+                - Catalogue_evaluate
+                - Catalogue_evaluateWith
+ =========================================================================== **/
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <limits.h>
+#include <errno.h>
+
+/*< Implements >*/
+#include <alloc.h>
+#include <RPNCalculator.h>
+#include <program.h>
+#include <epoch.h>
+#include <catalogue.h>
+
+/* ==================================== *\
+ *            PRIVATE DEFINES           *
+\* ==================================== */
+
+/** ====================================
+  @def      FUNCTION_SUCCESS
+  @package  catalogue
+  @brief    Indicates successful function
+            execution.
+
+  @details  Represents a successful
+            operation, typically with
+            a value of 0.
+ ==================================== **/
+#define FUNCTION_SUCCESS        (int)(0)
+
+/** ====================================
+  @def      MIN_CAPACITY
+  @package  catalogue
+  @brief    Smallest number of hash
+            slots of a version.
+
+  @details  Capacities are powers of
+            two and kept at most half
+            full.
+ ==================================== **/
+#define MIN_CAPACITY            (size_t)(8U)
+
+/** ====================================
+  @def      MAX_LINE_SIZE
+  @package  catalogue
+  @brief    Longest accepted line of a
+            catalogue file.
+
+  @details  A name, the '=' separator
+            and an expression of up to
+            MAX_EXPRESSION_SIZE chars.
+ ==================================== **/
+#define MAX_LINE_SIZE           (size_t)(MAX_EXPRESSION_SIZE + MAX_TOKEN_LEN + 8U)
+
+/** ====================================
+  @def      FNV_OFFSET_BASIS
+  @package  catalogue
+  @brief    64-bit FNV-1a offset basis.
+ ==================================== **/
+#define FNV_OFFSET_BASIS        (uint64_t)(0xcbf29ce484222325ULL)
+
+/** ====================================
+  @def      FNV_PRIME
+  @package  catalogue
+  @brief    64-bit FNV-1a prime.
+ ==================================== **/
+#define FNV_PRIME               (uint64_t)(0x100000001b3ULL)
+
+/* ==================================== *\
+ *       PRIVATE TYPES DEFINITION       *
+\* ==================================== */
+
+/** ============================================================================
+  @struct   catalogue_entry_t
+  @package  catalogue
+
+  @typedef  catalogue_entry_t
+
+  @brief    Represents one named formula of a version.
+
+  @details  An entry with an empty name is a free hash slot.
+ =========================================================================== **/
+typedef struct
+{
+    char            name[MAX_TOKEN_LEN];    /*< Formula name >*/
+    rpn_program_t*  program;                /*< Compiled formula >*/
+} catalogue_entry_t;
+
+/** ============================================================================
+  @struct   catalogue_version_t
+  @package  catalogue
+
+  @typedef  catalogue_version_t
+
+  @brief    Represents one immutable generation of the catalogue.
+
+  @details  Open addressing hash table with linear probing. A version is never
+            modified once published.
+ =========================================================================== **/
+typedef struct
+{
+    size_t              capacity;   /*< Number of slots, a power of two >*/
+    size_t              count;      /*< Number of formulas >*/
+    catalogue_entry_t   entries[];  /*< Hash slots >*/
+} catalogue_version_t;
+
+/** ============================================================================
+  @struct   catalogue
+  @package  catalogue
+
+  @brief    Represents a formula catalogue.
+ =========================================================================== **/
+struct catalogue
+{
+    _Atomic(catalogue_version_t*)   current;                /*< Published version >*/
+    epoch_domain_t*                 epoch;                  /*< Reader tracking >*/
+    pthread_mutex_t                 writer_lock;            /*< Serializes reloads >*/
+    pthread_t                       reload_thread;          /*< Background reload >*/
+    atomic_int                      reload_pending;         /*< Non-zero while a background reload runs >*/
+    int                             reload_status;          /*< Result of the background reload >*/
+    char                            reload_path[PATH_MAX];  /*< File of the background reload >*/
+};
+
+/* ==================================== *\
+ *     PRIVATE FUNCTIONS DEFINITION     *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Catalogue_hash
+  @package  catalogue
+
+  @brief    Hashes a formula name with 64-bit FNV-1a.
+
+  @param    name    [in]:   NUL-terminated name.
+
+  @return   Hash of the name.
+ =========================================================================== **/
+static uint64_t Catalogue_hash(const char* name)
+{
+    uint64_t hash = FNV_OFFSET_BASIS;
+
+    while (*name != '\0')
+    {
+        hash = (hash ^ (uint8_t)(*name++)) * FNV_PRIME;
+    }
+
+    return hash;
+}
+
+/** ============================================================================
+  @fn       Catalogue_freeVersion
+  @package  catalogue
+
+  @brief    Releases a version and its programs.
+
+  @param    version [in]:   Version to release. NULL is ignored.
+ =========================================================================== **/
+static void Catalogue_freeVersion(catalogue_version_t* version)
+{
+    size_t iterator = 0u;
+
+    if (version == NULL)
+    {
+        return;
+    }
+
+    for (iterator = 0u; iterator < version->capacity; iterator++)
+    {
+        Program_destroy(version->entries[iterator].program);
+    }
+
+    Alloc_free(version);
+}
+
+/** ============================================================================
+  @fn       Catalogue_insert
+  @package  catalogue
+
+  @brief    Inserts a compiled formula into an unpublished version.
+
+  @param    version [in/out]:   Version being built.
+  @param    name    [in]:       Formula name.
+  @param    program [in]:       Compiled formula, owned by the version on
+                                success.
+
+  @return   0 on success.
+            -EINVAL if the name is already present.
+ =========================================================================== **/
+static int Catalogue_insert(catalogue_version_t* version, const char* name, rpn_program_t* program)
+{
+    /*< Variable Declarations >*/
+    int ret         = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t mask     = version->capacity - 1u;
+    size_t slot     = (size_t)Catalogue_hash(name) & mask;
+
+    /*< Start Function Algorithm >*/
+    while (version->entries[slot].name[0] != '\0')
+    {
+        if (strcmp(version->entries[slot].name, name) == 0)
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+
+        slot = (slot + 1u) & mask;
+    }
+
+    strcpy(version->entries[slot].name, name);
+    version->entries[slot].program = program;
+    version->count++;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Catalogue_lookup
+  @package  catalogue
+
+  @brief    Finds a formula in a version.
+
+  @param    version [in]:   Version to search.
+  @param    name    [in]:   Formula name.
+
+  @return   The compiled formula, or NULL if the name is absent.
+ =========================================================================== **/
+static const rpn_program_t* Catalogue_lookup(const catalogue_version_t* version, const char* name)
+{
+    size_t mask = version->capacity - 1u;
+    size_t slot = (size_t)Catalogue_hash(name) & mask;
+
+    while (version->entries[slot].name[0] != '\0')
+    {
+        if (strcmp(version->entries[slot].name, name) == 0)
+        {
+            return version->entries[slot].program;
+        }
+
+        slot = (slot + 1u) & mask;
+    }
+
+    return NULL;
+}
+
+/** ============================================================================
+  @fn       Catalogue_parseLine
+  @package  catalogue
+
+  @brief    Splits a catalogue line into name and expression.
+
+  @details  Strips comments, surrounding blanks and the line terminator in
+            place. Blank and comment-only lines yield an empty name.
+
+  @param    line        [in/out]:   Line read from the file.
+  @param    name        [out]:      Receives the formula name.
+  @param    expression  [out]:      Receives a pointer into line.
+
+  @return   0 on success.
+            -EINVAL if the line is malformed.
+ =========================================================================== **/
+static int Catalogue_parseLine(char* line, char name[MAX_TOKEN_LEN], char** expression)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t length       = 0u;
+    char* cursor        = line;
+    char* comment       = NULL;
+
+    /*< Assign Initial Values >*/
+    name[0] = '\0';
+
+    comment = strchr(line, '#');
+    if (comment != NULL)
+    {
+        *comment = '\0';
+    }
+
+    /*< Start Function Algorithm >*/
+    while (isspace((unsigned char)*cursor))
+    {
+        cursor++;
+    }
+
+    if (*cursor == '\0')
+    {
+        goto end_of_function;
+    }
+
+    while ((isalnum((unsigned char)cursor[length])) || (cursor[length] == '_'))
+    {
+        if (length >= (MAX_TOKEN_LEN - 1u))
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+
+        name[length] = cursor[length];
+        length++;
+    }
+
+    name[length] = '\0';
+    cursor += length;
+
+    while (isspace((unsigned char)*cursor))
+    {
+        cursor++;
+    }
+
+    if ((length == 0u) || (*cursor != '='))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    cursor++;
+
+    length = strlen(cursor);
+    while ((length > 0u) && (isspace((unsigned char)cursor[length - 1u])))
+    {
+        cursor[--length] = '\0';
+    }
+
+    *expression = cursor;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Catalogue_build
+  @package  catalogue
+
+  @brief    Compiles a catalogue file into a new, unpublished version.
+
+  @param    path    [in]:   Path of the catalogue file.
+  @param    version [out]:  Receives the new version.
+
+  @return   0 on success, or the error codes of Catalogue_reload.
+ =========================================================================== **/
+static int Catalogue_build(const char* path, catalogue_version_t** version)
+{
+    /*< Variable Declarations >*/
+    int ret                         = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    FILE* file                      = NULL;
+
+    size_t lines                    = 0u;
+    size_t capacity                 = MIN_CAPACITY;
+
+    char line[MAX_LINE_SIZE];
+    char name[MAX_TOKEN_LEN];
+    char* expression                = NULL;
+
+    rpn_program_t* program          = NULL;
+    catalogue_version_t* created    = NULL;
+
+    /*< Assign Initial Values >*/
+    file = fopen(path, "r");
+    if (file == NULL)
+    {
+        ret = -(ENOENT);
+        goto end_of_function;
+    }
+
+    /*< Size the table for every non-empty line >*/
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        lines++;
+    }
+
+    while (capacity < (lines * 2u))
+    {
+        capacity <<= 1u;
+    }
+
+    created = Alloc_calloc(1u, sizeof(catalogue_version_t) + (capacity * sizeof(catalogue_entry_t)));
+    if (created == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    created->capacity = capacity;
+
+    /*< Start Function Algorithm >*/
+    rewind(file);
+
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        if ((strchr(line, '\n') == NULL) && (!feof(file)))
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+
+        ret = Catalogue_parseLine(line, name, &expression);
+        if (ret != FUNCTION_SUCCESS)
+        {
+            goto end_of_function;
+        }
+
+        if (name[0] == '\0')
+        {
+            continue;
+        }
+
+        ret = Program_compile(expression, &program);
+        if (ret != FUNCTION_SUCCESS)
+        {
+            goto end_of_function;
+        }
+
+        ret = Catalogue_insert(created, name, program);
+        if (ret != FUNCTION_SUCCESS)
+        {
+            Program_destroy(program);
+            goto end_of_function;
+        }
+    }
+
+    *version = created;
+    created  = NULL;
+
+    /*< Function Output >*/
+end_of_function:
+    if (file != NULL)
+    {
+        fclose(file);
+    }
+    Catalogue_freeVersion(created);
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Catalogue_reloadThread
+  @package  catalogue
+
+  @brief    Entry point of the background reload thread.
+
+  @param    argument    [in]:   The catalogue being reloaded.
+
+  @return   NULL.
+ =========================================================================== **/
+static void* Catalogue_reloadThread(void* argument)
+{
+    catalogue_t* catalogue = argument;
+
+    catalogue->reload_status = Catalogue_reload(catalogue, catalogue->reload_path);
+
+    return NULL;
+}
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS DEFINITION      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Catalogue_create
+  @package  catalogue
+
+  @brief    Creates an empty catalogue.
+
+  @param    catalogue   [out]:  Receives the new catalogue.
+
+  @return   0 on success.
+            -ENOMEM if catalogue is NULL or an allocation fails.
+ =========================================================================== **/
+int Catalogue_create(catalogue_t** catalogue)
+{
+    /*< Variable Declarations >*/
+    int ret                         = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    catalogue_t* created            = NULL;
+    catalogue_version_t* empty      = NULL;
+
+    /*< Security Checks >*/
+    if (catalogue == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    created = Alloc_calloc(1u, sizeof(catalogue_t));
+    empty   = Alloc_calloc(1u, sizeof(catalogue_version_t) + (MIN_CAPACITY * sizeof(catalogue_entry_t)));
+
+    if ((created == NULL) || (empty == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    ret = Epoch_create(&created->epoch);
+    if (ret != FUNCTION_SUCCESS)
+    {
+        goto end_of_function;
+    }
+
+    empty->capacity = MIN_CAPACITY;
+    atomic_init(&created->current, empty);
+    atomic_init(&created->reload_pending, 0);
+    pthread_mutex_init(&created->writer_lock, NULL);
+
+    *catalogue  = created;
+    created     = NULL;
+    empty       = NULL;
+
+    /*< Function Output >*/
+end_of_function:
+    Alloc_free(created);
+    Alloc_free(empty);
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Catalogue_destroy
+  @package  catalogue
+
+  @brief    Releases a catalogue and every program it holds.
+
+  @details  Waits for a pending asynchronous reload. No reader may use the
+            catalogue once this function has been called.
+
+  @param    catalogue   [in]:   Catalogue to release. NULL is ignored.
+ =========================================================================== **/
+void Catalogue_destroy(catalogue_t* catalogue)
+{
+    if (catalogue == NULL)
+    {
+        return;
+    }
+
+    (void)Catalogue_waitReload(catalogue);
+
+    Catalogue_freeVersion(atomic_load(&catalogue->current));
+    Epoch_destroy(catalogue->epoch);
+    pthread_mutex_destroy(&catalogue->writer_lock);
+    Alloc_free(catalogue);
+}
+
+/** ============================================================================
+  @fn       Catalogue_reload
+  @package  catalogue
+
+  @brief    Compiles a catalogue file and publishes it.
+
+  @details  Compiles every formula of the file into a new version without
+            holding any lock, swaps it in atomically and frees the previous
+            version after a grace period. Readers are never blocked;
+            concurrent reloads are serialized around the swap.
+
+  @param    catalogue   [in]:   Catalogue to update.
+  @param    path        [in]:   Path of the catalogue file.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -ENOENT if the file cannot be opened.
+            -EINVAL if a line is malformed, a name is duplicated or a
+            formula does not compile.
+ =========================================================================== **/
+int Catalogue_reload(catalogue_t* catalogue, const char* path)
+{
+    /*< Variable Declarations >*/
+    int ret                         = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    catalogue_version_t* fresh      = NULL;
+    catalogue_version_t* previous   = NULL;
+
+    /*< Security Checks >*/
+    if ((catalogue == NULL) || (path == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    ret = Catalogue_build(path, &fresh);
+    if (ret != FUNCTION_SUCCESS)
+    {
+        goto end_of_function;
+    }
+
+    pthread_mutex_lock(&catalogue->writer_lock);
+
+    previous = atomic_exchange(&catalogue->current, fresh);
+    (void)Epoch_synchronize(catalogue->epoch);
+
+    pthread_mutex_unlock(&catalogue->writer_lock);
+
+    Catalogue_freeVersion(previous);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Catalogue_reloadAsync
+  @package  catalogue
+
+  @brief    Starts Catalogue_reload on a background thread.
+
+  @param    catalogue   [in]:   Catalogue to update.
+  @param    path        [in]:   Path of the catalogue file.
+
+  @return   0 if the background reload was started.
+            -ENOMEM if an argument is NULL.
+            -EBUSY if a background reload is still pending.
+            -EAGAIN if the thread cannot be created.
+ =========================================================================== **/
+int Catalogue_reloadAsync(catalogue_t* catalogue, const char* path)
+{
+    /*< Variable Declarations >*/
+    int ret     = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    int idle    = 0;
+
+    /*< Security Checks >*/
+    if ((catalogue == NULL) || (path == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if (strlen(path) >= sizeof(catalogue->reload_path))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Claim the reload slot, so concurrent callers cannot both start one >*/
+    if (!atomic_compare_exchange_strong(&catalogue->reload_pending, &idle, 1))
+    {
+        ret = -(EBUSY);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    strcpy(catalogue->reload_path, path);
+    catalogue->reload_status = FUNCTION_SUCCESS;
+
+    if (pthread_create(&catalogue->reload_thread, NULL, Catalogue_reloadThread, catalogue) != 0)
+    {
+        atomic_store(&catalogue->reload_pending, 0);
+        ret = -(EAGAIN);
+        goto end_of_function;
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Catalogue_waitReload
+  @package  catalogue
+
+  @brief    Waits for the pending background reload.
+
+  @details  At most one thread may wait for a given reload.
+
+  @param    catalogue   [in]:   Catalogue being updated.
+
+  @return   Status of the background Catalogue_reload, or 0 if none was
+            pending.
+            -ENOMEM if catalogue is NULL.
+ =========================================================================== **/
+int Catalogue_waitReload(catalogue_t* catalogue)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    /*< Security Checks >*/
+    if (catalogue == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if (!atomic_load(&catalogue->reload_pending))
+    {
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    pthread_join(catalogue->reload_thread, NULL);
+
+    ret = catalogue->reload_status;
+    atomic_store(&catalogue->reload_pending, 0);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Catalogue_registerReader
+  @package  catalogue
+
+  @brief    Registers the calling thread as a reader.
+
+  @param    catalogue   [in]:   Catalogue to read from.
+
+  @return   Reader slot on success.
+            -ENOMEM if catalogue is NULL.
+            -EBUSY if too many readers are registered.
+ =========================================================================== **/
+int Catalogue_registerReader(catalogue_t* catalogue)
+{
+    return (catalogue == NULL) ? -(ENOMEM) : Epoch_register(catalogue->epoch);
+}
+
+/** ============================================================================
+  @fn       Catalogue_unregisterReader
+  @package  catalogue
+
+  @brief    Releases a reader slot.
+
+  @param    catalogue   [in]:   Catalogue the slot belongs to.
+  @param    reader      [in]:   Slot returned by Catalogue_registerReader.
+ =========================================================================== **/
+void Catalogue_unregisterReader(catalogue_t* catalogue, int reader)
+{
+    if (catalogue != NULL)
+    {
+        Epoch_unregister(catalogue->epoch, reader);
+    }
+}
+
+/** ============================================================================
+  @fn       Catalogue_evaluate
+  @package  catalogue
+
+  @brief    Evaluates a named formula without variables.
+
+  @param    catalogue   [in]:   Catalogue to read from.
+  @param    reader      [in]:   Slot returned by Catalogue_registerReader.
+  @param    name        [in]:   Name of the formula.
+  @param    result      [out]:  Receives the value of the formula.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -ENOENT if the name is not in the current version.
+            -EINVAL if the evaluation fails, the formula has variables or
+            reader is not a valid slot.
+ =========================================================================== **/
+int Catalogue_evaluate(catalogue_t* catalogue, int reader, const char* name, double* result)
+{
+    return Catalogue_evaluateWith(catalogue, reader, name, NULL, result);
+}
+
+/** ============================================================================
+  @fn       Catalogue_evaluateWith
+  @package  catalogue
+
+  @brief    Evaluates a named formula of the current version with bound
+            variables.
+
+  @details  Lock-free: the lookup and the evaluation run inside an epoch
+            read-side section, so the program cannot be released meanwhile.
+
+  @param    catalogue   [in]:   Catalogue to read from.
+  @param    reader      [in]:   Slot returned by Catalogue_registerReader.
+  @param    name        [in]:   Name of the formula.
+  @param    variables   [in]:   One value per variable, in order of first use
+                                in the formula. May be NULL when the formula
+                                has no variables.
+  @param    result      [out]:  Receives the value of the formula.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -ENOENT if the name is not in the current version.
+            -EINVAL if the evaluation fails, variables are missing or
+            reader is not a valid slot.
+ =========================================================================== **/
+int Catalogue_evaluateWith(catalogue_t* catalogue, int reader, const char* name, const double* variables, double* result)
+{
+    /*< Variable Declarations >*/
+    int ret                             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    const catalogue_version_t* version  = NULL;
+    const rpn_program_t* program        = NULL;
+
+    /*< Security Checks >*/
+    if ((catalogue == NULL) || (name == NULL) || (result == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    ret = Epoch_enter(catalogue->epoch, reader);
+    if (ret != FUNCTION_SUCCESS)
+    {
+        goto end_of_function;
+    }
+
+    version = atomic_load(&catalogue->current);
+    program = Catalogue_lookup(version, name);
+
+    ret = (program == NULL) ? -(ENOENT) : Program_evaluateWith(program, variables, result);
+
+    Epoch_exit(catalogue->epoch, reader);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/*< end of file >*/
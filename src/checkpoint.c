@@ -0,0 +1,427 @@
+/** ===========================================================================
+    @ingroup    Checkpoint
+    @addtogroup Checkpoint_Module checkpoint
+
+    @package    checkpoint
+    @brief      This module persists the progress of long batch runs so they
+                can resume after being interrupted.
+
+    @file       checkpoint.c
+    @headerfile checkpoint.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    A checkpoint records the shape of the run (input size, row
+                count, rows per chunk, output format), one bit per completed chunk, the
+                number of output bytes known to be durable and row counters.
+                It is written to a temporary file, flushed and renamed over
+                the previous checkpoint, so a crash at any point leaves
+                either the old or the new checkpoint on disk.
+
+    @note       - The file uses host byte order; it is meant to be resumed
+                  on the machine that wrote it.
+                - Output bytes past `output_offset` were written after the
+                  last checkpoint and must be discarded on resume.
+
+    @see        - Checkpoint_init
+                - Checkpoint_load
+                - Checkpoint_save
+                - Checkpoint_markChunkDone
+ =========================================================================== **/
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+/*< Implements >*/
+#include <alloc.h>
+#include <checkpoint.h>
+
+/* ==================================== *\
+ *            PRIVATE DEFINES           *
+\* ==================================== */
+
+/** ====================================
+  @def      FUNCTION_SUCCESS
+  @package  checkpoint
+  @brief    Indicates successful function
+            execution.
+
+  @details  Represents a successful
+            operation, typically with
+            a value of 0.
+ ==================================== **/
+#define FUNCTION_SUCCESS        (int)(0)
+
+/** ====================================
+  @def      CHECKPOINT_MAGIC
+  @package  checkpoint
+  @brief    Identifies a checkpoint file
+            and its layout version.
+ ==================================== **/
+#define CHECKPOINT_MAGIC        "RPNCKPT2"
+
+/** ====================================
+  @def      CHECKPOINT_MAGIC_SIZE
+  @package  checkpoint
+  @brief    Length of CHECKPOINT_MAGIC
+            without terminator.
+ ==================================== **/
+#define CHECKPOINT_MAGIC_SIZE   (size_t)(8U)
+
+/** ====================================
+  @def      BITMAP_BYTES
+  @package  checkpoint
+  @brief    Size in bytes of the bitmap
+            of a number of chunks.
+ ==================================== **/
+#define BITMAP_BYTES(chunks)    (size_t)(((chunks) + 7U) / 8U)
+
+/* ==================================== *\
+ *     PRIVATE FUNCTIONS DEFINITION     *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Checkpoint_syncDirectory
+  @package  checkpoint
+
+  @brief    Flushes the directory holding a file, so a rename into it is
+            durable.
+
+  @param    path    [in]:   Path of a file in the directory.
+
+  @return   0 on success.
+            -EIO if the directory cannot be opened or flushed.
+ =========================================================================== **/
+static int Checkpoint_syncDirectory(const char* path)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    int descriptor      = -1;
+    char* separator     = NULL;
+    char directory[PATH_MAX];
+
+    /*< Assign Initial Values >*/
+    if (snprintf(directory, sizeof(directory), "%s", path) >= (int)sizeof(directory))
+    {
+        ret = -(EIO);
+        goto end_of_function;
+    }
+
+    separator = strrchr(directory, '/');
+    if (separator == NULL)
+    {
+        strcpy(directory, ".");
+    }
+    else
+    {
+        separator[(separator == directory) ? 1 : 0] = '\0';
+    }
+
+    /*< Start Function Algorithm >*/
+    descriptor = open(directory, O_RDONLY | O_DIRECTORY);
+    if ((descriptor < 0) || (fsync(descriptor) != 0))
+    {
+        ret = -(EIO);
+        goto end_of_function;
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    if (descriptor >= 0)
+    {
+        close(descriptor);
+    }
+    return ret;
+}
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS DEFINITION      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Checkpoint_init
+  @package  checkpoint
+
+  @brief    Initializes an empty checkpoint for a new run.
+
+  @param    checkpoint  [out]:  Checkpoint to initialize.
+  @param    input_size  [in]:   Size of the input file in bytes.
+  @param    total_rows  [in]:   Number of rows of the input.
+  @param    chunk_rows  [in]:   Rows per chunk, at least 1.
+
+  @return   0 on success.
+            -ENOMEM if checkpoint is NULL or the allocation fails.
+            -EINVAL if chunk_rows is 0.
+ =========================================================================== **/
+int Checkpoint_init(checkpoint_t* checkpoint, uint64_t input_size, uint64_t total_rows, uint64_t chunk_rows)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    /*< Security Checks >*/
+    if (checkpoint == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if (chunk_rows == 0u)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    memset(checkpoint, 0, sizeof(checkpoint_t));
+
+    checkpoint->input_size  = input_size;
+    checkpoint->total_rows  = total_rows;
+    checkpoint->chunk_rows  = chunk_rows;
+    checkpoint->chunk_count = (total_rows + chunk_rows - 1u) / chunk_rows;
+
+    checkpoint->done = Alloc_calloc(BITMAP_BYTES(checkpoint->chunk_count) + 1u, sizeof(uint8_t));
+    if (checkpoint->done == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Checkpoint_release
+  @package  checkpoint
+
+  @brief    Releases the chunk bitmap of a checkpoint.
+
+  @param    checkpoint  [in/out]:   Checkpoint to release.
+ =========================================================================== **/
+void Checkpoint_release(checkpoint_t* checkpoint)
+{
+    if (checkpoint != NULL)
+    {
+        Alloc_free(checkpoint->done);
+        checkpoint->done = NULL;
+    }
+}
+
+/** ============================================================================
+  @fn       Checkpoint_load
+  @package  checkpoint
+
+  @brief    Reads a checkpoint file.
+
+  @param    path        [in]:   Path of the checkpoint file.
+  @param    checkpoint  [out]:  Receives the checkpoint.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or the allocation fails.
+            -ENOENT if the file does not exist.
+            -EINVAL if the file is not a valid checkpoint.
+ =========================================================================== **/
+int Checkpoint_load(const char* path, checkpoint_t* checkpoint)
+{
+    /*< Variable Declarations >*/
+    int ret                             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    FILE* file                          = NULL;
+    char magic[CHECKPOINT_MAGIC_SIZE];
+    checkpoint_t header                 = {0};
+
+    /*< Security Checks >*/
+    if ((path == NULL) || (checkpoint == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    memset(checkpoint, 0, sizeof(checkpoint_t));
+
+    file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        ret = -(ENOENT);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    if (
+            (fread(magic, sizeof(magic), 1u, file) != 1u)
+                                ||
+            (memcmp(magic, CHECKPOINT_MAGIC, CHECKPOINT_MAGIC_SIZE) != 0)
+                                ||
+            (fread(&header, offsetof(checkpoint_t, done), 1u, file) != 1u)
+        )
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    ret = Checkpoint_init(checkpoint, header.input_size, header.total_rows, header.chunk_rows);
+    if (ret != FUNCTION_SUCCESS)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    if (
+            (header.chunk_count != checkpoint->chunk_count)
+                                ||
+            (fread(checkpoint->done, 1u, BITMAP_BYTES(header.chunk_count), file) != BITMAP_BYTES(header.chunk_count))
+        )
+    {
+        Checkpoint_release(checkpoint);
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    checkpoint->output_offset   = header.output_offset;
+    checkpoint->rows_done       = header.rows_done;
+    checkpoint->failed_rows     = header.failed_rows;
+    checkpoint->format          = header.format;
+
+    /*< Function Output >*/
+end_of_function:
+    if (file != NULL)
+    {
+        fclose(file);
+    }
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Checkpoint_save
+  @package  checkpoint
+
+  @brief    Atomically replaces a checkpoint file.
+
+  @details  Writes "<path>.tmp", flushes it to disk, renames it over path
+            and flushes the directory so the rename survives a crash. The
+            temporary file is removed when the rename does not happen.
+
+  @param    path        [in]:   Path of the checkpoint file.
+  @param    checkpoint  [in]:   Checkpoint to write.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -EIO if the file cannot be written.
+ =========================================================================== **/
+int Checkpoint_save(const char* path, const checkpoint_t* checkpoint)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    FILE* file              = NULL;
+    char temporary[PATH_MAX];
+
+    /*< Security Checks >*/
+    if ((path == NULL) || (checkpoint == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if (snprintf(temporary, sizeof(temporary), "%s.tmp", path) >= (int)sizeof(temporary))
+    {
+        ret = -(EIO);
+        goto end_of_function;
+    }
+
+    file = fopen(temporary, "wb");
+    if (file == NULL)
+    {
+        ret = -(EIO);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    if (
+            (fwrite(CHECKPOINT_MAGIC, CHECKPOINT_MAGIC_SIZE, 1u, file) != 1u)
+                                ||
+            (fwrite(checkpoint, offsetof(checkpoint_t, done), 1u, file) != 1u)
+                                ||
+            (fwrite(checkpoint->done, 1u, BITMAP_BYTES(checkpoint->chunk_count), file) != BITMAP_BYTES(checkpoint->chunk_count))
+                                ||
+            (fflush(file) != 0)
+                                ||
+            (fsync(fileno(file)) != 0)
+        )
+    {
+        ret = -(EIO);
+        goto end_of_function;
+    }
+
+    fclose(file);
+    file = NULL;
+
+    if (rename(temporary, path) != 0)
+    {
+        unlink(temporary);
+        ret = -(EIO);
+        goto end_of_function;
+    }
+
+    ret = Checkpoint_syncDirectory(path);
+
+    /*< Function Output >*/
+end_of_function:
+    if (file != NULL)
+    {
+        fclose(file);
+        remove(temporary);
+    }
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Checkpoint_isChunkDone
+  @package  checkpoint
+
+  @brief    Checks whether a chunk was completed.
+
+  @param    checkpoint  [in]:   Checkpoint to query.
+  @param    chunk       [in]:   Chunk index.
+
+  @return   Non-zero if the chunk is done, 0 otherwise.
+ =========================================================================== **/
+int Checkpoint_isChunkDone(const checkpoint_t* checkpoint, uint64_t chunk)
+{
+    return (chunk < checkpoint->chunk_count)
+                            &&
+           ((checkpoint->done[chunk / 8u] & (uint8_t)(1u << (chunk % 8u))) != 0u);
+}
+
+/** ============================================================================
+  @fn       Checkpoint_markChunkDone
+  @package  checkpoint
+
+  @brief    Marks a chunk as completed.
+
+  @param    checkpoint  [in/out]:   Checkpoint to update.
+  @param    chunk       [in]:       Chunk index.
+ =========================================================================== **/
+void Checkpoint_markChunkDone(checkpoint_t* checkpoint, uint64_t chunk)
+{
+    if (chunk < checkpoint->chunk_count)
+    {
+        checkpoint->done[chunk / 8u] |= (uint8_t)(1u << (chunk % 8u));
+    }
+}
+
+/*< end of file >*/
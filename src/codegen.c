@@ -0,0 +1,502 @@
+/** ===========================================================================
+    @ingroup    Codegen
+    @addtogroup Codegen_Module codegen
+
+    @package    codegen
+    @brief      This module generates standalone C source from compiled
+                programs (rpn2c).
+
+    @file       codegen.c
+    @headerfile codegen.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    Stack entry `d` becomes the local `sd` and local slot `k` of
+                an inlined user function becomes `lk`. Because the depth
+                before each instruction is known statically, an instruction
+                turns into one assignment between named locals. For example,
+                "x / 2" becomes
+
+                    s0 = variables[0];
+                    s1 = 2.0;
+                    if (s1 == 0.0) { return -(EINVAL); }
+                    s0 = s0 / s1;
+
+                and the block form replaces the early return with
+                `failed |= (s1 == 0.0);`.
+
+                Every check and libm call matches Program_evaluateWith, and
+                constants are written with Format_double, which round-trips
+                exactly.
+
+    @see        - Codegen_emit
+                - Codegen_emitExpression
+ =========================================================================== **/
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <errno.h>
+
+/*< Implements >*/
+#include <program.h>
+#include <format.h>
+#include <codegen.h>
+
+/* ==================================== *\
+ *            PRIVATE DEFINES           *
+\* ==================================== */
+
+/** ====================================
+  @def      FUNCTION_SUCCESS
+  @package  codegen
+  @brief    Indicates successful function
+            execution.
+
+  @details  Represents a successful
+            operation, typically with
+            a value of 0.
+ ==================================== **/
+#define FUNCTION_SUCCESS        (int)(0)
+
+/** ====================================
+  @def      CODEGEN_MAX_NAME
+  @package  codegen
+  @brief    Longest name of a generated
+            function.
+
+  @details  Leaves room for the
+            "_factorial" suffix of the
+            helper.
+ ==================================== **/
+#define CODEGEN_MAX_NAME        (size_t)(MAX_TOKEN_LEN - 11U)
+
+/* ==================================== *\
+ *  PRIVATE GLOBAL VARIABLES DEFINITION *
+\* ==================================== */
+
+/** ============================================================================
+  @var      codegen_functions
+  @package  codegen
+
+  @brief    libm routine of each OPCODE_FUNC operand.
+
+  @details  Same routines as the direct call table of program.c.
+ =========================================================================== **/
+static const char* const codegen_functions[FUNC_COUNT] =
+{
+    [FUNC_SQRT]   = "sqrt",
+    [FUNC_LOG]    = "log10",
+    [FUNC_LN]     = "log",
+    [FUNC_SIN]    = "sin",
+    [FUNC_COS]    = "cos",
+    [FUNC_TAN]    = "tan",
+    [FUNC_COSH]   = "cosh",
+    [FUNC_SINH]   = "sinh",
+    [FUNC_TANH]   = "tanh",
+    [FUNC_ASIN]   = "asin",
+    [FUNC_ACOS]   = "acos",
+    [FUNC_ATAN]   = "atan",
+    [FUNC_ARCSIN] = "asin",
+    [FUNC_ARCCOS] = "acos",
+    [FUNC_ARCTAN] = "atan"
+};
+
+/** ============================================================================
+  @var      codegen_binary
+  @package  codegen
+
+  @brief    libm routine of each two-operand opcode, NULL for the others.
+ =========================================================================== **/
+static const char* const codegen_binary[OPCODE_COUNT] =
+{
+    [OPCODE_POW]    = "pow",
+    [OPCODE_ATAN2]  = "atan2",
+    [OPCODE_HYPOT]  = "hypot",
+    [OPCODE_MIN]    = "fmin",
+    [OPCODE_MAX]    = "fmax"
+};
+
+/* ==================================== *\
+ *     PRIVATE FUNCTIONS DEFINITION     *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Codegen_isIdentifier
+  @package  codegen
+
+  @brief    Checks that a name can be used as a C function name.
+
+  @param    name    [in]:   Name to check.
+
+  @return   1 if it is an identifier of at most CODEGEN_MAX_NAME characters,
+            0 otherwise.
+ =========================================================================== **/
+static int Codegen_isIdentifier(const char* name)
+{
+    size_t iterator = 0u;
+
+    if ((isalpha((unsigned char)name[0]) == 0) && (name[0] != '_'))
+    {
+        return 0;
+    }
+
+    for (iterator = 1u; name[iterator] != '\0'; iterator++)
+    {
+        if ((iterator >= CODEGEN_MAX_NAME) || ((isalnum((unsigned char)name[iterator]) == 0) && (name[iterator] != '_')))
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/** ============================================================================
+  @fn       Codegen_literal
+  @package  codegen
+
+  @brief    Writes a constant as a C double literal.
+
+  @param    value   [in]:   Constant.
+  @param    buffer  [out]:  Receives the literal, at least
+                            FORMAT_DOUBLE_SIZE + 2 bytes.
+ =========================================================================== **/
+static void Codegen_literal(double value, char* buffer)
+{
+    int length = 0;
+
+    if (isnan(value) != 0)
+    {
+        strcpy(buffer, "NAN");
+        return;
+    }
+
+    if (isinf(value) != 0)
+    {
+        strcpy(buffer, (value > 0.0) ? "INFINITY" : "-INFINITY");
+        return;
+    }
+
+    length = Format_double(value, buffer);
+
+    /*< "2" would be an int literal >*/
+    if (strpbrk(buffer, ".e") == NULL)
+    {
+        memcpy(&buffer[length], ".0", 3u);
+    }
+}
+
+/** ============================================================================
+  @fn       Codegen_fail
+  @package  codegen
+
+  @brief    Writes a failure check.
+
+  @param    output      [in]:   Stream receiving the source.
+  @param    block       [in]:   Non-zero for the block form.
+  @param    condition   [in]:   C condition that means failure.
+ =========================================================================== **/
+static void Codegen_fail(FILE* output, int block, const char* condition)
+{
+    if (block != 0)
+    {
+        fprintf(output, "        failed |= (%s);\n", condition);
+        return;
+    }
+
+    fprintf(output, "    if (%s)\n    {\n        return -(EINVAL);\n    }\n", condition);
+}
+
+/** ============================================================================
+  @fn       Codegen_body
+  @package  codegen
+
+  @brief    Writes one assignment per instruction.
+
+  @param    program [in]:   Program to translate.
+  @param    name    [in]:   Name of the generated function.
+  @param    block   [in]:   Non-zero for the block form.
+  @param    output  [in]:   Stream receiving the source.
+ =========================================================================== **/
+static void Codegen_body(const rpn_program_t* program, const char* name, int block, FILE* output)
+{
+    const program_instr_t* code = PROGRAM_CODE(program);
+    const double* constants     = PROGRAM_CONSTANTS(program);
+    const char* indent          = (block != 0) ? "        " : "    ";
+
+    char literal[FORMAT_DOUBLE_SIZE + 2u];
+    char condition[4u * MAX_TOKEN_LEN];
+    uint32_t iterator           = 0u;
+    uint32_t top                = 0u;
+
+    for (iterator = 0u; iterator < program->code_count; iterator++)
+    {
+        switch (code[iterator].opcode)
+        {
+            case OPCODE_CONST:
+                Codegen_literal(constants[code[iterator].operand], literal);
+                fprintf(output, "%ss%u = %s;\n", indent, top++, literal);
+                break;
+
+            case OPCODE_VAR:
+                fprintf(output, (block != 0) ? "%ss%u = v%u[row];\n" : "%ss%u = variables[%u];\n", indent, top++, code[iterator].operand);
+                break;
+
+            case OPCODE_STORE:
+                top--;
+                fprintf(output, "%sl%u = s%u;\n", indent, code[iterator].operand, top);
+                break;
+
+            case OPCODE_LOAD:
+                fprintf(output, "%ss%u = l%u;\n", indent, top++, code[iterator].operand);
+                break;
+
+            case OPCODE_ADD:
+            case OPCODE_SUB:
+            case OPCODE_MUL:
+                top--;
+                fprintf(output, "%ss%u = s%u %c s%u;\n", indent, top - 1u, top - 1u,
+                        (code[iterator].opcode == OPCODE_ADD) ? '+' : (code[iterator].opcode == OPCODE_SUB) ? '-' : '*', top);
+                break;
+
+            case OPCODE_DIV:
+                top--;
+                snprintf(condition, sizeof(condition), "s%u == 0.0", top);
+                Codegen_fail(output, block, condition);
+                fprintf(output, "%ss%u = s%u / s%u;\n", indent, top - 1u, top - 1u, top);
+                break;
+
+            case OPCODE_FACT:
+                snprintf(condition, sizeof(condition), "(s%u < 0.0) || ((s%u - (int)(s%u)) != 0.0)", top - 1u, top - 1u, top - 1u);
+                Codegen_fail(output, block, condition);
+                if (block != 0)
+                {
+                    fprintf(output, "%ss%u = (failed != 0) ? 0.0 : %s_factorial(s%u);\n", indent, top - 1u, name, top - 1u);
+                }
+                else
+                {
+                    fprintf(output, "%ss%u = %s_factorial(s%u);\n", indent, top - 1u, name, top - 1u);
+                }
+                break;
+
+            case OPCODE_FUNC:
+                fprintf(output, "%ss%u = %s(s%u);\n", indent, top - 1u, codegen_functions[code[iterator].operand], top - 1u);
+                break;
+
+            case OPCODE_POW10:
+                fprintf(output, "%ss%u = pow(10.0, s%u);\n", indent, top - 1u, top - 1u);
+                break;
+
+            case OPCODE_FMA:
+                top -= 2u;
+                fprintf(output, "%ss%u = fma(s%u, s%u, s%u);\n", indent, top - 1u, top - 1u, top, top + 1u);
+                break;
+
+            default:
+                top--;
+                fprintf(output, "%ss%u = %s(s%u, s%u);\n", indent, top - 1u, codegen_binary[code[iterator].opcode], top - 1u, top);
+                break;
+        }
+    }
+}
+
+/** ============================================================================
+  @fn       Codegen_locals
+  @package  codegen
+
+  @brief    Declares the stack and local slot variables.
+
+  @param    program [in]:   Program to translate.
+  @param    indent  [in]:   Indentation of the declarations.
+  @param    output  [in]:   Stream receiving the source.
+ =========================================================================== **/
+static void Codegen_locals(const rpn_program_t* program, const char* indent, FILE* output)
+{
+    uint32_t iterator = 0u;
+
+    for (iterator = 0u; iterator < program->max_depth; iterator++)
+    {
+        fprintf(output, "%sdouble s%u = 0.0;\n", indent, iterator);
+    }
+
+    for (iterator = 0u; iterator < program->local_count; iterator++)
+    {
+        fprintf(output, "%sdouble l%u = 0.0;\n", indent, iterator);
+    }
+}
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS DEFINITION      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Codegen_emit
+  @package  codegen
+
+  @brief    Writes C source that evaluates a compiled program.
+
+  @param    program [in]:   Program to translate.
+  @param    name    [in]:   C identifier of the generated function.
+  @param    forms   [in]:   Combination of codegen_form_t.
+  @param    output  [in]:   Stream receiving the source.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -EINVAL if name is not an identifier, forms is empty or the
+            program calls a native.
+            -EIO if the output cannot be written.
+ =========================================================================== **/
+int Codegen_emit(const rpn_program_t* program, const char* name, unsigned int forms, FILE* output)
+{
+    /*< Variable Declarations >*/
+    int ret                     = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    const program_instr_t* code = NULL;
+    uint32_t iterator           = 0u;
+    int factorial               = 0;
+
+    /*< Security Checks >*/
+    if ((program == NULL) || (name == NULL) || (output == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if ((Codegen_isIdentifier(name) == 0) || ((forms & (unsigned int)CODEGEN_BOTH) == 0u) || ((forms & ~(unsigned int)CODEGEN_BOTH) != 0u))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    code = PROGRAM_CODE(program);
+
+    /*< Checked up front, so a rejected program writes nothing >*/
+    for (iterator = 0u; iterator < program->code_count; iterator++)
+    {
+        if ((code[iterator].opcode == OPCODE_NATIVE) || (code[iterator].opcode >= OPCODE_COUNT))
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+
+        factorial |= (code[iterator].opcode == OPCODE_FACT);
+    }
+
+    /*< Start Function Algorithm >*/
+    fprintf(output, "/* %s: generated from a compiled RPN program.\n", name);
+    fprintf(output, " * Compile with -ffp-contract=off -fno-builtin to match Program_evaluateWith bit for bit. */\n\n");
+
+    for (iterator = 0u; iterator < program->var_count; iterator++)
+    {
+        fprintf(output, "/* variable %u: %s */\n", iterator, PROGRAM_VARIABLES(program)[iterator]);
+    }
+
+    fprintf(output, "\n#include <errno.h>\n#include <math.h>\n#include <stddef.h>\n\n");
+
+    if (factorial != 0)
+    {
+        fprintf(output, "static double %s_factorial(double value)\n{\n", name);
+        fprintf(output, "    unsigned int number = (unsigned int)value;\n");
+        fprintf(output, "    unsigned int factor = 2u;\n");
+        fprintf(output, "    double result = 1.0;\n\n");
+        fprintf(output, "    /* Same order as RPNCalculator_factorialCalculate; infinity absorbs the rest */\n");
+        fprintf(output, "    for (factor = 2u; (factor <= number) && (result != INFINITY); factor++)\n    {\n");
+        fprintf(output, "        result = (double)factor * result;\n    }\n\n");
+        fprintf(output, "    return result;\n}\n\n");
+    }
+
+    if ((forms & (unsigned int)CODEGEN_SCALAR) != 0u)
+    {
+        fprintf(output, "int %s(const double* variables, double* result)\n{\n", name);
+        Codegen_locals(program, "    ", output);
+        fprintf(output, (program->var_count == 0u) ? "\n    (void)variables;\n\n" : "\n");
+        Codegen_body(program, name, 0, output);
+        fprintf(output, "\n    *result = s0;\n    return 0;\n}\n\n");
+    }
+
+    if ((forms & (unsigned int)CODEGEN_BLOCK) != 0u)
+    {
+        fprintf(output, "size_t %s_block(const double* const* columns, size_t rows, double* restrict results, int* restrict status)\n{\n", name);
+        for (iterator = 0u; iterator < program->var_count; iterator++)
+        {
+            fprintf(output, "    const double* const v%u = columns[%u];\n", iterator, iterator);
+        }
+        fprintf(output, "    size_t failures = 0u;\n    size_t row = 0u;\n\n");
+        fprintf(output, (program->var_count == 0u) ? "    (void)columns;\n\n" : "");
+        fprintf(output, "    for (row = 0u; row < rows; row++)\n    {\n        int failed = 0;\n");
+        Codegen_locals(program, "        ", output);
+        fprintf(output, "\n");
+        Codegen_body(program, name, 1, output);
+        fprintf(output, "\n        results[row] = (failed != 0) ? NAN : s0;\n");
+        fprintf(output, "        status[row] = (failed != 0) ? -(EINVAL) : 0;\n");
+        fprintf(output, "        failures += (size_t)(failed != 0);\n    }\n\n    return failures;\n}\n");
+    }
+
+    if ((fflush(output) != 0) || (ferror(output) != 0))
+    {
+        ret = -(EIO);
+        goto end_of_function;
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Codegen_emitExpression
+  @package  codegen
+
+  @brief    Compiles an infix expression and writes C source that evaluates
+            it.
+
+  @param    expression  [in]:   Infix expression.
+  @param    name        [in]:   C identifier of the generated function.
+  @param    forms       [in]:   Combination of codegen_form_t.
+  @param    output      [in]:   Stream receiving the source.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -EINVAL if the expression is malformed or as for Codegen_emit.
+            -EIO if the output cannot be written.
+ =========================================================================== **/
+int Codegen_emitExpression(const char* expression, const char* name, unsigned int forms, FILE* output)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    rpn_program_t* program  = NULL;
+
+    /*< Security Checks >*/
+    if (expression == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    ret = Program_compile(expression, &program);
+    if (ret != FUNCTION_SUCCESS)
+    {
+        goto end_of_function;
+    }
+
+    ret = Codegen_emit(program, name, forms, output);
+
+    /*< Function Output >*/
+end_of_function:
+    Program_destroy(program);
+    return ret;
+}
+
+/*< end of file >*/
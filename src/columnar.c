@@ -0,0 +1,516 @@
+/** ===========================================================================
+    @ingroup    Columnar
+    @addtogroup Columnar_Module columnar
+
+    @package    columnar
+    @brief      This module writes and reads batch results as a binary
+                column of little-endian doubles with per-row status bits.
+
+    @file       columnar.c
+    @headerfile columnar.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    A columnar file is an 8-byte file header followed by any
+                number of blocks, so results can be appended chunk by chunk.
+                Each block is a "BLK1" tag, a row count, the value column and
+                the packed status bits padded to 8 bytes. Every field is
+                little-endian and every value column starts on an 8-byte
+                boundary, so the reader hands out pointers into the mapped
+                file without copying. On little-endian hosts the writer
+                passes the caller's value buffer straight to writev.
+
+    @see        - Columnar_writeHeader
+                - Columnar_writeBlock
+                - Columnar_open
+                - Columnar_nextBlock
+                - Columnar_close
+ =========================================================================== **/
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+
+/*< Implements >*/
+#include <alloc.h>
+#include <columnar.h>
+
+/* ==================================== *\
+ *            PRIVATE DEFINES           *
+\* ==================================== */
+
+/** ====================================
+  @def      FUNCTION_SUCCESS
+  @package  columnar
+  @brief    Indicates successful function
+            execution.
+
+  @details  Represents a successful
+            operation, typically with
+            a value of 0.
+ ==================================== **/
+#define FUNCTION_SUCCESS        (int)(0)
+
+/** ====================================
+  @def      FILE_MAGIC
+  @package  columnar
+  @brief    Identifies a columnar file
+            and its layout version.
+ ==================================== **/
+#define FILE_MAGIC              "RPNCOL01"
+
+/** ====================================
+  @def      BLOCK_MAGIC
+  @package  columnar
+  @brief    Tag at the start of every
+            block.
+ ==================================== **/
+#define BLOCK_MAGIC             "BLK1"
+
+/** ====================================
+  @def      BLOCK_HEADER_SIZE
+  @package  columnar
+  @brief    Size in bytes of a block
+            header: tag and row count.
+ ==================================== **/
+#define BLOCK_HEADER_SIZE       (size_t)(8U)
+
+/** ====================================
+  @def      STATUS_BYTES
+  @package  columnar
+  @brief    Padded size in bytes of the
+            status bits of a block.
+ ==================================== **/
+#define STATUS_BYTES(rows)      (size_t)((((rows) + 63U) / 64U) * 8U)
+
+/** ====================================
+  @def      SWAP_CHUNK
+  @package  columnar
+  @brief    Values byte-swapped per
+            write on big-endian hosts.
+ ==================================== **/
+#define SWAP_CHUNK              (size_t)(4096U)
+
+/** ====================================
+  @def      HOST_BIG_ENDIAN
+  @package  columnar
+  @brief    Non-zero when the host
+            stores doubles big-endian.
+ ==================================== **/
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define HOST_BIG_ENDIAN         (int)(1)
+#else
+#define HOST_BIG_ENDIAN         (int)(0)
+#endif
+
+/* ==================================== *\
+ *     PRIVATE FUNCTIONS DEFINITION     *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Columnar_writeVector
+  @package  columnar
+
+  @brief    Writes a whole I/O vector, resuming after short writes.
+
+  @param    descriptor  [in]:       File descriptor.
+  @param    vector      [in/out]:   I/O vector, consumed by the call.
+  @param    count       [in]:       Number of entries.
+
+  @return   Number of bytes written on success.
+            -EIO if the write fails.
+ =========================================================================== **/
+static long Columnar_writeVector(int descriptor, struct iovec* vector, int count)
+{
+    long total      = 0;
+    ssize_t written = 0;
+
+    while (count > 0)
+    {
+        written = writev(descriptor, vector, count);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return -(EIO);
+        }
+
+        total += (long)written;
+
+        while ((count > 0) && ((size_t)written >= vector->iov_len))
+        {
+            written -= (ssize_t)vector->iov_len;
+            vector++;
+            count--;
+        }
+
+        if (count > 0)
+        {
+            vector->iov_base  = (uint8_t*)vector->iov_base + written;
+            vector->iov_len  -= (size_t)written;
+        }
+    }
+
+    return total;
+}
+
+/** ============================================================================
+  @fn       Columnar_swapValues
+  @package  columnar
+
+  @brief    Converts doubles between host and little-endian byte order.
+
+  @param    target  [out]:  Converted values.
+  @param    source  [in]:   Values to convert.
+  @param    count   [in]:   Number of values.
+ =========================================================================== **/
+static void Columnar_swapValues(double* target, const double* source, size_t count)
+{
+    size_t iterator = 0u;
+    uint64_t bits   = 0u;
+
+    for (iterator = 0u; iterator < count; iterator++)
+    {
+        memcpy(&bits, &source[iterator], sizeof(bits));
+        bits = __builtin_bswap64(bits);
+        memcpy(&target[iterator], &bits, sizeof(bits));
+    }
+}
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS DEFINITION      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Columnar_writeHeader
+  @package  columnar
+
+  @brief    Writes the file header.
+
+  @param    descriptor  [in]:   File descriptor positioned at offset 0.
+
+  @return   Number of bytes written on success.
+            -EIO if the write fails.
+ =========================================================================== **/
+long Columnar_writeHeader(int descriptor)
+{
+    struct iovec vector = { .iov_base = (void*)FILE_MAGIC, .iov_len = COLUMNAR_HEADER_SIZE };
+
+    return Columnar_writeVector(descriptor, &vector, 1);
+}
+
+/** ============================================================================
+  @fn       Columnar_writeBlock
+  @package  columnar
+
+  @brief    Appends one block of results.
+
+  @details  Packs the statuses into bits and issues a single writev of the
+            block header, the value buffer and the status bits. Big-endian
+            hosts write the values through a bounded byte-swap buffer
+            instead.
+
+  @param    descriptor  [in]:   File descriptor.
+  @param    values      [in]:   Value column.
+  @param    status      [in]:   0 or negative errno per row.
+  @param    rows        [in]:   Number of rows, at most UINT32_MAX.
+
+  @return   Number of bytes written on success.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -EINVAL if rows is too large.
+            -EIO if the write fails.
+ =========================================================================== **/
+long Columnar_writeBlock(int descriptor, const double* values, const int* status, size_t rows)
+{
+    /*< Variable Declarations >*/
+    long ret                            = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    long written                        = 0;
+    size_t iterator                     = 0u;
+    size_t chunk                        = 0u;
+
+    uint8_t header[BLOCK_HEADER_SIZE];
+    uint8_t* bits                       = NULL;
+    double* swapped                     = NULL;
+
+    struct iovec vector[3];
+
+    /*< Security Checks >*/
+    if ((values == NULL) || (status == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if (rows > UINT32_MAX)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    memcpy(header, BLOCK_MAGIC, 4u);
+    header[4] = (uint8_t)(rows);
+    header[5] = (uint8_t)(rows >> 8u);
+    header[6] = (uint8_t)(rows >> 16u);
+    header[7] = (uint8_t)(rows >> 24u);
+
+    bits = Alloc_calloc(STATUS_BYTES(rows) + 1u, sizeof(uint8_t));
+    if (bits == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    for (iterator = 0u; iterator < rows; iterator++)
+    {
+        bits[iterator / 8u] |= (uint8_t)((status[iterator] != FUNCTION_SUCCESS) << (iterator % 8u));
+    }
+
+    /*< Start Function Algorithm >*/
+    if (!HOST_BIG_ENDIAN)
+    {
+        vector[0] = (struct iovec){ .iov_base = header,         .iov_len = BLOCK_HEADER_SIZE };
+        vector[1] = (struct iovec){ .iov_base = (void*)values,  .iov_len = rows * sizeof(double) };
+        vector[2] = (struct iovec){ .iov_base = bits,           .iov_len = STATUS_BYTES(rows) };
+
+        ret = Columnar_writeVector(descriptor, vector, 3);
+        goto end_of_function;
+    }
+
+    swapped = Alloc_malloc(SWAP_CHUNK * sizeof(double));
+    if (swapped == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    vector[0] = (struct iovec){ .iov_base = header, .iov_len = BLOCK_HEADER_SIZE };
+    ret = Columnar_writeVector(descriptor, vector, 1);
+
+    for (iterator = 0u; (iterator < rows) && (ret >= 0); iterator += chunk)
+    {
+        chunk = ((rows - iterator) < SWAP_CHUNK) ? (rows - iterator) : SWAP_CHUNK;
+        Columnar_swapValues(swapped, &values[iterator], chunk);
+
+        vector[0] = (struct iovec){ .iov_base = swapped, .iov_len = chunk * sizeof(double) };
+        written = Columnar_writeVector(descriptor, vector, 1);
+        ret = (written < 0) ? written : (ret + written);
+    }
+
+    if (ret >= 0)
+    {
+        vector[0] = (struct iovec){ .iov_base = bits, .iov_len = STATUS_BYTES(rows) };
+        written = Columnar_writeVector(descriptor, vector, 1);
+        ret = (written < 0) ? written : (ret + written);
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    Alloc_free(bits);
+    Alloc_free(swapped);
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Columnar_open
+  @package  columnar
+
+  @brief    Maps a columnar file for reading.
+
+  @param    path    [in]:   Path of the file.
+  @param    reader  [out]:  Receives the reader.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -ENOENT if the file cannot be opened or mapped.
+            -EINVAL if the file header is invalid.
+ =========================================================================== **/
+int Columnar_open(const char* path, columnar_reader_t* reader)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    int descriptor      = -1;
+    struct stat info    = {0};
+    void* mapping       = NULL;
+
+    /*< Security Checks >*/
+    if ((path == NULL) || (reader == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    memset(reader, 0, sizeof(columnar_reader_t));
+
+    descriptor = open(path, O_RDONLY);
+    if ((descriptor < 0) || (fstat(descriptor, &info) != 0))
+    {
+        ret = -(ENOENT);
+        goto end_of_function;
+    }
+
+    if ((size_t)info.st_size < COLUMNAR_HEADER_SIZE)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    mapping = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    if (mapping == MAP_FAILED)
+    {
+        ret = -(ENOENT);
+        goto end_of_function;
+    }
+
+    if (memcmp(mapping, FILE_MAGIC, COLUMNAR_HEADER_SIZE) != 0)
+    {
+        munmap(mapping, (size_t)info.st_size);
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    reader->data    = mapping;
+    reader->size    = (size_t)info.st_size;
+    reader->cursor  = COLUMNAR_HEADER_SIZE;
+
+    /*< Function Output >*/
+end_of_function:
+    if (descriptor >= 0)
+    {
+        close(descriptor);
+    }
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Columnar_nextBlock
+  @package  columnar
+
+  @brief    Returns the next block of a columnar file.
+
+  @param    reader  [in/out]:   Reader from Columnar_open.
+  @param    block   [out]:      Receives the block.
+
+  @return   1 if a block was returned, 0 at the end of the file.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -EINVAL if the block is truncated or corrupted.
+ =========================================================================== **/
+int Columnar_nextBlock(columnar_reader_t* reader, columnar_block_t* block)
+{
+    /*< Variable Declarations >*/
+    int ret             = 1; /*< Return Control >*/
+
+    size_t rows         = 0u;
+    size_t block_size   = 0u;
+    const uint8_t* head = NULL;
+
+    /*< Security Checks >*/
+    if ((reader == NULL) || (block == NULL) || (reader->data == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if (reader->cursor >= reader->size)
+    {
+        ret = 0;
+        goto end_of_function;
+    }
+
+    if ((reader->size - reader->cursor) < BLOCK_HEADER_SIZE)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    head = &reader->data[reader->cursor];
+
+    if (memcmp(head, BLOCK_MAGIC, 4u) != 0)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    rows = (size_t)head[4]
+         | ((size_t)head[5] << 8u)
+         | ((size_t)head[6] << 16u)
+         | ((size_t)head[7] << 24u);
+
+    block_size = BLOCK_HEADER_SIZE + (rows * sizeof(double)) + STATUS_BYTES(rows);
+
+    if ((reader->size - reader->cursor) < block_size)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    block->rows         = rows;
+    block->values       = (const double*)(const void*)(head + BLOCK_HEADER_SIZE);
+    block->status_bits  = head + BLOCK_HEADER_SIZE + (rows * sizeof(double));
+
+    if (HOST_BIG_ENDIAN)
+    {
+        Alloc_free(reader->swapped);
+
+        reader->swapped = Alloc_malloc((rows + 1u) * sizeof(double));
+        if (reader->swapped == NULL)
+        {
+            ret = -(ENOMEM);
+            goto end_of_function;
+        }
+
+        Columnar_swapValues(reader->swapped, block->values, rows);
+        block->values = reader->swapped;
+    }
+
+    reader->cursor += block_size;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Columnar_close
+  @package  columnar
+
+  @brief    Releases a reader from Columnar_open.
+
+  @param    reader  [in/out]:   Reader to release.
+ =========================================================================== **/
+void Columnar_close(columnar_reader_t* reader)
+{
+    if (reader == NULL)
+    {
+        return;
+    }
+
+    if (reader->data != NULL)
+    {
+        munmap((void*)reader->data, reader->size);
+    }
+
+    Alloc_free(reader->swapped);
+    memset(reader, 0, sizeof(columnar_reader_t));
+}
+
+/*< end of file >*/
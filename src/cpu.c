@@ -0,0 +1,217 @@
+/** ===========================================================================
+    @ingroup    Cpu
+    @addtogroup Cpu_Module cpu
+
+    @package    cpu
+    @brief      This module detects the instruction sets of the host once and
+                tells the vectorized kernels which implementation to run.
+
+    @file       cpu.c
+    @headerfile cpu.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    Detection runs under pthread_once, so concurrent first calls
+                agree on one tier and later calls only read it.
+
+    @see        - Cpu_tier
+                - Cpu_tierName
+ =========================================================================== **/
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+/*< Implements >*/
+#include <cpu.h>
+
+/* ==================================== *\
+ *            PRIVATE DEFINES           *
+\* ==================================== */
+
+/** ====================================
+  @def      XCR0_AVX_STATE
+  @package  cpu
+  @brief    XCR0 bits of the SSE and
+            AVX register state.
+ ==================================== **/
+#define XCR0_AVX_STATE          (uint64_t)(0x06U)
+
+/** ====================================
+  @def      XCR0_AVX512_STATE
+  @package  cpu
+  @brief    XCR0 bits of the SSE, AVX
+            and AVX-512 register state.
+ ==================================== **/
+#define XCR0_AVX512_STATE       (uint64_t)(0xE6U)
+
+/* ==================================== *\
+ *  PRIVATE GLOBAL VARIABLES DEFINITION *
+\* ==================================== */
+
+/** ============================================================================
+  @var      cpu_names
+  @package  cpu
+
+  @brief    Names of the tiers, indexed by `cpu_tier_t`.
+ =========================================================================== **/
+static const char* const cpu_names[CPU_TIER_COUNT] =
+{
+    [CPU_TIER_SCALAR]   = "scalar",
+    [CPU_TIER_SSE2]     = "sse2",
+    [CPU_TIER_AVX2]     = "avx2",
+    [CPU_TIER_AVX512]   = "avx512"
+};
+
+/** ============================================================================
+  @var      cpu_once
+  @package  cpu
+
+  @brief    Guards the detection.
+ =========================================================================== **/
+static pthread_once_t cpu_once = PTHREAD_ONCE_INIT;
+
+/** ============================================================================
+  @var      cpu_resolved
+  @package  cpu
+
+  @brief    Tier chosen by the detection.
+ =========================================================================== **/
+static cpu_tier_t cpu_resolved = CPU_TIER_SCALAR;
+
+/* ==================================== *\
+ *     PRIVATE FUNCTIONS DEFINITION     *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Cpu_detect
+  @package  cpu
+
+  @brief    Returns the widest tier the host and its OS support.
+
+  @return   Supported tier.
+ =========================================================================== **/
+static cpu_tier_t Cpu_detect(void)
+{
+    cpu_tier_t tier     = CPU_TIER_SCALAR;
+
+#if CPU_DISPATCH
+    unsigned int eax    = 0u;
+    unsigned int ebx    = 0u;
+    unsigned int ecx    = 0u;
+    unsigned int edx    = 0u;
+    unsigned int low    = 0u;
+    unsigned int high   = 0u;
+    uint64_t xcr0       = 0u;
+
+    if (__get_cpuid(1u, &eax, &ebx, &ecx, &edx) == 0)
+    {
+        return tier;
+    }
+
+    tier = ((edx & bit_SSE2) != 0u) ? CPU_TIER_SSE2 : CPU_TIER_SCALAR;
+
+    /*< The wider registers are only usable if the OS saves them >*/
+    if ((tier != CPU_TIER_SSE2) || ((ecx & bit_OSXSAVE) == 0u) || ((ecx & bit_AVX) == 0u) || ((ecx & bit_FMA) == 0u))
+    {
+        return tier;
+    }
+
+    __asm__ volatile ("xgetbv" : "=a"(low), "=d"(high) : "c"(0u));
+    xcr0 = ((uint64_t)high << 32U) | low;
+
+    if (((xcr0 & XCR0_AVX_STATE) != XCR0_AVX_STATE) || (__get_cpuid_count(7u, 0u, &eax, &ebx, &ecx, &edx) == 0))
+    {
+        return tier;
+    }
+
+    if ((ebx & bit_AVX2) != 0u)
+    {
+        tier = CPU_TIER_AVX2;
+
+        if (((xcr0 & XCR0_AVX512_STATE) == XCR0_AVX512_STATE) && ((ebx & bit_AVX512F) != 0u)
+                                                              && ((ebx & bit_AVX512BW) != 0u))
+        {
+            tier = CPU_TIER_AVX512;
+        }
+    }
+#endif
+
+    return tier;
+}
+
+/** ============================================================================
+  @fn       Cpu_resolve
+  @package  cpu
+
+  @brief    Detects the tier and applies CPU_TIER_VARIABLE.
+
+  @details  Unknown names in the variable are ignored.
+ =========================================================================== **/
+static void Cpu_resolve(void)
+{
+    const char* forced  = getenv(CPU_TIER_VARIABLE);
+    int tier            = 0;
+
+    cpu_resolved = Cpu_detect();
+
+    for (tier = 0; (forced != NULL) && (tier < (int)cpu_resolved); tier++)
+    {
+        if (strcmp(forced, cpu_names[tier]) == 0)
+        {
+            cpu_resolved = (cpu_tier_t)tier;
+            break;
+        }
+    }
+}
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS DEFINITION      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Cpu_tier
+  @package  cpu
+
+  @brief    Returns the tier the kernels should use.
+
+  @details  Detects the host features and reads CPU_TIER_VARIABLE on the
+            first call; later calls return the cached tier. Safe to call
+            from any thread.
+
+  @return   The widest supported tier, lowered by CPU_TIER_VARIABLE.
+ =========================================================================== **/
+cpu_tier_t Cpu_tier(void)
+{
+    pthread_once(&cpu_once, Cpu_resolve);
+
+    return cpu_resolved;
+}
+
+/** ============================================================================
+  @fn       Cpu_tierName
+  @package  cpu
+
+  @brief    Returns the name of a tier, as accepted by CPU_TIER_VARIABLE.
+
+  @param    tier    [in]:   Tier to name.
+
+  @return   The name, or NULL if the tier is out of range.
+ =========================================================================== **/
+const char* Cpu_tierName(cpu_tier_t tier)
+{
+    return ((unsigned int)tier < CPU_TIER_COUNT) ? cpu_names[tier] : NULL;
+}
+
+/*< end of file >*/
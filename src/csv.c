@@ -0,0 +1,1152 @@
+/** ===========================================================================
+    @ingroup    Csv
+    @addtogroup Csv_Module csv
+
+    @package    csv
+    @brief      This module evaluates one formula per row of a CSV file,
+                binding the formula's variables to header columns.
+
+    @file       csv.c
+    @headerfile csv.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    The input is consumed as a sequence of chunks. A chunk is
+                cut after its last newline; the rows before the cut are
+                parsed in place, gathered into blocks of CSV_BLOCK_ROWS and
+                evaluated, and the bytes after the cut are moved to the front
+                of the buffer before the next read. Every pointer into the
+                chunk is dropped before that move, so a block never outlives
+                its chunk.
+
+    @see        - Csv_evaluate
+                - Csv_parseDouble
+ =========================================================================== **/
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <limits.h>
+#include <errno.h>
+#include <locale.h>
+#include <pthread.h>
+
+/*< Implements >*/
+#include <alloc.h>
+#include <cpu.h>
+
+#if CPU_DISPATCH
+#include <immintrin.h>
+#endif
+
+#include <program.h>
+#include <format.h>
+#include <csv.h>
+
+/* ==================================== *\
+ *            PRIVATE DEFINES           *
+\* ==================================== */
+
+/** ====================================
+  @def      FUNCTION_SUCCESS
+  @package  csv
+  @brief    Indicates successful function
+            execution.
+
+  @details  Represents a successful
+            operation, typically with
+            a value of 0.
+ ==================================== **/
+#define FUNCTION_SUCCESS        (int)(0)
+
+/** ====================================
+  @def      UNBOUND_COLUMN
+  @package  csv
+  @brief    Marks a header column that
+            no variable refers to.
+ ==================================== **/
+#define UNBOUND_COLUMN          (int)(-1)
+
+/** ====================================
+  @def      MAX_FAST_DIGITS
+  @package  csv
+  @brief    Significant digits that fit
+            the exact parsing path.
+ ==================================== **/
+#define MAX_FAST_DIGITS         (int)(19)
+
+/** ====================================
+  @def      MAX_EXACT_POWER
+  @package  csv
+  @brief    Largest power of ten that is
+            exact as a double.
+ ==================================== **/
+#define MAX_EXACT_POWER         (int)(22)
+
+/** ====================================
+  @def      MAX_EXACT_MANTISSA
+  @package  csv
+  @brief    Largest integer that is
+            exact as a double.
+ ==================================== **/
+#define MAX_EXACT_MANTISSA      (uint64_t)(1ULL << 53U)
+
+/** ====================================
+  @def      MAX_NUMBER_TEXT
+  @package  csv
+  @brief    Longest field handed to the
+            strtod fallback.
+ ==================================== **/
+#define MAX_NUMBER_TEXT         (size_t)(64U)
+
+/** ====================================
+  @def      OUTPUT_BUFFER_SIZE
+  @package  csv
+  @brief    Size of the stdio buffer of
+            the output file.
+ ==================================== **/
+#define OUTPUT_BUFFER_SIZE      (size_t)(1U << 16U)
+
+/* ==================================== *\
+ *       PRIVATE TYPES DEFINITION       *
+\* ==================================== */
+
+/** ============================================================================
+  @typedef  csv_scan_t
+  @package  csv
+
+  @brief    Kernel that finds the next delimiter or newline.
+ =========================================================================== **/
+typedef const char* (*csv_scan_t)(const char* cursor, const char* end, char delimiter);
+
+/** ============================================================================
+  @struct   csv_state_t
+  @package  csv
+
+  @typedef  csv_state_t
+
+  @brief    Represents a CSV evaluation in progress.
+
+  @details  `lines` and `lengths` point into the current chunk and are only
+            valid until the block is flushed.
+ =========================================================================== **/
+typedef struct
+{
+    rpn_program_t*  program;        /*< Compiled formula >*/
+    csv_options_t   options;        /*< Effective settings >*/
+    FILE*           output;         /*< Output file >*/
+    csv_scan_t      scan;           /*< Field scanner of the CPU tier >*/
+
+    int*            column_slot;    /*< Variable slot of each header column >*/
+    size_t          column_count;   /*< Number of header columns >*/
+    int             header_done;    /*< Non-zero once the header is bound >*/
+
+    double*         values;         /*< var_count x CSV_BLOCK_ROWS inputs >*/
+    const double**  columns;        /*< Start of each variable column >*/
+    double*         results;        /*< Result of each row of the block >*/
+    int*            status;         /*< Evaluation status of each row >*/
+    int*            parse_status;   /*< Parsing status of each row >*/
+    const char**    lines;          /*< Start of each row >*/
+    size_t*         lengths;        /*< Length of each row, terminator excluded >*/
+    size_t          rows;           /*< Rows gathered in the block >*/
+    size_t          failed;         /*< Failed rows so far >*/
+} csv_state_t;
+
+/* ==================================== *\
+ *  PRIVATE GLOBAL VARIABLES DEFINITION *
+\* ==================================== */
+
+/** ============================================================================
+  @var      exact_powers
+  @package  csv
+
+  @brief    Powers of ten that are exactly representable as doubles.
+ =========================================================================== **/
+static const double exact_powers[MAX_EXACT_POWER + 1] =
+{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+    1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+    1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/** ============================================================================
+  @var      csv_c_locale
+  @package  csv
+
+  @brief    "C" locale of the strtod fallback, so a decimal comma set by
+            the application through LC_NUMERIC never changes the parse.
+ =========================================================================== **/
+static locale_t csv_c_locale = (locale_t)0;
+
+/** ============================================================================
+  @var      csv_locale_once
+  @package  csv
+
+  @brief    Guards the creation of `csv_c_locale`.
+ =========================================================================== **/
+static pthread_once_t csv_locale_once = PTHREAD_ONCE_INIT;
+
+/* ==================================== *\
+ *     PRIVATE FUNCTIONS DEFINITION     *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Csv_createLocale
+  @package  csv
+
+  @brief    Creates `csv_c_locale`; runs once.
+ =========================================================================== **/
+static void Csv_createLocale(void)
+{
+    csv_c_locale = newlocale(LC_ALL_MASK, "C", (locale_t)0);
+}
+
+/** ============================================================================
+  @fn       Csv_scanScalar
+  @package  csv
+
+  @brief    Finds the next delimiter or newline.
+
+  @details  Examines one byte at a time. The vector kernels finish their
+            tail with it.
+
+  @param    cursor      [in]:   First byte to examine.
+  @param    end         [in]:   End of the data.
+  @param    delimiter   [in]:   Field separator.
+
+  @return   Position of the first match, or end.
+ =========================================================================== **/
+static const char* Csv_scanScalar(const char* cursor, const char* end, char delimiter)
+{
+    while ((cursor < end) && (*cursor != delimiter) && (*cursor != '\n'))
+    {
+        cursor++;
+    }
+
+    return cursor;
+}
+
+#if CPU_DISPATCH
+
+/** ============================================================================
+  @fn       Csv_scanSse2
+  @package  csv
+
+  @brief    Finds the next delimiter or newline, 16 bytes at a time.
+
+  @param    cursor      [in]:   First byte to examine.
+  @param    end         [in]:   End of the data.
+  @param    delimiter   [in]:   Field separator.
+
+  @return   Position of the first match, or end.
+ =========================================================================== **/
+CPU_TARGET_SSE2 static const char* Csv_scanSse2(const char* cursor, const char* end, char delimiter)
+{
+    const __m128i separators    = _mm_set1_epi8(delimiter);
+    const __m128i newlines      = _mm_set1_epi8('\n');
+
+    __m128i bytes               = _mm_setzero_si128();
+    int mask                    = 0;
+
+    while ((end - cursor) >= 16)
+    {
+        bytes   = _mm_loadu_si128((const __m128i*)(const void*)cursor);
+        mask    = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(bytes, separators),
+                                                 _mm_cmpeq_epi8(bytes, newlines)));
+        if (mask != 0)
+        {
+            return cursor + __builtin_ctz((unsigned int)mask);
+        }
+
+        cursor += 16;
+    }
+
+    return Csv_scanScalar(cursor, end, delimiter);
+}
+
+/** ============================================================================
+  @fn       Csv_scanAvx2
+  @package  csv
+
+  @brief    Finds the next delimiter or newline, 32 bytes at a time.
+
+  @param    cursor      [in]:   First byte to examine.
+  @param    end         [in]:   End of the data.
+  @param    delimiter   [in]:   Field separator.
+
+  @return   Position of the first match, or end.
+ =========================================================================== **/
+CPU_TARGET_AVX2 static const char* Csv_scanAvx2(const char* cursor, const char* end, char delimiter)
+{
+    const __m256i separators    = _mm256_set1_epi8(delimiter);
+    const __m256i newlines      = _mm256_set1_epi8('\n');
+
+    __m256i bytes               = _mm256_setzero_si256();
+    unsigned int mask           = 0u;
+
+    while ((end - cursor) >= 32)
+    {
+        bytes   = _mm256_loadu_si256((const __m256i*)(const void*)cursor);
+        mask    = (unsigned int)_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(bytes, separators),
+                                                                     _mm256_cmpeq_epi8(bytes, newlines)));
+        if (mask != 0u)
+        {
+            return cursor + __builtin_ctz(mask);
+        }
+
+        cursor += 32;
+    }
+
+    return Csv_scanScalar(cursor, end, delimiter);
+}
+
+/** ============================================================================
+  @fn       Csv_scanAvx512
+  @package  csv
+
+  @brief    Finds the next delimiter or newline, 64 bytes at a time.
+
+  @param    cursor      [in]:   First byte to examine.
+  @param    end         [in]:   End of the data.
+  @param    delimiter   [in]:   Field separator.
+
+  @return   Position of the first match, or end.
+ =========================================================================== **/
+CPU_TARGET_AVX512 static const char* Csv_scanAvx512(const char* cursor, const char* end, char delimiter)
+{
+    const __m512i separators    = _mm512_set1_epi8(delimiter);
+    const __m512i newlines      = _mm512_set1_epi8('\n');
+
+    __m512i bytes               = _mm512_setzero_si512();
+    __mmask64 mask              = 0u;
+
+    while ((end - cursor) >= 64)
+    {
+        bytes   = _mm512_loadu_si512((const void*)cursor);
+        mask    = _mm512_cmpeq_epi8_mask(bytes, separators) | _mm512_cmpeq_epi8_mask(bytes, newlines);
+        if (mask != 0u)
+        {
+            return cursor + __builtin_ctzll((unsigned long long)mask);
+        }
+
+        cursor += 64;
+    }
+
+    return Csv_scanScalar(cursor, end, delimiter);
+}
+
+#endif /* CPU_DISPATCH */
+
+/** ============================================================================
+  @fn       Csv_selectScan
+  @package  csv
+
+  @brief    Returns the field scanner for the CPU tier.
+
+  @return   Widest scanner the host may run.
+ =========================================================================== **/
+static csv_scan_t Csv_selectScan(void)
+{
+#if CPU_DISPATCH
+    switch (Cpu_tier())
+    {
+        case CPU_TIER_AVX512:
+            return Csv_scanAvx512;
+
+        case CPU_TIER_AVX2:
+            return Csv_scanAvx2;
+
+        case CPU_TIER_SSE2:
+            return Csv_scanSse2;
+
+        default:
+            break;
+    }
+#endif
+
+    return Csv_scanScalar;
+}
+
+/** ============================================================================
+  @fn       Csv_nextField
+  @package  csv
+
+  @brief    Splits the next field off a row.
+
+  @details  A field starting with a quote extends to the matching quote,
+            with "" standing for a literal quote; the quotes are not part of
+            the returned value. A carriage return before the newline is
+            dropped from the last field.
+
+  @param    scan        [in]:       Field scanner.
+  @param    cursor      [in/out]:   Start of the field; advanced past its
+                                    delimiter or newline.
+  @param    end         [in]:       End of the data.
+  @param    delimiter   [in]:       Field separator.
+  @param    value       [out]:      Start of the field value.
+  @param    length      [out]:      Length of the field value.
+
+  @return   1 if more fields follow on the row, 0 if the row ended.
+ =========================================================================== **/
+static int Csv_nextField(csv_scan_t scan, const char** cursor, const char* end, char delimiter, const char** value, size_t* length)
+{
+    const char* start   = *cursor;
+    const char* close   = NULL;
+    const char* stop    = NULL;
+
+    if ((start < end) && (*start == '"'))
+    {
+        for (close = start + 1; (close < end) && (*close != '\n'); close++)
+        {
+            if (*close == '"')
+            {
+                if (((close + 1) < end) && (close[1] == '"'))
+                {
+                    close++;
+                    continue;
+                }
+                break;
+            }
+        }
+
+        *value  = start + 1;
+        *length = (size_t)(close - start - 1);
+        stop    = scan(((close < end) && (*close == '"')) ? (close + 1) : close, end, delimiter);
+    }
+    else
+    {
+        stop    = scan(start, end, delimiter);
+        *value  = start;
+        *length = (size_t)(stop - start);
+
+        if ((*length > 0u) && (start[*length - 1u] == '\r') && ((stop == end) || (*stop == '\n')))
+        {
+            (*length)--;
+        }
+    }
+
+    if ((stop < end) && (*stop == delimiter))
+    {
+        *cursor = stop + 1;
+        return 1;
+    }
+
+    *cursor = (stop < end) ? (stop + 1) : end;
+    return 0;
+}
+
+/** ============================================================================
+  @fn       Csv_lineLength
+  @package  csv
+
+  @brief    Returns the length of a row without its line terminator.
+
+  @param    line    [in]:   Start of the row.
+  @param    next    [in]:   Start of the following row.
+
+  @return   Length of the row, "\n" and "\r\n" excluded.
+ =========================================================================== **/
+static size_t Csv_lineLength(const char* line, const char* next)
+{
+    size_t length = (size_t)(next - line);
+
+    if ((length > 0u) && (line[length - 1u] == '\n'))
+    {
+        length--;
+    }
+
+    if ((length > 0u) && (line[length - 1u] == '\r'))
+    {
+        length--;
+    }
+
+    return length;
+}
+
+/** ============================================================================
+  @fn       Csv_bindHeader
+  @package  csv
+
+  @brief    Reads the header row and binds every variable to its column.
+
+  @param    state   [in/out]:   Evaluation state.
+  @param    cursor  [in/out]:   Start of the header; advanced past it.
+  @param    end     [in]:       End of the chunk.
+
+  @return   0 on success.
+            -ENOMEM if the column table cannot be allocated.
+            -ENOENT if a variable has no column.
+            -EIO if the output header cannot be written.
+ =========================================================================== **/
+static int Csv_bindHeader(csv_state_t* state, const char** cursor, const char* end)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    const char* line        = *cursor;
+    const char* walker      = *cursor;
+    const char* name        = NULL;
+    size_t length           = 0u;
+    size_t column           = 0u;
+    uint32_t slot           = 0u;
+    int more                = 1;
+
+    /*< Start Function Algorithm >*/
+    for (state->column_count = 0u; more != 0; state->column_count++)
+    {
+        more = Csv_nextField(state->scan, &walker, end, state->options.delimiter, &name, &length);
+    }
+
+    state->column_slot = Alloc_malloc(state->column_count * sizeof(int));
+    if (state->column_slot == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    for (column = 0u; column < state->column_count; column++)
+    {
+        state->column_slot[column] = UNBOUND_COLUMN;
+    }
+
+    for (slot = 0u; slot < state->program->var_count; slot++)
+    {
+        walker = line;
+
+        for (column = 0u, more = 1; more != 0; column++)
+        {
+            more = Csv_nextField(state->scan, &walker, end, state->options.delimiter, &name, &length);
+
+            while ((length > 0u) && (*name == ' '))
+            {
+                name++;
+                length--;
+            }
+
+            while ((length > 0u) && (name[length - 1u] == ' '))
+            {
+                length--;
+            }
+
+            if (
+                    (state->column_slot[column] == UNBOUND_COLUMN)
+                                        &&
+                    (strlen(PROGRAM_VARIABLES(state->program)[slot]) == length)
+                                        &&
+                    (memcmp(PROGRAM_VARIABLES(state->program)[slot], name, length) == 0)
+                )
+            {
+                state->column_slot[column] = (int)slot;
+                break;
+            }
+        }
+
+        if (column == state->column_count)
+        {
+            ret = -(ENOENT);
+            goto end_of_function;
+        }
+    }
+
+    *cursor = line;
+    while (Csv_nextField(state->scan, cursor, end, state->options.delimiter, &name, &length) != 0)
+    {
+    }
+
+    if (state->options.output == CSV_OUTPUT_APPEND)
+    {
+        fwrite(line, 1u, Csv_lineLength(line, *cursor), state->output);
+        fputc(state->options.delimiter, state->output);
+    }
+
+    fputs(state->options.result_name, state->output);
+    fputc('\n', state->output);
+
+    if (ferror(state->output))
+    {
+        ret = -(EIO);
+        goto end_of_function;
+    }
+
+    state->header_done = 1;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Csv_parseRow
+  @package  csv
+
+  @brief    Parses the bound fields of one row into the current block.
+
+  @param    state   [in/out]:   Evaluation state.
+  @param    cursor  [in/out]:   Start of the row; advanced past it.
+  @param    end     [in]:       End of the chunk.
+ =========================================================================== **/
+static void Csv_parseRow(csv_state_t* state, const char** cursor, const char* end)
+{
+    const char* line    = *cursor;
+    const char* value   = NULL;
+    size_t length       = 0u;
+    size_t column       = 0u;
+    size_t row          = state->rows;
+    uint32_t parsed     = 0u;
+    int slot            = UNBOUND_COLUMN;
+    int more            = 1;
+
+    for (column = 0u; more != 0; column++)
+    {
+        more = Csv_nextField(state->scan, cursor, end, state->options.delimiter, &value, &length);
+
+        slot = (column < state->column_count) ? state->column_slot[column] : UNBOUND_COLUMN;
+        if (
+                (slot != UNBOUND_COLUMN)
+                        &&
+                (Csv_parseDouble(value, length, &state->values[((size_t)slot * CSV_BLOCK_ROWS) + row]) == FUNCTION_SUCCESS)
+            )
+        {
+            parsed++;
+        }
+    }
+
+    state->lines[row]           = line;
+    state->lengths[row]         = Csv_lineLength(line, *cursor);
+    state->parse_status[row]    = (parsed == state->program->var_count) ? FUNCTION_SUCCESS : -(EINVAL);
+
+    /*< Empty lines are not rows >*/
+    if (state->lengths[row] > 0u)
+    {
+        state->rows++;
+    }
+}
+
+/** ============================================================================
+  @fn       Csv_flushBlock
+  @package  csv
+
+  @brief    Evaluates the gathered rows and writes their results.
+
+  @param    state   [in/out]:   Evaluation state.
+
+  @return   0 on success.
+            -ENOMEM if the evaluation cannot allocate its stack.
+            -EIO if the output cannot be written.
+ =========================================================================== **/
+static int Csv_flushBlock(csv_state_t* state)
+{
+    /*< Variable Declarations >*/
+    int ret                         = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t row                      = 0u;
+    int length                      = 0;
+    char text[FORMAT_DOUBLE_SIZE];
+
+    /*< Security Checks >*/
+    if (state->rows == 0u)
+    {
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    ret = Program_evaluateBlock(state->program, state->columns, state->rows, state->results, state->status);
+    if (ret < 0)
+    {
+        goto end_of_function;
+    }
+
+    ret = FUNCTION_SUCCESS;
+
+    for (row = 0u; row < state->rows; row++)
+    {
+        if (state->options.output == CSV_OUTPUT_APPEND)
+        {
+            fwrite(state->lines[row], 1u, state->lengths[row], state->output);
+            fputc(state->options.delimiter, state->output);
+        }
+
+        if ((state->parse_status[row] != FUNCTION_SUCCESS) || (state->status[row] != FUNCTION_SUCCESS))
+        {
+            fwrite("nan\n", 1u, 4u, state->output);
+            state->failed++;
+            continue;
+        }
+
+        length = Format_double(state->results[row], text);
+        text[length++] = '\n';
+        fwrite(text, 1u, (size_t)length, state->output);
+    }
+
+    state->rows = 0u;
+
+    if (ferror(state->output))
+    {
+        ret = -(EIO);
+        goto end_of_function;
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Csv_processLines
+  @package  csv
+
+  @brief    Consumes complete lines of a chunk.
+
+  @param    state   [in/out]:   Evaluation state.
+  @param    data    [in]:       Start of the lines.
+  @param    length  [in]:       Length of the lines.
+
+  @return   0 on success, or a negative errno from the header or the block
+            flush.
+ =========================================================================== **/
+static int Csv_processLines(csv_state_t* state, const char* data, size_t length)
+{
+    int ret             = FUNCTION_SUCCESS;
+
+    const char* cursor  = data;
+    const char* end     = data + length;
+
+    while ((cursor < end) && (ret == FUNCTION_SUCCESS))
+    {
+        if (state->header_done == 0)
+        {
+            ret = Csv_bindHeader(state, &cursor, end);
+            continue;
+        }
+
+        Csv_parseRow(state, &cursor, end);
+
+        if (state->rows == CSV_BLOCK_ROWS)
+        {
+            ret = Csv_flushBlock(state);
+        }
+    }
+
+    /*< Rows point into the chunk, which is about to be reused >*/
+    if (ret == FUNCTION_SUCCESS)
+    {
+        ret = Csv_flushBlock(state);
+    }
+
+    return ret;
+}
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS DEFINITION      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Csv_evaluate
+  @package  csv
+
+  @brief    Evaluates a formula over every row of a CSV file.
+
+  @param    input_path  [in]:   CSV file whose first line is the header.
+  @param    output_path [in]:   Output CSV file.
+  @param    expression  [in]:   Infix formula; its variables name columns.
+  @param    options     [in]:   Settings, or NULL for ',' as delimiter,
+                                CSV_DEFAULT_CHUNK_SIZE, CSV_OUTPUT_APPEND and
+                                "result" as column name.
+
+  @return   Number of failed rows on success, saturated at INT_MAX.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -ENOENT if the input cannot be opened or a variable has no
+            column.
+            -EINVAL if the formula is invalid, an option is out of range or
+            a line is longer than the chunk size.
+            -EIO if reading or writing fails.
+ =========================================================================== **/
+int Csv_evaluate(const char* input_path, const char* output_path, const char* expression, const csv_options_t* options)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    FILE* input             = NULL;
+    char* buffer            = NULL;
+    const char* last        = NULL;
+
+    size_t filled           = 0u;
+    size_t usable           = 0u;
+    size_t got              = 0u;
+    uint32_t slot           = 0u;
+    int at_end              = 0;
+
+    csv_state_t state       = {0};
+
+    /*< Security Checks >*/
+    if ((input_path == NULL) || (output_path == NULL) || (expression == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    state.options.delimiter     = ',';
+    state.options.chunk_size    = CSV_DEFAULT_CHUNK_SIZE;
+    state.options.output        = CSV_OUTPUT_APPEND;
+    state.options.result_name   = "result";
+
+    if (options != NULL)
+    {
+        state.options = *options;
+    }
+
+    if (
+            (state.options.chunk_size == 0u)
+                        ||
+            (state.options.output >= CSV_OUTPUT_COUNT)
+                        ||
+            (state.options.result_name == NULL)
+                        ||
+            (state.options.delimiter == '\n')
+                        ||
+            (state.options.delimiter == '"')
+        )
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    ret = Program_compile(expression, &state.program);
+    if (ret != FUNCTION_SUCCESS)
+    {
+        goto end_of_function;
+    }
+
+    buffer              = Alloc_malloc(state.options.chunk_size);
+    state.values        = Alloc_malloc(((size_t)state.program->var_count * CSV_BLOCK_ROWS * sizeof(double)) + 1u);
+    state.columns       = Alloc_malloc(((size_t)state.program->var_count * sizeof(double*)) + 1u);
+    state.results       = Alloc_malloc(CSV_BLOCK_ROWS * sizeof(double));
+    state.status        = Alloc_malloc(CSV_BLOCK_ROWS * sizeof(int));
+    state.parse_status  = Alloc_malloc(CSV_BLOCK_ROWS * sizeof(int));
+    state.lines         = Alloc_malloc(CSV_BLOCK_ROWS * sizeof(const char*));
+    state.lengths       = Alloc_malloc(CSV_BLOCK_ROWS * sizeof(size_t));
+
+    if (
+            (buffer == NULL) || (state.values == NULL) || (state.columns == NULL)
+                                        ||
+            (state.results == NULL) || (state.status == NULL) || (state.parse_status == NULL)
+                                        ||
+            (state.lines == NULL) || (state.lengths == NULL)
+        )
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    for (slot = 0u; slot < state.program->var_count; slot++)
+    {
+        state.columns[slot] = &state.values[(size_t)slot * CSV_BLOCK_ROWS];
+    }
+
+    input = fopen(input_path, "rb");
+    if (input == NULL)
+    {
+        ret = -(ENOENT);
+        goto end_of_function;
+    }
+
+    state.scan   = Csv_selectScan();
+    state.output = fopen(output_path, "wb");
+    if (state.output == NULL)
+    {
+        ret = -(EIO);
+        goto end_of_function;
+    }
+
+    setvbuf(state.output, NULL, _IOFBF, OUTPUT_BUFFER_SIZE);
+
+    /*< Start Function Algorithm >*/
+    while (at_end == 0)
+    {
+        got     = fread(&buffer[filled], 1u, state.options.chunk_size - filled, input);
+        filled += got;
+
+        if (ferror(input))
+        {
+            ret = -(EIO);
+            goto end_of_function;
+        }
+
+        at_end = feof(input);
+
+        /*< Cut after the last complete line; the final line needs no newline >*/
+        if (at_end != 0)
+        {
+            usable = filled;
+        }
+        else
+        {
+            for (last = &buffer[filled]; (last > buffer) && (last[-1] != '\n'); last--)
+            {
+            }
+
+            if (last == buffer)
+            {
+                if (filled == state.options.chunk_size)
+                {
+                    ret = -(EINVAL);
+                    goto end_of_function;
+                }
+                continue;
+            }
+
+            usable = (size_t)(last - buffer);
+        }
+
+        ret = Csv_processLines(&state, buffer, usable);
+        if (ret != FUNCTION_SUCCESS)
+        {
+            goto end_of_function;
+        }
+
+        memmove(buffer, &buffer[usable], filled - usable);
+        filled -= usable;
+    }
+
+    if ((state.header_done == 0) && (state.program->var_count > 0u))
+    {
+        ret = -(ENOENT);
+        goto end_of_function;
+    }
+
+    if (fflush(state.output) != 0)
+    {
+        ret = -(EIO);
+        goto end_of_function;
+    }
+
+    ret = (state.failed > (size_t)INT_MAX) ? INT_MAX : (int)state.failed;
+
+    /*< Function Output >*/
+end_of_function:
+    if (input != NULL)
+    {
+        fclose(input);
+    }
+    if ((state.output != NULL) && (fclose(state.output) != 0) && (ret >= 0))
+    {
+        ret = -(EIO);
+    }
+    Alloc_free(buffer);
+    Alloc_free(state.values);
+    Alloc_free(state.columns);
+    Alloc_free(state.results);
+    Alloc_free(state.status);
+    Alloc_free(state.parse_status);
+    Alloc_free(state.lines);
+    Alloc_free(state.lengths);
+    Alloc_free(state.column_slot);
+    Program_destroy(state.program);
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Csv_parseDouble
+  @package  csv
+
+  @brief    Parses a decimal number that is not NUL-terminated.
+
+  @details  Numbers whose significant digits form an integer of at most
+            2^53 and whose decimal exponent is within +/-22 are converted
+            exactly with one multiplication or division by a power of ten.
+            Anything else (larger mantissas, extreme exponents, "inf",
+            "nan", hexadecimal) falls back to strtod_l in the "C" locale on a private copy, so
+            the result never depends on LC_NUMERIC. Leading and trailing
+            spaces are ignored.
+
+  @param    text    [in]:   Start of the field.
+  @param    length  [in]:   Length of the field.
+  @param    value   [out]:  Receives the number.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or the "C" locale cannot be
+            created.
+            -EINVAL if the field is not a number.
+ =========================================================================== **/
+int Csv_parseDouble(const char* text, size_t length, double* value)
+{
+    /*< Variable Declarations >*/
+    int ret                     = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    const char* cursor          = text;
+    const char* end             = NULL;
+    char* stop                  = NULL;
+
+    uint64_t mantissa           = 0u;
+    int digits                  = 0;
+    int exponent                = 0;
+    int exponent_value          = 0;
+    int exponent_negative       = 0;
+    int negative                = 0;
+    int seen_digit              = 0;
+    int exact                   = 1;
+
+    double number               = 0.0;
+    char copy[MAX_NUMBER_TEXT];
+
+    /*< Security Checks >*/
+    if ((text == NULL) || (value == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    end = text + length;
+
+    while ((cursor < end) && ((*cursor == ' ') || (*cursor == '\t')))
+    {
+        cursor++;
+    }
+
+    while ((end > cursor) && ((end[-1] == ' ') || (end[-1] == '\t')))
+    {
+        end--;
+    }
+
+    if (cursor == end)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    text    = cursor;
+    length  = (size_t)(end - cursor);
+
+    /*< Start Function Algorithm >*/
+    if ((*cursor == '-') || (*cursor == '+'))
+    {
+        negative = (*cursor == '-');
+        cursor++;
+    }
+
+    for (; (cursor < end) && (*cursor >= '0') && (*cursor <= '9'); cursor++)
+    {
+        seen_digit = 1;
+
+        if ((mantissa == 0u) && (*cursor == '0'))
+        {
+            continue;
+        }
+
+        if (digits < MAX_FAST_DIGITS)
+        {
+            mantissa = (mantissa * 10u) + (uint64_t)(*cursor - '0');
+            digits++;
+        }
+        else
+        {
+            exponent++;
+            exact = 0;
+        }
+    }
+
+    if ((cursor < end) && (*cursor == '.'))
+    {
+        for (cursor++; (cursor < end) && (*cursor >= '0') && (*cursor <= '9'); cursor++)
+        {
+            seen_digit = 1;
+
+            if ((mantissa == 0u) && (*cursor == '0'))
+            {
+                exponent--;
+                continue;
+            }
+
+            if (digits < MAX_FAST_DIGITS)
+            {
+                mantissa = (mantissa * 10u) + (uint64_t)(*cursor - '0');
+                digits++;
+                exponent--;
+            }
+            else
+            {
+                exact = 0;
+            }
+        }
+    }
+
+    if (seen_digit && (cursor < end) && ((*cursor == 'e') || (*cursor == 'E')))
+    {
+        cursor++;
+
+        if ((cursor < end) && ((*cursor == '-') || (*cursor == '+')))
+        {
+            exponent_negative = (*cursor == '-');
+            cursor++;
+        }
+
+        if ((cursor == end) || (*cursor < '0') || (*cursor > '9'))
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+
+        for (; (cursor < end) && (*cursor >= '0') && (*cursor <= '9'); cursor++)
+        {
+            exponent_value = (exponent_value < 100000) ? ((exponent_value * 10) + (*cursor - '0')) : exponent_value;
+        }
+
+        exponent += exponent_negative ? -exponent_value : exponent_value;
+    }
+
+    if (
+            seen_digit && exact && (cursor == end)
+                            &&
+            (mantissa <= MAX_EXACT_MANTISSA)
+                            &&
+            (exponent >= -MAX_EXACT_POWER) && (exponent <= MAX_EXACT_POWER)
+        )
+    {
+        number = (double)mantissa;
+        number = (exponent < 0) ? (number / exact_powers[-exponent]) : (number * exact_powers[exponent]);
+
+        *value = negative ? -number : number;
+        goto end_of_function;
+    }
+
+    /*< Slow path: anything the exact path cannot represent >*/
+    if (length >= MAX_NUMBER_TEXT)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    (void)pthread_once(&csv_locale_once, Csv_createLocale);
+    if (csv_c_locale == (locale_t)0)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    memcpy(copy, text, length);
+    copy[length] = '\0';
+
+    number = strtod_l(copy, &stop, csv_c_locale);
+    if ((stop == copy) || (*stop != '\0'))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    *value = number;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/*< end of file >*/
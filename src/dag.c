@@ -0,0 +1,838 @@
+/** ===========================================================================
+    @ingroup    Dag
+    @addtogroup Dag_Module dag
+
+    @package    dag
+    @brief      This module compiles a batch of expressions into one program
+                in which the subexpressions they share are computed once.
+
+    @file       dag.c
+    @headerfile dag.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    Nodes are appended in the order the replay creates them, so
+                the arguments of a node always come before it and the node
+                array is already in evaluation order. Lookups go through an
+                open-addressing table keyed by a 64-bit FNV-1a hash of the
+                node, with equal hashes confirmed field by field. Constants
+                are keyed by their bit pattern, so 0 and -0 stay apart.
+
+    @see        - Dag_compile
+                - Dag_program
+                - Dag_evaluateBlock
+                - Dag_destroy
+ =========================================================================== **/
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <limits.h>
+#include <errno.h>
+
+/*< Implements >*/
+#include <alloc.h>
+#include <plugin.h>
+#include <program.h>
+#include <dag.h>
+
+/* ==================================== *\
+ *            PRIVATE DEFINES           *
+\* ==================================== */
+
+/** ====================================
+  @def      FUNCTION_SUCCESS
+  @package  dag
+  @brief    Indicates successful function
+            execution.
+
+  @details  Represents a successful
+            operation, typically with
+            a value of 0.
+ ==================================== **/
+#define FUNCTION_SUCCESS        (int)(0)
+
+/** ====================================
+  @def      FNV_OFFSET_BASIS
+  @package  dag
+  @brief    64-bit FNV-1a offset basis.
+ ==================================== **/
+#define FNV_OFFSET_BASIS        (uint64_t)(0xcbf29ce484222325ULL)
+
+/** ====================================
+  @def      FNV_PRIME
+  @package  dag
+  @brief    64-bit FNV-1a prime.
+ ==================================== **/
+#define FNV_PRIME               (uint64_t)(0x100000001b3ULL)
+
+/** ====================================
+  @def      NO_SLOT
+  @package  dag
+  @brief    Slot of a node that is
+            emitted inline.
+ ==================================== **/
+#define NO_SLOT                 (uint32_t)(UINT32_MAX)
+
+/* ==================================== *\
+ *       PRIVATE TYPES DEFINITION       *
+\* ==================================== */
+
+/** ============================================================================
+  @struct   dag_node_t
+  @package  dag
+
+  @typedef  dag_node_t
+
+  @brief    Represents one distinct subexpression of the batch.
+ =========================================================================== **/
+typedef struct
+{
+    uint64_t    hash;       /*< Hash of opcode, key and arguments >*/
+    uint64_t    key;        /*< Operand, or the bits of a constant >*/
+    uint32_t    opcode;     /*< One of program_opcode_t >*/
+    uint32_t    operand;    /*< Operand in the shared program >*/
+    uint32_t    arity;      /*< Number of arguments >*/
+    uint32_t    first;      /*< Start of the arguments in the argument array >*/
+    uint32_t    uses;       /*< Number of parents >*/
+    uint32_t    root;       /*< Non-zero for the root of an expression >*/
+    uint32_t    slot;       /*< Local slot, or NO_SLOT >*/
+    uint32_t    reserved;   /*< Keeps the size a multiple of 8 >*/
+} dag_node_t;
+
+/** ============================================================================
+  @struct   dag_build_t
+  @package  dag
+
+  @typedef  dag_build_t
+
+  @brief    Represents the working state of Dag_compile.
+ =========================================================================== **/
+typedef struct
+{
+    dag_node_t*             nodes;          /*< Distinct nodes, arguments first >*/
+    size_t                  node_count;     /*< Number of nodes >*/
+    uint32_t*               arguments;      /*< Argument nodes of every node >*/
+    size_t                  argument_count; /*< Number of arguments >*/
+    size_t*                 table;          /*< Node index + 1 per slot, 0 marks a hole >*/
+    size_t                  capacity;       /*< Slots of the table, a power of two >*/
+    double*                 constants;      /*< Constant pool of the shared program >*/
+    size_t                  const_count;    /*< Number of constants >*/
+    char                    (*names)[MAX_TOKEN_LEN];    /*< Variable names of the shared program >*/
+    size_t                  name_count;     /*< Number of variables >*/
+    program_instr_t*        code;           /*< Instructions of the shared program >*/
+    size_t                  code_count;     /*< Number of instructions >*/
+    size_t                  depth;          /*< Current value stack depth >*/
+    size_t                  max_depth;      /*< Maximum value stack depth >*/
+} dag_build_t;
+
+/** ============================================================================
+  @struct   dag
+  @package  dag
+
+  @brief    Represents a batch of expressions compiled together.
+ =========================================================================== **/
+struct dag
+{
+    rpn_program_t*  program;    /*< Shared program >*/
+    rpn_program_t** members;    /*< Program of each expression, for failed rows >*/
+    uint32_t*       roots;      /*< Local slot of the result of each expression >*/
+    uint32_t*       bindings;   /*< Shared variable slot of every member variable slot >*/
+    size_t*         first;      /*< Start of the bindings of each expression >*/
+    size_t          count;      /*< Number of expressions >*/
+    size_t          max_vars;   /*< Most variables of any expression >*/
+};
+
+/* ==================================== *\
+ *     PRIVATE FUNCTIONS DEFINITION     *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Dag_mix
+  @package  dag
+
+  @brief    Feeds the eight bytes of a value into an FNV-1a hash.
+
+  @param    hash    [in]:   Hash so far.
+  @param    value   [in]:   Value to add.
+
+  @return   Updated hash.
+ =========================================================================== **/
+static uint64_t Dag_mix(uint64_t hash, uint64_t value)
+{
+    size_t iterator = 0u;
+
+    for (iterator = 0u; iterator < sizeof(value); iterator++)
+    {
+        hash = (hash ^ ((value >> (8u * iterator)) & 0xFFu)) * FNV_PRIME;
+    }
+
+    return hash;
+}
+
+/** ============================================================================
+  @fn       Dag_arity
+  @package  dag
+
+  @brief    Returns the number of values an instruction pops.
+
+  @param    instruction [in]:   Instruction of a compiled program, neither
+                                OPCODE_STORE nor OPCODE_LOAD.
+
+  @return   Number of arguments.
+ =========================================================================== **/
+static uint32_t Dag_arity(const program_instr_t* instruction)
+{
+    switch (instruction->opcode)
+    {
+        case OPCODE_CONST:
+        case OPCODE_VAR:
+            return 0u;
+
+        case OPCODE_FACT:
+        case OPCODE_FUNC:
+        case OPCODE_POW10:
+            return 1u;
+
+        case OPCODE_FMA:
+            return 3u;
+
+        case OPCODE_NATIVE:
+            return Plugin_get(instruction->operand)->arity;
+
+        default:
+            return 2u;
+    }
+}
+
+/** ============================================================================
+  @fn       Dag_addName
+  @package  dag
+
+  @brief    Returns the shared slot of a variable, adding it if needed.
+
+  @param    build   [in/out]:   Working state.
+  @param    name    [in]:       Variable name.
+
+  @return   Slot in the shared program.
+ =========================================================================== **/
+static uint32_t Dag_addName(dag_build_t* build, const char* name)
+{
+    size_t slot = 0u;
+
+    for (slot = 0u; slot < build->name_count; slot++)
+    {
+        if (strcmp(build->names[slot], name) == 0)
+        {
+            return (uint32_t)slot;
+        }
+    }
+
+    memset(build->names[slot], 0, MAX_TOKEN_LEN);
+    strncpy(build->names[slot], name, MAX_TOKEN_LEN - 1u);
+    build->name_count++;
+
+    return (uint32_t)slot;
+}
+
+/** ============================================================================
+  @fn       Dag_intern
+  @package  dag
+
+  @brief    Returns the node of an operation, creating it if it is new.
+
+  @details  Natives always get a new node, so a call to a native is never
+            merged with another call.
+
+  @param    build       [in/out]:   Working state.
+  @param    opcode      [in]:       Opcode of the node.
+  @param    key         [in]:       Operand, or the bits of a constant.
+  @param    arguments   [in]:       Argument nodes.
+  @param    arity       [in]:       Number of arguments.
+
+  @return   Index of the node.
+ =========================================================================== **/
+static uint32_t Dag_intern(dag_build_t* build, uint32_t opcode, uint64_t key, const uint32_t* arguments, uint32_t arity)
+{
+    uint64_t hash       = FNV_OFFSET_BASIS;
+    size_t slot         = 0u;
+    uint32_t argument   = 0u;
+    double value        = 0.0;
+
+    dag_node_t* node    = NULL;
+
+    hash = Dag_mix(Dag_mix(hash, opcode), key);
+    for (argument = 0u; argument < arity; argument++)
+    {
+        hash = Dag_mix(hash, arguments[argument]);
+    }
+
+    for (slot = (size_t)hash & (build->capacity - 1u); build->table[slot] != 0u; slot = (slot + 1u) & (build->capacity - 1u))
+    {
+        node = &build->nodes[build->table[slot] - 1u];
+        if ((opcode != OPCODE_NATIVE) && (node->hash == hash) && (node->opcode == opcode) && (node->key == key)
+                                      && (node->arity == arity)
+                                      && ((arity == 0u) || (memcmp(&build->arguments[node->first], arguments, arity * sizeof(uint32_t)) == 0)))
+        {
+            return (uint32_t)(build->table[slot] - 1u);
+        }
+    }
+
+    node            = &build->nodes[build->node_count];
+    node->hash      = hash;
+    node->key       = key;
+    node->opcode    = opcode;
+    node->operand   = (uint32_t)key;
+    node->arity     = arity;
+    node->first     = (uint32_t)build->argument_count;
+    node->uses      = 0u;
+    node->root      = 0u;
+    node->slot      = NO_SLOT;
+    node->reserved  = 0u;
+
+    for (argument = 0u; argument < arity; argument++)
+    {
+        build->arguments[build->argument_count++] = arguments[argument];
+        build->nodes[arguments[argument]].uses++;
+    }
+
+    if (opcode == OPCODE_CONST)
+    {
+        memcpy(&value, &key, sizeof(value));
+        node->operand                           = (uint32_t)build->const_count;
+        build->constants[build->const_count++]  = value;
+    }
+
+    if (opcode != OPCODE_NATIVE)
+    {
+        build->table[slot] = build->node_count + 1u;
+    }
+
+    return (uint32_t)build->node_count++;
+}
+
+/** ============================================================================
+  @fn       Dag_replay
+  @package  dag
+
+  @brief    Adds the nodes of one compiled expression to the graph.
+
+  @details  Runs the instructions on a stack of node indices instead of
+            values. Local slots of inlined user functions hold node indices
+            too, so a parameter loaded twice becomes a node with two uses.
+
+  @param    build       [in/out]:   Working state.
+  @param    member      [in]:       Compiled expression.
+  @param    bindings    [out]:      Shared slot of each variable slot of the
+                                    expression.
+  @param    root        [out]:      Receives the node of the result.
+
+  @return   0 on success.
+            -ENOMEM if the node stack cannot be allocated.
+ =========================================================================== **/
+static int Dag_replay(dag_build_t* build, const rpn_program_t* member, uint32_t* bindings, uint32_t* root)
+{
+    /*< Variable Declarations >*/
+    int ret                     = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t iterator             = 0u;
+    size_t top                  = 0u;
+    uint32_t arity              = 0u;
+    uint64_t key                = 0u;
+
+    uint32_t* stack             = NULL;
+    uint32_t* locals            = NULL;
+    const program_instr_t* code = NULL;
+
+    /*< Assign Initial Values >*/
+    code = PROGRAM_CODE(member);
+
+    stack = Alloc_malloc(((size_t)member->max_depth + member->local_count) * sizeof(uint32_t));
+    if (stack == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    locals = stack + member->max_depth;
+
+    /*< Start Function Algorithm >*/
+    for (iterator = 0u; iterator < member->var_count; iterator++)
+    {
+        bindings[iterator] = Dag_addName(build, PROGRAM_VARIABLES(member)[iterator]);
+    }
+
+    for (iterator = 0u; iterator < member->code_count; iterator++)
+    {
+        switch (code[iterator].opcode)
+        {
+            case OPCODE_STORE:
+                locals[code[iterator].operand] = stack[--top];
+                break;
+
+            case OPCODE_LOAD:
+                stack[top++] = locals[code[iterator].operand];
+                break;
+
+            case OPCODE_CONST:
+                memcpy(&key, &PROGRAM_CONSTANTS(member)[code[iterator].operand], sizeof(key));
+                stack[top++] = Dag_intern(build, OPCODE_CONST, key, NULL, 0u);
+                break;
+
+            case OPCODE_VAR:
+                stack[top++] = Dag_intern(build, OPCODE_VAR, bindings[code[iterator].operand], NULL, 0u);
+                break;
+
+            default:
+                arity       = Dag_arity(&code[iterator]);
+                top        -= arity;
+                stack[top]  = Dag_intern(build, code[iterator].opcode, code[iterator].operand, &stack[top], arity);
+                top++;
+                break;
+        }
+    }
+
+    *root                       = stack[0];
+    build->nodes[*root].root    = 1u;
+
+    /*< Function Output >*/
+end_of_function:
+    Alloc_free(stack);
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Dag_emit
+  @package  dag
+
+  @brief    Emits the instructions that compute a node.
+
+  @details  Arguments kept in a local slot are loaded; the others are
+            emitted in place, which is safe because they have no other
+            parent.
+
+  @param    build   [in/out]:   Working state.
+  @param    index   [in]:       Node to compute.
+ =========================================================================== **/
+static void Dag_emit(dag_build_t* build, uint32_t index)
+{
+    const dag_node_t* node  = &build->nodes[index];
+    const dag_node_t* child = NULL;
+    uint32_t argument       = 0u;
+
+    for (argument = 0u; argument < node->arity; argument++)
+    {
+        child = &build->nodes[build->arguments[node->first + argument]];
+
+        if (child->slot == NO_SLOT)
+        {
+            Dag_emit(build, build->arguments[node->first + argument]);
+            continue;
+        }
+
+        build->code[build->code_count].opcode   = OPCODE_LOAD;
+        build->code[build->code_count].operand  = child->slot;
+        build->code_count++;
+        build->depth++;
+        build->max_depth = (build->depth > build->max_depth) ? build->depth : build->max_depth;
+    }
+
+    build->code[build->code_count].opcode   = node->opcode;
+    build->code[build->code_count].operand  = node->operand;
+    build->code_count++;
+    build->depth     = build->depth + 1u - node->arity;
+    build->max_depth = (build->depth > build->max_depth) ? build->depth : build->max_depth;
+}
+
+/** ============================================================================
+  @fn       Dag_lower
+  @package  dag
+
+  @brief    Lowers the graph into the shared program.
+
+  @details  The roots, the nodes with several parents and the nodes whose
+            value is never used get a local slot, so each of them is
+            computed exactly once. Unused nodes come from parameters that a
+            user function ignores; they are still computed so that their
+            failures are reported as the expression alone would report them.
+
+  @param    build   [in/out]:   Working state.
+  @param    roots   [in/out]:   Root node of each expression, replaced by its
+                                local slot.
+  @param    count   [in]:       Number of expressions.
+  @param    program [out]:      Receives the newly allocated shared program.
+
+  @return   0 on success.
+            -ENOMEM if an allocation fails.
+            -EINVAL if the program outgrows the 32-bit offsets.
+ =========================================================================== **/
+static int Dag_lower(dag_build_t* build, uint32_t* roots, size_t count, rpn_program_t** program)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t iterator         = 0u;
+    size_t local_count      = 0u;
+    size_t total_size       = 0u;
+
+    dag_node_t* node        = NULL;
+    rpn_program_t* block    = NULL;
+
+    /*< Assign Initial Values >*/
+    build->code = Alloc_malloc(((2u * build->node_count) + (2u * build->argument_count)) * sizeof(program_instr_t));
+    if (build->code == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    for (iterator = 0u; iterator < build->node_count; iterator++)
+    {
+        node = &build->nodes[iterator];
+        if ((node->root == 0u) && ((node->arity == 0u) || (node->uses == 1u)))
+        {
+            continue;
+        }
+
+        Dag_emit(build, (uint32_t)iterator);
+
+        node->slot                                  = (uint32_t)local_count++;
+        build->code[build->code_count].opcode       = OPCODE_STORE;
+        build->code[build->code_count].operand      = node->slot;
+        build->code_count++;
+        build->depth--;
+    }
+
+    total_size = sizeof(rpn_program_t)
+               + (build->code_count * sizeof(program_instr_t))
+               + (build->const_count * sizeof(double))
+               + (build->name_count * MAX_TOKEN_LEN);
+
+    if (total_size > UINT32_MAX)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    block = Alloc_malloc(total_size);
+    if (block == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    block->size         = (uint32_t)total_size;
+    block->code_count   = (uint32_t)build->code_count;
+    block->const_count  = (uint32_t)build->const_count;
+    block->max_depth    = (uint32_t)build->max_depth;
+    block->code_offset  = (uint32_t)sizeof(rpn_program_t);
+    block->const_offset = (uint32_t)(sizeof(rpn_program_t) + (build->code_count * sizeof(program_instr_t)));
+    block->var_count    = (uint32_t)build->name_count;
+    block->var_offset   = (uint32_t)(block->const_offset + (build->const_count * sizeof(double)));
+    block->local_count  = (uint32_t)local_count;
+    block->reserved     = 0u;
+
+    memcpy((char*)block + block->code_offset, build->code, build->code_count * sizeof(program_instr_t));
+    memcpy((char*)block + block->const_offset, build->constants, build->const_count * sizeof(double));
+    memcpy((char*)block + block->var_offset, build->names, build->name_count * MAX_TOKEN_LEN);
+
+    for (iterator = 0u; iterator < count; iterator++)
+    {
+        roots[iterator] = build->nodes[roots[iterator]].slot;
+    }
+
+    *program = block;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS DEFINITION      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Dag_compile
+  @package  dag
+
+  @brief    Compiles a batch of expressions into one shared program.
+
+  @param    expressions [in]:   Infix expressions.
+  @param    count       [in]:   Number of expressions, at least one.
+  @param    registry    [in]:   User functions the expressions may call. May
+                                be NULL.
+  @param    dag         [out]:  Receives the newly allocated batch.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -EINVAL if count is 0 or any expression is malformed.
+ =========================================================================== **/
+int Dag_compile(const char* const* expressions, size_t count, const registry_t* registry, dag_t** dag)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t iterator     = 0u;
+    size_t total_code   = 0u;
+    size_t total_vars   = 0u;
+
+    dag_t* batch        = NULL;
+    dag_build_t build   = { 0 };
+
+    /*< Security Checks >*/
+    if ((expressions == NULL) || (dag == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if (count == 0u)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    build.capacity = 1u;
+
+    batch = Alloc_calloc(1u, sizeof(dag_t));
+    if (batch == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    batch->count    = count;
+    batch->members  = Alloc_calloc(count, sizeof(rpn_program_t*));
+    batch->roots    = Alloc_malloc(count * sizeof(uint32_t));
+    batch->first    = Alloc_malloc(count * sizeof(size_t));
+    if ((batch->members == NULL) || (batch->roots == NULL) || (batch->first == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    for (iterator = 0u; iterator < count; iterator++)
+    {
+        ret = Program_compileWith(expressions[iterator], registry, &batch->members[iterator]);
+        if (ret != FUNCTION_SUCCESS)
+        {
+            goto end_of_function;
+        }
+
+        batch->first[iterator]  = total_vars;
+        total_code             += batch->members[iterator]->code_count;
+        total_vars             += batch->members[iterator]->var_count;
+        batch->max_vars         = (batch->members[iterator]->var_count > batch->max_vars) ? batch->members[iterator]->var_count
+                                                                                          : batch->max_vars;
+    }
+
+    /*< Every instruction creates at most one node, argument and constant >*/
+    while (build.capacity < (2u * total_code))
+    {
+        build.capacity *= 2u;
+    }
+
+    batch->bindings = Alloc_malloc((total_vars + 1u) * sizeof(uint32_t));
+    build.nodes     = Alloc_malloc(total_code * sizeof(dag_node_t));
+    build.arguments = Alloc_malloc(total_code * sizeof(uint32_t));
+    build.constants = Alloc_malloc(total_code * sizeof(double));
+    build.names     = Alloc_malloc((total_vars + 1u) * MAX_TOKEN_LEN);
+    build.table     = Alloc_calloc(build.capacity, sizeof(size_t));
+    if ((batch->bindings == NULL) || (build.nodes == NULL) || (build.arguments == NULL) || (build.constants == NULL)
+                                  || (build.names == NULL) || (build.table == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    for (iterator = 0u; iterator < count; iterator++)
+    {
+        ret = Dag_replay(&build, batch->members[iterator], &batch->bindings[batch->first[iterator]], &batch->roots[iterator]);
+        if (ret != FUNCTION_SUCCESS)
+        {
+            goto end_of_function;
+        }
+    }
+
+    ret = Dag_lower(&build, batch->roots, count, &batch->program);
+
+    /*< Function Output >*/
+end_of_function:
+    if ((ret != FUNCTION_SUCCESS) && (batch != NULL))
+    {
+        Dag_destroy(batch);
+        batch = NULL;
+    }
+    if (dag != NULL)
+    {
+        *dag = batch;
+    }
+    Alloc_free(build.code);
+    Alloc_free(build.table);
+    Alloc_free(build.names);
+    Alloc_free(build.constants);
+    Alloc_free(build.arguments);
+    Alloc_free(build.nodes);
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Dag_program
+  @package  dag
+
+  @brief    Returns the shared program of a batch.
+
+  @details  Its variable table names the columns that Dag_evaluateBlock
+            expects, so Program_findVariable gives the column of a variable.
+
+  @param    dag [in]:   Compiled batch.
+
+  @return   The shared program, or NULL if dag is NULL.
+ =========================================================================== **/
+const rpn_program_t* Dag_program(const dag_t* dag)
+{
+    return (dag != NULL) ? dag->program : NULL;
+}
+
+/** ============================================================================
+  @fn       Dag_evaluateBlock
+  @package  dag
+
+  @brief    Evaluates every expression of a batch over many rows.
+
+  @param    dag         [in]:   Compiled batch.
+  @param    columns     [in]:   One column of `rows` values per variable slot
+                                of Dag_program. May be NULL when the batch
+                                has no variables.
+  @param    rows        [in]:   Number of rows.
+  @param    results     [out]:  One column of `rows` values per expression,
+                                NaN where it fails.
+  @param    status      [out]:  One column of `rows` statuses per
+                                expression, 0 or -EINVAL.
+
+  @return   Number of failed results on success, saturated at INT_MAX.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -EINVAL if variable columns are missing.
+ =========================================================================== **/
+int Dag_evaluateBlock(const dag_t* dag, const double* const* columns, size_t rows, double* const* results, int* const* status)
+{
+    /*< Variable Declarations >*/
+    int ret                         = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t row                      = 0u;
+    size_t member                   = 0u;
+    size_t slot                     = 0u;
+
+    int* failed                     = NULL;
+    double* variables               = NULL;
+    const rpn_program_t* program    = NULL;
+
+    /*< Security Checks >*/
+    if ((dag == NULL) || (results == NULL) || (status == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    for (member = 0u; member < dag->count; member++)
+    {
+        if (status[member] == NULL)
+        {
+            ret = -(ENOMEM);
+            goto end_of_function;
+        }
+    }
+
+    /*< Assign Initial Values >*/
+    failed      = Alloc_malloc((rows + 1u) * sizeof(int));
+    variables   = Alloc_malloc((dag->max_vars + 1u) * sizeof(double));
+    if ((failed == NULL) || (variables == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    ret = Program_evaluateBlockLocals(dag->program, columns, rows, dag->roots, dag->count, results, failed);
+    if (ret < FUNCTION_SUCCESS)
+    {
+        goto end_of_function;
+    }
+
+    ret = FUNCTION_SUCCESS;
+
+    /*< Rows that failed in the shared program are resolved per expression >*/
+    for (row = 0u; row < rows; row++)
+    {
+        for (member = 0u; member < dag->count; member++)
+        {
+            status[member][row] = FUNCTION_SUCCESS;
+            if (failed[row] == FUNCTION_SUCCESS)
+            {
+                continue;
+            }
+
+            program = dag->members[member];
+            for (slot = 0u; slot < program->var_count; slot++)
+            {
+                variables[slot] = columns[dag->bindings[dag->first[member] + slot]][row];
+            }
+
+            status[member][row] = Program_evaluateWith(program, variables, &results[member][row]);
+            if (status[member][row] != FUNCTION_SUCCESS)
+            {
+                results[member][row] = NAN;
+                ret += (ret < INT_MAX) ? 1 : 0;
+            }
+        }
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    Alloc_free(variables);
+    Alloc_free(failed);
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Dag_destroy
+  @package  dag
+
+  @brief    Releases a compiled batch.
+
+  @param    dag [in]:   Batch to release. NULL is ignored.
+ =========================================================================== **/
+void Dag_destroy(dag_t* dag)
+{
+    size_t iterator = 0u;
+
+    if (dag == NULL)
+    {
+        return;
+    }
+
+    for (iterator = 0u; (dag->members != NULL) && (iterator < dag->count); iterator++)
+    {
+        Program_destroy(dag->members[iterator]);
+    }
+
+    Program_destroy(dag->program);
+    Alloc_free(dag->bindings);
+    Alloc_free(dag->first);
+    Alloc_free(dag->roots);
+    Alloc_free(dag->members);
+    Alloc_free(dag);
+}
+
+/*< end of file >*/
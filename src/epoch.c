@@ -0,0 +1,359 @@
+/** ===========================================================================
+    @ingroup    Epoch
+    @addtogroup Epoch_Module epoch
+
+    @package    epoch
+    @brief      This module provides epoch based memory reclamation for data
+                shared with lock-free readers.
+
+    @file       epoch.c
+    @headerfile epoch.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    Readers announce the global epoch in a private slot before
+                touching shared data and clear it afterwards. A writer that
+                has unpublished an object advances the epoch and waits until
+                every slot is either idle or has observed the new epoch; after
+                that no reader can still hold the old object and it can be
+                released. Readers never take a lock and never wait.
+
+    @note       - Each reader thread registers once and keeps its slot for
+                  its whole lifetime.
+                - Read-side sections must not nest and must not call
+                  Epoch_synchronize.
+
+    @see        - Epoch_create
+                - Epoch_register
+                - Epoch_enter
+                - Epoch_exit
+                - Epoch_synchronize
+ =========================================================================== **/
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <sched.h>
+#include <errno.h>
+
+/*< Implements >*/
+#include <alloc.h>
+#include <epoch.h>
+
+/* ==================================== *\
+ *            PRIVATE DEFINES           *
+\* ==================================== */
+
+/** ====================================
+  @def      FUNCTION_SUCCESS
+  @package  epoch
+  @brief    Indicates successful function
+            execution.
+
+  @details  Represents a successful
+            operation, typically with
+            a value of 0.
+ ==================================== **/
+#define FUNCTION_SUCCESS        (int)(0)
+
+/** ====================================
+  @def      CACHE_LINE_SIZE
+  @package  epoch
+  @brief    Size of a cache line in
+            bytes.
+
+  @details  Reader slots are aligned
+            to it so readers never
+            share a line.
+ ==================================== **/
+#define CACHE_LINE_SIZE         (unsigned int)(64U)
+
+/** ====================================
+  @def      EPOCH_IDLE
+  @package  epoch
+  @brief    Slot value of a reader that
+            is outside any read-side
+            section.
+ ==================================== **/
+#define EPOCH_IDLE              (uint64_t)(0U)
+
+/* ==================================== *\
+ *       PRIVATE TYPES DEFINITION       *
+\* ==================================== */
+
+/** ============================================================================
+  @struct   epoch_slot_t
+  @package  epoch
+
+  @typedef  epoch_slot_t
+
+  @brief    Represents the state published by one reader.
+ =========================================================================== **/
+typedef struct
+{
+    _Alignas(CACHE_LINE_SIZE)
+    _Atomic uint64_t    epoch;      /*< Observed epoch, EPOCH_IDLE when outside >*/
+    atomic_int          in_use;     /*< Non-zero once the slot is registered >*/
+} epoch_slot_t;
+
+/** ============================================================================
+  @struct   epochDomain
+  @package  epoch
+
+  @brief    Represents a reclamation domain.
+ =========================================================================== **/
+struct epochDomain
+{
+    _Alignas(CACHE_LINE_SIZE)
+    _Atomic uint64_t    global;                         /*< Current global epoch >*/
+    epoch_slot_t        slots[MAX_EPOCH_READERS];       /*< Reader slots >*/
+};
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS DEFINITION      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Epoch_create
+  @package  epoch
+
+  @brief    Creates a reclamation domain.
+
+  @param    domain  [out]:  Receives the new domain.
+
+  @return   0 on success.
+            -ENOMEM if domain is NULL or the allocation fails.
+ =========================================================================== **/
+int Epoch_create(epoch_domain_t** domain)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    epoch_domain_t* created = NULL;
+
+    /*< Security Checks >*/
+    if (domain == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    created = Alloc_aligned(CACHE_LINE_SIZE, sizeof(epoch_domain_t));
+    if (created == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    memset(created, 0, sizeof(epoch_domain_t));
+    atomic_init(&created->global, (uint64_t)1U);
+
+    *domain = created;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Epoch_destroy
+  @package  epoch
+
+  @brief    Releases a reclamation domain.
+
+  @param    domain  [in]:   Domain to release. NULL is ignored.
+ =========================================================================== **/
+void Epoch_destroy(epoch_domain_t* domain)
+{
+    Alloc_free(domain);
+}
+
+/** ============================================================================
+  @fn       Epoch_register
+  @package  epoch
+
+  @brief    Claims a reader slot.
+
+  @param    domain  [in]:   Domain to register with.
+
+  @return   Slot index on success.
+            -ENOMEM if domain is NULL.
+            -EBUSY if all MAX_EPOCH_READERS slots are taken.
+ =========================================================================== **/
+int Epoch_register(epoch_domain_t* domain)
+{
+    /*< Variable Declarations >*/
+    int ret         = -(EBUSY); /*< Return Control >*/
+
+    size_t iterator = 0u;
+    int expected    = 0;
+
+    /*< Security Checks >*/
+    if (domain == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    for (iterator = 0u; iterator < MAX_EPOCH_READERS; iterator++)
+    {
+        expected = 0;
+
+        if (atomic_compare_exchange_strong(&domain->slots[iterator].in_use, &expected, 1))
+        {
+            atomic_store(&domain->slots[iterator].epoch, EPOCH_IDLE);
+            ret = (int)iterator;
+            goto end_of_function;
+        }
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Epoch_unregister
+  @package  epoch
+
+  @brief    Releases a reader slot claimed by Epoch_register.
+
+  @param    domain  [in]:   Domain the slot belongs to.
+  @param    slot    [in]:   Slot index returned by Epoch_register.
+ =========================================================================== **/
+void Epoch_unregister(epoch_domain_t* domain, int slot)
+{
+    if ((domain != NULL) && (slot >= 0) && (slot < (int)MAX_EPOCH_READERS))
+    {
+        atomic_store(&domain->slots[slot].epoch, EPOCH_IDLE);
+        atomic_store(&domain->slots[slot].in_use, 0);
+    }
+}
+
+/** ============================================================================
+  @fn       Epoch_enter
+  @package  epoch
+
+  @brief    Starts a read-side section.
+
+  @details  Publishes the current epoch in the reader slot. The store is
+            sequentially consistent, so it is ordered before every load of
+            shared data made inside the section.
+
+  @param    domain  [in]:   Domain the slot belongs to.
+  @param    slot    [in]:   Slot index returned by Epoch_register.
+
+  @return   0 on success.
+            -ENOMEM if domain is NULL.
+            -EINVAL if slot is out of range.
+ =========================================================================== **/
+int Epoch_enter(epoch_domain_t* domain, int slot)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    /*< Security Checks >*/
+    if (domain == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if ((slot < 0) || (slot >= (int)MAX_EPOCH_READERS))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    atomic_store(&domain->slots[slot].epoch, atomic_load(&domain->global));
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Epoch_exit
+  @package  epoch
+
+  @brief    Ends a read-side section.
+
+  @param    domain  [in]:   Domain the slot belongs to.
+  @param    slot    [in]:   Slot index returned by Epoch_register. Out of
+                            range slots are ignored.
+ =========================================================================== **/
+void Epoch_exit(epoch_domain_t* domain, int slot)
+{
+    if ((domain != NULL) && (slot >= 0) && (slot < (int)MAX_EPOCH_READERS))
+    {
+        atomic_store_explicit(&domain->slots[slot].epoch, EPOCH_IDLE, memory_order_release);
+    }
+}
+
+/** ============================================================================
+  @fn       Epoch_synchronize
+  @package  epoch
+
+  @brief    Waits for a grace period.
+
+  @details  Advances the global epoch and returns once every reader that could
+            have observed data unpublished before the call has left its
+            read-side section. Readers that entered after the advance see the
+            new epoch and are not waited for.
+
+  @param    domain  [in]:   Domain to synchronize.
+
+  @return   0 on success.
+            -ENOMEM if domain is NULL.
+ =========================================================================== **/
+int Epoch_synchronize(epoch_domain_t* domain)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t iterator     = 0u;
+    uint64_t target     = 0u;
+    uint64_t observed   = 0u;
+
+    /*< Security Checks >*/
+    if (domain == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    target = atomic_fetch_add(&domain->global, (uint64_t)1U) + 1U;
+
+    for (iterator = 0u; iterator < MAX_EPOCH_READERS; iterator++)
+    {
+        if (atomic_load_explicit(&domain->slots[iterator].in_use, memory_order_acquire) == 0)
+        {
+            continue;
+        }
+
+        observed = atomic_load(&domain->slots[iterator].epoch);
+
+        while ((observed != EPOCH_IDLE) && (observed < target))
+        {
+            sched_yield();
+            observed = atomic_load(&domain->slots[iterator].epoch);
+        }
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/*< end of file >*/
@@ -0,0 +1,629 @@
+/** ===========================================================================
+    @ingroup    Format
+    @addtogroup Format_Module format
+
+    @package    format
+    @brief      This module converts doubles to the shortest decimal text
+                that reads back as the same value.
+
+    @file       format.c
+    @headerfile format.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    Digits are generated with the Grisu2 algorithm. A double
+                v = f * 2^e and the midpoints to its neighbours are
+                normalized into 64-bit "do-it-yourself" floating point
+                values, multiplied by a cached power of ten c_k chosen so
+                the product exponent lands in [-60, -32], and the integral
+                and fractional parts of the scaled upper boundary are
+                turned into digits until the remainder falls inside the
+                rounding interval. The last digit is then nudged towards
+                the scaled value. Every step is exact integer arithmetic.
+
+    @see        - Format_double
+ =========================================================================== **/
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+
+/*< Implements >*/
+#include <format.h>
+
+/* ==================================== *\
+ *            PRIVATE DEFINES           *
+\* ==================================== */
+
+/** ====================================
+  @def      FUNCTION_SUCCESS
+  @package  format
+  @brief    Indicates successful function
+            execution.
+
+  @details  Represents a successful
+            operation, typically with
+            a value of 0.
+ ==================================== **/
+#define FUNCTION_SUCCESS        (int)(0)
+
+/** ====================================
+  @def      DOUBLE_HIDDEN_BIT
+  @package  format
+  @brief    Implicit leading bit of a
+            normal double significand.
+ ==================================== **/
+#define DOUBLE_HIDDEN_BIT       (uint64_t)(0x0010000000000000ULL)
+
+/** ====================================
+  @def      DOUBLE_FRACTION_MASK
+  @package  format
+  @brief    Stored significand bits of
+            a double.
+ ==================================== **/
+#define DOUBLE_FRACTION_MASK    (uint64_t)(0x000FFFFFFFFFFFFFULL)
+
+/** ====================================
+  @def      DOUBLE_EXPONENT_MASK
+  @package  format
+  @brief    Biased exponent bits of a
+            double.
+ ==================================== **/
+#define DOUBLE_EXPONENT_MASK    (uint64_t)(0x7FF0000000000000ULL)
+
+/** ====================================
+  @def      DOUBLE_EXPONENT_BIAS
+  @package  format
+  @brief    Exponent bias of a double,
+            significand width included.
+ ==================================== **/
+#define DOUBLE_EXPONENT_BIAS    (int)(1075)
+
+/** ====================================
+  @def      CACHED_POWER_COUNT
+  @package  format
+  @brief    Number of cached powers of
+            ten, 10^-348 to 10^340 in
+            steps of 10^8.
+ ==================================== **/
+#define CACHED_POWER_COUNT      (unsigned int)(87U)
+
+/** ====================================
+  @def      MAX_DIGITS
+  @package  format
+  @brief    Maximum number of significant
+            digits produced.
+ ==================================== **/
+#define MAX_DIGITS              (unsigned int)(18U)
+
+/** ====================================
+  @def      MAX_PLAIN_EXPONENT
+  @package  format
+  @brief    Largest decimal point position
+            written without an exponent.
+ ==================================== **/
+#define MAX_PLAIN_EXPONENT      (int)(21)
+
+/** ====================================
+  @def      MIN_PLAIN_EXPONENT
+  @package  format
+  @brief    Smallest decimal point
+            position written without an
+            exponent, exclusive.
+ ==================================== **/
+#define MIN_PLAIN_EXPONENT      (int)(-6)
+
+/* ==================================== *\
+ *       PRIVATE TYPES DEFINITION       *
+\* ==================================== */
+
+/** ============================================================================
+  @struct   diy_fp_t
+  @package  format
+
+  @typedef  diy_fp_t
+
+  @brief    Represents the value f * 2^e with a 64-bit significand.
+ =========================================================================== **/
+typedef struct
+{
+    uint64_t    f;  /*< Significand >*/
+    int         e;  /*< Binary exponent >*/
+} diy_fp_t;
+
+/* ==================================== *\
+ *  PRIVATE GLOBAL VARIABLES DEFINITION *
+\* ==================================== */
+
+/** ============================================================================
+  @var      cached_significands
+  @package  format
+
+  @brief    Normalized significands of 10^k, k = -348 + 8 * i, rounded to
+            nearest.
+ =========================================================================== **/
+static const uint64_t cached_significands[CACHED_POWER_COUNT] =
+{
+    0xfa8fd5a0081c0288ULL, 0xbaaee17fa23ebf76ULL, 0x8b16fb203055ac76ULL,
+    0xcf42894a5dce35eaULL, 0x9a6bb0aa55653b2dULL, 0xe61acf033d1a45dfULL,
+    0xab70fe17c79ac6caULL, 0xff77b1fcbebcdc4fULL, 0xbe5691ef416bd60cULL,
+    0x8dd01fad907ffc3cULL, 0xd3515c2831559a83ULL, 0x9d71ac8fada6c9b5ULL,
+    0xea9c227723ee8bcbULL, 0xaecc49914078536dULL, 0x823c12795db6ce57ULL,
+    0xc21094364dfb5637ULL, 0x9096ea6f3848984fULL, 0xd77485cb25823ac7ULL,
+    0xa086cfcd97bf97f4ULL, 0xef340a98172aace5ULL, 0xb23867fb2a35b28eULL,
+    0x84c8d4dfd2c63f3bULL, 0xc5dd44271ad3cdbaULL, 0x936b9fcebb25c996ULL,
+    0xdbac6c247d62a584ULL, 0xa3ab66580d5fdaf6ULL, 0xf3e2f893dec3f126ULL,
+    0xb5b5ada8aaff80b8ULL, 0x87625f056c7c4a8bULL, 0xc9bcff6034c13053ULL,
+    0x964e858c91ba2655ULL, 0xdff9772470297ebdULL, 0xa6dfbd9fb8e5b88fULL,
+    0xf8a95fcf88747d94ULL, 0xb94470938fa89bcfULL, 0x8a08f0f8bf0f156bULL,
+    0xcdb02555653131b6ULL, 0x993fe2c6d07b7facULL, 0xe45c10c42a2b3b06ULL,
+    0xaa242499697392d3ULL, 0xfd87b5f28300ca0eULL, 0xbce5086492111aebULL,
+    0x8cbccc096f5088ccULL, 0xd1b71758e219652cULL, 0x9c40000000000000ULL,
+    0xe8d4a51000000000ULL, 0xad78ebc5ac620000ULL, 0x813f3978f8940984ULL,
+    0xc097ce7bc90715b3ULL, 0x8f7e32ce7bea5c70ULL, 0xd5d238a4abe98068ULL,
+    0x9f4f2726179a2245ULL, 0xed63a231d4c4fb27ULL, 0xb0de65388cc8ada8ULL,
+    0x83c7088e1aab65dbULL, 0xc45d1df942711d9aULL, 0x924d692ca61be758ULL,
+    0xda01ee641a708deaULL, 0xa26da3999aef774aULL, 0xf209787bb47d6b85ULL,
+    0xb454e4a179dd1877ULL, 0x865b86925b9bc5c2ULL, 0xc83553c5c8965d3dULL,
+    0x952ab45cfa97a0b3ULL, 0xde469fbd99a05fe3ULL, 0xa59bc234db398c25ULL,
+    0xf6c69a72a3989f5cULL, 0xb7dcbf5354e9beceULL, 0x88fcf317f22241e2ULL,
+    0xcc20ce9bd35c78a5ULL, 0x98165af37b2153dfULL, 0xe2a0b5dc971f303aULL,
+    0xa8d9d1535ce3b396ULL, 0xfb9b7cd9a4a7443cULL, 0xbb764c4ca7a44410ULL,
+    0x8bab8eefb6409c1aULL, 0xd01fef10a657842cULL, 0x9b10a4e5e9913129ULL,
+    0xe7109bfba19c0c9dULL, 0xac2820d9623bf429ULL, 0x80444b5e7aa7cf85ULL,
+    0xbf21e44003acdd2dULL, 0x8e679c2f5e44ff8fULL, 0xd433179d9c8cb841ULL,
+    0x9e19db92b4e31ba9ULL, 0xeb96bf6ebadf77d9ULL, 0xaf87023b9bf0ee6bULL
+};
+
+/** ============================================================================
+  @var      cached_exponents
+  @package  format
+
+  @brief    Binary exponents matching cached_significands.
+ =========================================================================== **/
+static const int16_t cached_exponents[CACHED_POWER_COUNT] =
+{
+    -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980,
+    -954, -927, -901, -874, -847, -821, -794, -768, -741, -715,
+    -688, -661, -635, -608, -582, -555, -529, -502, -475, -449,
+    -422, -396, -369, -343, -316, -289, -263, -236, -210, -183,
+    -157, -130, -103, -77, -50, -24, 3, 30, 56, 83,
+    109, 136, 162, 189, 216, 242, 269, 295, 322, 348,
+    375, 402, 428, 455, 481, 508, 534, 561, 588, 614,
+    641, 667, 694, 720, 747, 774, 800, 827, 853, 880,
+    907, 933, 960, 986, 1013, 1039, 1066
+};
+
+/** ============================================================================
+  @var      powers_of_ten
+  @package  format
+
+  @brief    10^0 to 10^19.
+ =========================================================================== **/
+static const uint64_t powers_of_ten[] =
+{
+    1ULL,                   10ULL,                  100ULL,
+    1000ULL,                10000ULL,               100000ULL,
+    1000000ULL,             10000000ULL,            100000000ULL,
+    1000000000ULL,          10000000000ULL,         100000000000ULL,
+    1000000000000ULL,       10000000000000ULL,      100000000000000ULL,
+    1000000000000000ULL,    10000000000000000ULL,   100000000000000000ULL,
+    1000000000000000000ULL, 10000000000000000000ULL
+};
+
+/* ==================================== *\
+ *     PRIVATE FUNCTIONS DEFINITION     *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Format_multiply
+  @package  format
+
+  @brief    Multiplies two values, keeping the rounded upper 64 bits.
+
+  @param    left    [in]:   First factor.
+  @param    right   [in]:   Second factor.
+
+  @return   The product.
+ =========================================================================== **/
+static diy_fp_t Format_multiply(diy_fp_t left, diy_fp_t right)
+{
+    const uint64_t mask = 0xFFFFFFFFULL;
+
+    uint64_t a = left.f >> 32u;
+    uint64_t b = left.f & mask;
+    uint64_t c = right.f >> 32u;
+    uint64_t d = right.f & mask;
+
+    uint64_t ac = a * c;
+    uint64_t bc = b * c;
+    uint64_t ad = a * d;
+    uint64_t bd = b * d;
+
+    uint64_t middle = (bd >> 32u) + (ad & mask) + (bc & mask) + (1ULL << 31u);
+
+    return (diy_fp_t){ ac + (ad >> 32u) + (bc >> 32u) + (middle >> 32u), left.e + right.e + 64 };
+}
+
+/** ============================================================================
+  @fn       Format_normalize
+  @package  format
+
+  @brief    Shifts a non-zero value until its top bit is set.
+
+  @param    value   [in]:   Value to normalize.
+
+  @return   The normalized value.
+ =========================================================================== **/
+static diy_fp_t Format_normalize(diy_fp_t value)
+{
+    int shift = __builtin_clzll(value.f);
+
+    return (diy_fp_t){ value.f << shift, value.e - shift };
+}
+
+/** ============================================================================
+  @fn       Format_boundaries
+  @package  format
+
+  @brief    Splits a positive double and computes its rounding boundaries.
+
+  @details  The boundaries are the midpoints to the neighbouring doubles,
+            both normalized to the exponent of the upper one. The lower gap
+            is half as wide when the significand is a power of two.
+
+  @param    bits    [in]:   Bits of a finite, positive double.
+  @param    value   [out]:  Receives the double as f * 2^e.
+  @param    minus   [out]:  Receives the lower boundary.
+  @param    plus    [out]:  Receives the upper boundary.
+ =========================================================================== **/
+static void Format_boundaries(uint64_t bits, diy_fp_t* value, diy_fp_t* minus, diy_fp_t* plus)
+{
+    int biased = (int)((bits & DOUBLE_EXPONENT_MASK) >> 52u);
+
+    if (biased != 0)
+    {
+        value->f = (bits & DOUBLE_FRACTION_MASK) + DOUBLE_HIDDEN_BIT;
+        value->e = biased - DOUBLE_EXPONENT_BIAS;
+    }
+    else
+    {
+        value->f = bits & DOUBLE_FRACTION_MASK;
+        value->e = 1 - DOUBLE_EXPONENT_BIAS;
+    }
+
+    *plus = Format_normalize((diy_fp_t){ (value->f << 1u) + 1u, value->e - 1 });
+
+    if (value->f == DOUBLE_HIDDEN_BIT)
+    {
+        *minus = (diy_fp_t){ (value->f << 2u) - 1u, value->e - 2 };
+    }
+    else
+    {
+        *minus = (diy_fp_t){ (value->f << 1u) - 1u, value->e - 1 };
+    }
+
+    minus->f <<= (minus->e - plus->e);
+    minus->e   = plus->e;
+}
+
+/** ============================================================================
+  @fn       Format_cachedPower
+  @package  format
+
+  @brief    Selects the cached power of ten for a binary exponent.
+
+  @details  Picks the smallest cached 10^-k whose product with a value of
+            exponent e has an exponent of at least -60.
+
+  @param    exponent    [in]:   Binary exponent of the normalized value.
+  @param    decimal     [out]:  Receives k.
+
+  @return   The cached power 10^-k.
+ =========================================================================== **/
+static diy_fp_t Format_cachedPower(int exponent, int* decimal)
+{
+    double estimate = ((double)(-61 - exponent) * 0.30102999566398114) + 347.0;
+    int k           = (int)estimate;
+    int index       = 0;
+
+    if ((estimate - (double)k) > 0.0)
+    {
+        k++;
+    }
+
+    index       = (k >> 3) + 1;
+    *decimal    = -(-348 + (index * 8));
+
+    return (diy_fp_t){ cached_significands[index], cached_exponents[index] };
+}
+
+/** ============================================================================
+  @fn       Format_round
+  @package  format
+
+  @brief    Moves the last digit towards the scaled value.
+
+  @details  Decrements the last digit while the result stays inside the
+            rounding interval and gets closer to the exact value.
+
+  @param    digits      [in/out]:   Digits generated so far.
+  @param    length      [in]:       Number of digits.
+  @param    delta       [in]:       Width of the rounding interval.
+  @param    rest        [in]:       Distance from the digits to the upper
+                                    boundary.
+  @param    ten_kappa   [in]:       Weight of the last digit.
+  @param    distance    [in]:       Distance from the value to the upper
+                                    boundary.
+ =========================================================================== **/
+static void Format_round(char* digits, int length, uint64_t delta, uint64_t rest, uint64_t ten_kappa, uint64_t distance)
+{
+    while (
+            (rest < distance)
+                    &&
+            ((delta - rest) >= ten_kappa)
+                    &&
+            (
+                ((rest + ten_kappa) < distance)
+                            ||
+                ((distance - rest) > (rest + ten_kappa - distance))
+            )
+        )
+    {
+        digits[length - 1]--;
+        rest += ten_kappa;
+    }
+}
+
+/** ============================================================================
+  @fn       Format_generateDigits
+  @package  format
+
+  @brief    Emits the digits of the scaled upper boundary.
+
+  @param    scaled  [in]:       Scaled value.
+  @param    upper   [in]:       Scaled upper boundary.
+  @param    delta   [in]:       Width of the rounding interval.
+  @param    digits  [out]:      Receives the digits.
+  @param    length  [out]:      Receives the number of digits.
+  @param    decimal [in/out]:   Decimal exponent, adjusted by the position
+                                of the last digit.
+ =========================================================================== **/
+static void Format_generateDigits(diy_fp_t scaled, diy_fp_t upper, uint64_t delta, char* digits, int* length, int* decimal)
+{
+    const int shift         = -upper.e;
+    const uint64_t one      = 1ULL << shift;
+    const uint64_t distance = upper.f - scaled.f;
+
+    uint32_t integral       = (uint32_t)(upper.f >> shift);
+    uint64_t fraction       = upper.f & (one - 1u);
+    uint64_t rest           = 0u;
+    uint32_t digit          = 0u;
+    int kappa               = 0;
+
+    /*< Integral part: at most 10 digits >*/
+    for (kappa = 10; (kappa > 1) && (integral < powers_of_ten[kappa - 1]); kappa--)
+    {
+    }
+
+    *length = 0;
+
+    while (kappa > 0)
+    {
+        digit       = integral / (uint32_t)powers_of_ten[kappa - 1];
+        integral   %= (uint32_t)powers_of_ten[kappa - 1];
+
+        if ((digit != 0u) || (*length != 0))
+        {
+            digits[(*length)++] = (char)('0' + digit);
+        }
+
+        kappa--;
+
+        rest = ((uint64_t)integral << shift) + fraction;
+        if (rest <= delta)
+        {
+            *decimal += kappa;
+            Format_round(digits, *length, delta, rest, powers_of_ten[kappa] << shift, distance);
+            return;
+        }
+    }
+
+    /*< Fractional part >*/
+    for (;;)
+    {
+        fraction   *= 10u;
+        delta      *= 10u;
+        digit       = (uint32_t)(fraction >> shift);
+
+        if ((digit != 0u) || (*length != 0))
+        {
+            digits[(*length)++] = (char)('0' + digit);
+        }
+
+        fraction &= (one - 1u);
+        kappa--;
+
+        if (fraction < delta)
+        {
+            *decimal += kappa;
+            Format_round(digits, *length, delta, fraction, one, (-kappa < 20) ? (distance * powers_of_ten[-kappa]) : 0u);
+            return;
+        }
+    }
+}
+
+/** ============================================================================
+  @fn       Format_layout
+  @package  format
+
+  @brief    Writes digits * 10^decimal in plain or scientific notation.
+
+  @param    buffer  [out]:  Receives the text, without terminator.
+  @param    digits  [in]:   Significant digits.
+  @param    length  [in]:   Number of digits.
+  @param    decimal [in]:   Decimal exponent of the last digit.
+
+  @return   Number of characters written.
+ =========================================================================== **/
+static int Format_layout(char* buffer, const char* digits, int length, int decimal)
+{
+    int point       = length + decimal; /*< Digits before the decimal point >*/
+    int cursor      = 0;
+    int exponent    = 0;
+
+    if ((decimal >= 0) && (point <= MAX_PLAIN_EXPONENT))
+    {
+        memcpy(buffer, digits, (size_t)length);
+        memset(&buffer[length], '0', (size_t)decimal);
+        return point;
+    }
+
+    if ((point > 0) && (point <= MAX_PLAIN_EXPONENT))
+    {
+        memcpy(buffer, digits, (size_t)point);
+        buffer[point] = '.';
+        memcpy(&buffer[point + 1], &digits[point], (size_t)(length - point));
+        return length + 1;
+    }
+
+    if ((point > MIN_PLAIN_EXPONENT) && (point <= 0))
+    {
+        buffer[0] = '0';
+        buffer[1] = '.';
+        memset(&buffer[2], '0', (size_t)(-point));
+        memcpy(&buffer[2 - point], digits, (size_t)length);
+        return 2 - point + length;
+    }
+
+    buffer[cursor++] = digits[0];
+
+    if (length > 1)
+    {
+        buffer[cursor++] = '.';
+        memcpy(&buffer[cursor], &digits[1], (size_t)(length - 1));
+        cursor += length - 1;
+    }
+
+    exponent            = point - 1;
+    buffer[cursor++]    = 'e';
+    buffer[cursor++]    = (exponent < 0) ? '-' : '+';
+    exponent            = (exponent < 0) ? -exponent : exponent;
+
+    if (exponent >= 100)
+    {
+        buffer[cursor++] = (char)('0' + (exponent / 100));
+        exponent %= 100;
+    }
+
+    buffer[cursor++] = (char)('0' + (exponent / 10));
+    buffer[cursor++] = (char)('0' + (exponent % 10));
+
+    return cursor;
+}
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS DEFINITION      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Format_double
+  @package  format
+
+  @brief    Writes the shortest round-trip text of a double.
+
+  @param    value   [in]:   Value to format.
+  @param    buffer  [out]:  Receives the NUL-terminated text, at least
+                            FORMAT_DOUBLE_SIZE bytes.
+
+  @return   Number of characters written, terminator excluded.
+            -ENOMEM if buffer is NULL.
+ =========================================================================== **/
+int Format_double(double value, char* buffer)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    uint64_t bits       = 0u;
+    int sign            = 0;
+    int length          = 0;
+    int decimal         = 0;
+    char digits[MAX_DIGITS];
+
+    diy_fp_t scaled     = {0};
+    diy_fp_t minus      = {0};
+    diy_fp_t plus       = {0};
+    diy_fp_t power      = {0};
+
+    /*< Security Checks >*/
+    if (buffer == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    memcpy(&bits, &value, sizeof(bits));
+
+    sign = (int)(bits >> 63u);
+    bits &= ~(1ULL << 63u);
+
+    if (sign != 0)
+    {
+        buffer[ret++] = '-';
+    }
+
+    /*< Start Function Algorithm >*/
+    if ((bits & DOUBLE_EXPONENT_MASK) == DOUBLE_EXPONENT_MASK)
+    {
+        if ((bits & DOUBLE_FRACTION_MASK) != 0u)
+        {
+            ret = 0;
+            memcpy(buffer, "nan", 3u);
+        }
+        else
+        {
+            memcpy(&buffer[ret], "inf", 3u);
+        }
+
+        ret += 3;
+        goto end_of_function;
+    }
+
+    if (bits == 0u)
+    {
+        buffer[ret++] = '0';
+        goto end_of_function;
+    }
+
+    Format_boundaries(bits, &scaled, &minus, &plus);
+    power = Format_cachedPower(plus.e, &decimal);
+
+    scaled  = Format_multiply(Format_normalize(scaled), power);
+    plus    = Format_multiply(plus, power);
+    minus   = Format_multiply(minus, power);
+
+    /*< Shrink the interval by one ulp to absorb the multiplication error >*/
+    minus.f++;
+    plus.f--;
+
+    Format_generateDigits(scaled, plus, plus.f - minus.f, digits, &length, &decimal);
+
+    ret += Format_layout(&buffer[ret], digits, length, decimal);
+
+    /*< Function Output >*/
+end_of_function:
+    if (buffer != NULL)
+    {
+        buffer[(ret > 0) ? ret : 0] = '\0';
+    }
+    return ret;
+}
+
+/*< end of file >*/
@@ -0,0 +1,951 @@
+/** ===========================================================================
+    @ingroup    Parse
+    @addtogroup Parse_Module parse
+
+    @package    parse
+    @brief      This module converts very large infix expressions to postfix
+                on several threads.
+
+    @file       parse.c
+    @headerfile parse.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    Every phase runs one job per thread through Parse_run, which
+                starts the threads, does the first job itself and joins the
+                rest; a thread that cannot be started has its job run inline
+                instead. The prefix sums between the phases run over one
+                entry per chunk or per thread and stay sequential.
+
+                The postfix of a range of tokens is built in the scratch
+                array at the index of the first token of the range. Postfix
+                never has more tokens than its infix, so a range only writes
+                inside its own span, and stitching the pieces of a range
+                together only moves tokens towards its start.
+
+                RPNCalculator_infixToPostfix clears a full operator stack on
+                every call, so a chain of small segments is not converted one
+                segment at a time: consecutive segments are gathered into
+                runs of up to MAX_NUM_TOKENS tokens. A run that starts with
+                a left-associative operator is converted behind a dummy
+                operand, which comes out first and is dropped, leaving the
+                postfix of its segments with every operator right after its
+                right operand, which is exactly where the whole chain puts
+                it.
+
+    @see        - Parse_infixToPostfix
+ =========================================================================== **/
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <errno.h>
+
+/*< Implements >*/
+#include <alloc.h>
+#include <stackops.h>
+#include <RPNCalculator.h>
+#include <parse.h>
+
+/* ==================================== *\
+ *            PRIVATE DEFINES           *
+\* ==================================== */
+
+/** ====================================
+  @def      FUNCTION_SUCCESS
+  @package  parse
+  @brief    Indicates successful function
+            execution.
+
+  @details  Represents a successful
+            operation, typically with
+            a value of 0.
+ ==================================== **/
+#define FUNCTION_SUCCESS        (int)(0)
+
+/** ====================================
+  @def      NO_RANK
+  @package  parse
+  @brief    Rank of a token that cannot
+            split the expression.
+ ==================================== **/
+#define NO_RANK                 (int8_t)(-1)
+
+/* ==================================== *\
+ *       PRIVATE TYPES DEFINITION       *
+\* ==================================== */
+
+/** ============================================================================
+  @struct   parse_shared_t
+  @package  parse
+
+  @typedef  parse_shared_t
+
+  @brief    Represents the arrays every job of a conversion works on.
+ =========================================================================== **/
+typedef struct
+{
+    const char*     expression;                 /*< Infix text >*/
+    char            (*tokens)[MAX_TOKEN_LEN];   /*< Every infix token >*/
+    char            (*scratch)[MAX_TOKEN_LEN];  /*< Postfix of each range, at its first token >*/
+    char            (*postfix)[MAX_TOKEN_LEN];  /*< Final postfix >*/
+    int*            depths;                     /*< Bracket depth before each token >*/
+    int8_t*         ranks;                      /*< Precedence of each binary operator at depth 0 >*/
+    size_t          token_count;                /*< Number of infix tokens >*/
+    size_t          postfix_count;              /*< Number of postfix tokens >*/
+    int             best;                       /*< Rank of the operators between the spans, or NO_RANK >*/
+    int             right;                      /*< Non-zero if those operators are right-associative >*/
+} parse_shared_t;
+
+/** ============================================================================
+  @struct   parse_job_t
+  @package  parse
+
+  @typedef  parse_job_t
+
+  @brief    Represents the share of one thread in every phase.
+
+  @details  After tokenizing, each job owns a span of tokens that starts
+            at an operator between two segments, except for the first.
+ =========================================================================== **/
+typedef struct
+{
+    parse_shared_t* shared;                     /*< Arrays of the conversion >*/
+    char            (*buffer)[MAX_TOKEN_LEN];   /*< Room for 2 * MAX_NUM_TOKENS tokens >*/
+    size_t          begin;                      /*< First byte of the chunk >*/
+    size_t          end;                        /*< Byte past the chunk >*/
+    size_t          first;                      /*< First token of the chunk >*/
+    size_t          count;                      /*< Tokens of the chunk >*/
+    int             base;                       /*< Bracket depth at the start of the chunk >*/
+    int             delta;                      /*< Net bracket depth change of the chunk >*/
+    int             low;                        /*< Lowest depth reached, relative to base >*/
+    size_t          span_first;                 /*< First token of the span >*/
+    size_t          span_last;                  /*< Token past the span >*/
+    size_t          length;                     /*< Postfix tokens of the span >*/
+    size_t          operators;                  /*< Right-associative operators of the span >*/
+    size_t          offset;                     /*< Position of the span in the postfix >*/
+    size_t          operator_offset;            /*< Position of its operators in the postfix >*/
+    int             status;                     /*< 0 or the first error of the job >*/
+} parse_job_t;
+
+/* ==================================== *\
+ *     PRIVATE FUNCTIONS DEFINITION     *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Parse_isTokenChar
+  @package  parse
+
+  @brief    Checks whether a character may continue a number or identifier.
+
+  @param    character   [in]:   Character to check.
+
+  @return   Non-zero if a token may span the character.
+ =========================================================================== **/
+static int Parse_isTokenChar(char character)
+{
+    return isalnum((unsigned char)character) || (character == '_') || (character == '.');
+}
+
+/** ============================================================================
+  @fn       Parse_isOpen
+  @package  parse
+
+  @brief    Checks whether a token is an open bracket.
+
+  @param    token   [in]:   Token to check.
+
+  @return   Non-zero for '(', '[' and '{'.
+ =========================================================================== **/
+static int Parse_isOpen(const char* token)
+{
+    return (token[0] != '\0') && (strchr("([{", token[0]) != NULL) && (token[1] == '\0');
+}
+
+/** ============================================================================
+  @fn       Parse_isClose
+  @package  parse
+
+  @brief    Checks whether a token is a close bracket.
+
+  @param    token   [in]:   Token to check.
+
+  @return   Non-zero for ')', ']' and '}'.
+ =========================================================================== **/
+static int Parse_isClose(const char* token)
+{
+    return (token[0] != '\0') && (strchr(")]}", token[0]) != NULL) && (token[1] == '\0');
+}
+
+/** ============================================================================
+  @fn       Parse_rank
+  @package  parse
+
+  @brief    Returns the precedence of a token that may split a range.
+
+  @details  Only binary operators split; the factorial is postfix.
+
+  @param    token   [in]:   Token to check.
+
+  @return   Precedence of the operator, or NO_RANK.
+ =========================================================================== **/
+static int Parse_rank(const char* token)
+{
+    int index = RPNCalculator_whichOperator(token);
+
+    return ((index >= FUNCTION_SUCCESS) && (index != OP_FACT)) ? RPNCalculator_checkPrecedence(token) : NO_RANK;
+}
+
+/** ============================================================================
+  @fn       Parse_scan
+  @package  parse
+
+  @brief    Tokenizes one chunk of the text.
+
+  @details  A token belongs to the chunk it starts in. With `store` set the
+            tokens, their depths and their ranks are written from the first
+            token of the chunk on; otherwise they are only counted.
+
+  @param    job     [in/out]:   Chunk to scan.
+  @param    store   [in]:       Non-zero to store the tokens.
+
+  @return   0 on success.
+            -EINVAL if the chunk has an unknown character.
+ =========================================================================== **/
+static int Parse_scan(parse_job_t* job, int store)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    int length              = 0;
+    int depth               = 0;
+    size_t position         = 0u;
+    size_t index            = 0u;
+
+    parse_shared_t* shared  = NULL;
+    char token[MAX_TOKEN_LEN];
+
+    /*< Assign Initial Values >*/
+    shared      = job->shared;
+    position    = job->begin;
+    job->count  = 0u;
+    job->delta  = 0;
+    job->low    = 0;
+
+    /*< Start Function Algorithm >*/
+    while (position < job->end)
+    {
+        length = RPNCalculator_nextToken(shared->expression, &position, token);
+        if (length < FUNCTION_SUCCESS)
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+
+        if ((length == 0) || ((position - (size_t)length) >= job->end))
+        {
+            break;
+        }
+
+        if (store != 0)
+        {
+            index = job->first + job->count;
+            memcpy(shared->tokens[index], token, (size_t)length + 1u);
+            shared->depths[index]   = job->base + depth;
+            shared->ranks[index]    = (int8_t)(((job->base + depth) == 0) ? Parse_rank(token) : NO_RANK);
+        }
+
+        depth       += Parse_isOpen(token) ? 1 : (Parse_isClose(token) ? -1 : 0);
+        job->low     = (depth < job->low) ? depth : job->low;
+        job->count++;
+    }
+
+    job->delta = depth;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Parse_isSplit
+  @package  parse
+
+  @brief    Checks whether a token is one of the operators a chain is split
+            at.
+
+  @param    shared  [in]:   Arrays of the conversion.
+  @param    index   [in]:   Token to check.
+  @param    base    [in]:   Bracket depth of the chain.
+  @param    best    [in]:   Rank of the operators of the chain.
+
+  @return   Non-zero if the token splits the chain.
+ =========================================================================== **/
+static int Parse_isSplit(const parse_shared_t* shared, size_t index, int base, int best)
+{
+    return (shared->depths[index] == base) && (Parse_rank(shared->tokens[index]) == best);
+}
+
+/** ============================================================================
+  @fn       Parse_leaf
+  @package  parse
+
+  @brief    Converts a run of tokens with RPNCalculator_infixToPostfix.
+
+  @param    shared      [in/out]:   Arrays of the conversion.
+  @param    buffer      [in/out]:   Room for 2 * MAX_NUM_TOKENS tokens.
+  @param    first       [in]:       First token of the run.
+  @param    last        [in]:       Token past the run.
+  @param    lead        [in]:       Non-zero if the run starts with a
+                                    left-associative operator.
+  @param    position    [in]:       Where the postfix goes in the scratch
+                                    array, at most first.
+  @param    count       [out]:      Receives the number of postfix tokens.
+
+  @return   0 on success.
+            -EINVAL if the run is malformed.
+ =========================================================================== **/
+static int Parse_leaf(parse_shared_t* shared, char (*buffer)[MAX_TOKEN_LEN], size_t first, size_t last, int lead, size_t position,
+                      size_t* count)
+{
+    /*< Variable Declarations >*/
+    int ret     = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    int number  = 0;
+
+    /*< Start Function Algorithm >*/
+    if (lead == 0)
+    {
+        number = RPNCalculator_infixToPostfix(&shared->tokens[first], &shared->scratch[position], (int)(last - first));
+        if (number < FUNCTION_SUCCESS)
+        {
+            ret = number;
+            goto end_of_function;
+        }
+
+        *count = (size_t)number;
+        goto end_of_function;
+    }
+
+    /*< The dummy operand is a number, so it is always the first postfix token >*/
+    strcpy(buffer[0], "0");
+    memcpy(buffer[1], shared->tokens[first], (last - first) * MAX_TOKEN_LEN);
+
+    number = RPNCalculator_infixToPostfix(buffer, &buffer[MAX_NUM_TOKENS], (int)(last - first + 1u));
+    if (number < FUNCTION_SUCCESS)
+    {
+        ret = number;
+        goto end_of_function;
+    }
+
+    memcpy(shared->scratch[position], buffer[MAX_NUM_TOKENS + 1u], ((size_t)number - 1u) * MAX_TOKEN_LEN);
+    *count = (size_t)number - 1u;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+static int Parse_convert(parse_shared_t* shared, char (*buffer)[MAX_TOKEN_LEN], size_t first, size_t last, int base, size_t* count);
+
+/** ============================================================================
+  @fn       Parse_chain
+  @package  parse
+
+  @brief    Converts a chain of segments joined by operators of one rank.
+
+  @details  The chain may start with one of its operators, whose left
+            operand lies before the chain. Left-associative operators are
+            placed after their right operand; right-associative ones are
+            left out for the caller to append, the rightmost first.
+
+  @param    shared  [in/out]:   Arrays of the conversion.
+  @param    buffer  [in/out]:   Room for 2 * MAX_NUM_TOKENS tokens.
+  @param    first   [in]:       First token of the chain.
+  @param    last    [in]:       Token past the chain.
+  @param    base    [in]:       Bracket depth of the chain.
+  @param    best    [in]:       Rank of its operators.
+  @param    right   [in]:       Non-zero if they are right-associative.
+  @param    count   [out]:      Receives the number of postfix tokens,
+                                written at scratch[first].
+
+  @return   0 on success.
+            -EINVAL if a segment is malformed.
+ =========================================================================== **/
+static int Parse_chain(parse_shared_t* shared, char (*buffer)[MAX_TOKEN_LEN], size_t first, size_t last, int base, int best, int right,
+                       size_t* count)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t position     = 0u;
+    size_t run          = 0u;
+    size_t cursor       = 0u;
+    size_t begin        = 0u;
+    size_t end          = 0u;
+    size_t piece        = 0u;
+
+    /*< Assign Initial Values >*/
+    position    = first;
+    run         = first;
+    cursor      = first;
+
+    /*< Start Function Algorithm >*/
+    while (cursor < last)
+    {
+        begin = (Parse_isSplit(shared, cursor, base, best)) ? (cursor + 1u) : cursor;
+        for (end = begin; (end < last) && !Parse_isSplit(shared, end, base, best); end++)
+        {
+        }
+
+        /*< Grow the pending run while it fits behind a dummy operand >*/
+        if ((right == 0) && ((end - run) < MAX_NUM_TOKENS))
+        {
+            cursor = end;
+            continue;
+        }
+
+        if (cursor > run)
+        {
+            ret = Parse_leaf(shared, buffer, run, cursor, Parse_isSplit(shared, run, base, best), position, &piece);
+            if (ret != FUNCTION_SUCCESS)
+            {
+                goto end_of_function;
+            }
+
+            position   += piece;
+            run         = cursor;
+            continue;
+        }
+
+        ret = Parse_convert(shared, buffer, begin, end, base, &piece);
+        if (ret != FUNCTION_SUCCESS)
+        {
+            goto end_of_function;
+        }
+
+        memmove(&shared->scratch[position], &shared->scratch[begin], piece * MAX_TOKEN_LEN);
+        position += piece;
+
+        if ((right == 0) && (begin > cursor))
+        {
+            strcpy(shared->scratch[position++], shared->tokens[cursor]);
+        }
+
+        run     = end;
+        cursor  = end;
+    }
+
+    if (cursor > run)
+    {
+        ret = Parse_leaf(shared, buffer, run, cursor, Parse_isSplit(shared, run, base, best), position, &piece);
+        if (ret != FUNCTION_SUCCESS)
+        {
+            goto end_of_function;
+        }
+
+        position += piece;
+    }
+
+    *count = position - first;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Parse_convert
+  @package  parse
+
+  @brief    Converts a range of tokens to postfix.
+
+  @details  Ranges that fit are handed to RPNCalculator_infixToPostfix.
+            Larger ones are converted as a chain at their lowest binary
+            operators at `base` depth, or opened up as a bracketed group
+            or call whose arguments are converted in turn.
+
+  @param    shared  [in/out]:   Arrays of the conversion.
+  @param    buffer  [in/out]:   Room for 2 * MAX_NUM_TOKENS tokens.
+  @param    first   [in]:       First token of the range.
+  @param    last    [in]:       Token past the range.
+  @param    base    [in]:       Bracket depth of the range.
+  @param    count   [out]:      Receives the number of postfix tokens,
+                                written at scratch[first].
+
+  @return   0 on success.
+            -EINVAL if the range is malformed or cannot be split.
+ =========================================================================== **/
+static int Parse_convert(parse_shared_t* shared, char (*buffer)[MAX_TOKEN_LEN], size_t first, size_t last, int base, size_t* count)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    int best            = NO_RANK;
+    int rank            = NO_RANK;
+    int right           = 0;
+    size_t iterator     = 0u;
+    size_t start        = 0u;
+    size_t open         = 0u;
+    size_t position     = 0u;
+    size_t piece        = 0u;
+
+    /*< Security Checks >*/
+    if ((first >= last) || (base >= (int)MAX_STACK_SIZE))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    if ((last - first) <= MAX_NUM_TOKENS)
+    {
+        ret = Parse_leaf(shared, buffer, first, last, 0, first, count);
+        goto end_of_function;
+    }
+
+    for (iterator = first; iterator < last; iterator++)
+    {
+        rank = (shared->depths[iterator] == base) ? Parse_rank(shared->tokens[iterator]) : NO_RANK;
+        if (rank > best)
+        {
+            best    = rank;
+            right   = RPNCalculator_isRightAssociative(shared->tokens[iterator]);
+        }
+    }
+
+    if (best != NO_RANK)
+    {
+        ret = Parse_chain(shared, buffer, first, last, base, best, right, &piece);
+        if (ret != FUNCTION_SUCCESS)
+        {
+            goto end_of_function;
+        }
+
+        position = first + piece;
+
+        for (iterator = last; (right != 0) && (iterator-- > first); )
+        {
+            if (Parse_isSplit(shared, iterator, base, best))
+            {
+                strcpy(shared->scratch[position++], shared->tokens[iterator]);
+            }
+        }
+
+        *count = position - first;
+        goto end_of_function;
+    }
+
+    /*< A bracketed group, or a call whose name follows its arguments >*/
+    position    = first;
+    open        = (Parse_isOpen(shared->tokens[first])) ? first : (first + 1u);
+    if (!Parse_isOpen(shared->tokens[open]) || !Parse_isClose(shared->tokens[last - 1u])
+                                            || ((open > first) && (RPNCalculator_isVariable(shared->tokens[first]) != FUNCTION_SUCCESS)
+                                                               && (RPNCalculator_whichFunction(shared->tokens[first]) < FUNCTION_SUCCESS)))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    for (iterator = open + 1u; iterator < last; iterator++)
+    {
+        if (shared->depths[iterator] <= base)
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+    }
+
+    for (start = open + 1u, iterator = open + 1u; iterator < last; iterator++)
+    {
+        if ((iterator < (last - 1u)) && ((shared->depths[iterator] != (base + 1)) || (strcmp(shared->tokens[iterator], ",") != 0)))
+        {
+            continue;
+        }
+
+        ret = Parse_convert(shared, buffer, start, iterator, base + 1, &piece);
+        if (ret != FUNCTION_SUCCESS)
+        {
+            goto end_of_function;
+        }
+
+        memmove(&shared->scratch[position], &shared->scratch[start], piece * MAX_TOKEN_LEN);
+        position   += piece;
+        start       = iterator + 1u;
+    }
+
+    if (open > first)
+    {
+        strcpy(shared->scratch[position++], shared->tokens[first]);
+    }
+
+    *count = position - first;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Parse_countJob
+  @package  parse
+
+  @brief    Counts the tokens and the depth change of a chunk.
+
+  @param    argument    [in/out]:   Job of the thread.
+
+  @return   NULL.
+ =========================================================================== **/
+static void* Parse_countJob(void* argument)
+{
+    parse_job_t* job = argument;
+
+    job->status = Parse_scan(job, 0);
+
+    return NULL;
+}
+
+/** ============================================================================
+  @fn       Parse_fillJob
+  @package  parse
+
+  @brief    Stores the tokens of a chunk in the shared token array.
+
+  @param    argument    [in/out]:   Job of the thread.
+
+  @return   NULL.
+ =========================================================================== **/
+static void* Parse_fillJob(void* argument)
+{
+    parse_job_t* job = argument;
+
+    job->status = Parse_scan(job, 1);
+
+    return NULL;
+}
+
+/** ============================================================================
+  @fn       Parse_convertJob
+  @package  parse
+
+  @brief    Converts the span of a job.
+
+  @details  Without operators at depth 0 the first job converts the whole
+            expression and the others have empty spans.
+
+  @param    argument    [in/out]:   Job of the thread.
+
+  @return   NULL.
+ =========================================================================== **/
+static void* Parse_convertJob(void* argument)
+{
+    parse_job_t* job        = argument;
+    parse_shared_t* shared  = job->shared;
+
+    if (job->span_first == job->span_last)
+    {
+        job->length = 0u;
+    }
+    else if (shared->best == NO_RANK)
+    {
+        job->status = Parse_convert(shared, job->buffer, job->span_first, job->span_last, 0, &job->length);
+    }
+    else
+    {
+        job->status = Parse_chain(shared, job->buffer, job->span_first, job->span_last, 0, shared->best, shared->right, &job->length);
+    }
+
+    return NULL;
+}
+
+/** ============================================================================
+  @fn       Parse_stitchJob
+  @package  parse
+
+  @brief    Copies the postfix of a span, and its right-associative
+            operators, into the final postfix.
+
+  @param    argument    [in/out]:   Job of the thread.
+
+  @return   NULL.
+ =========================================================================== **/
+static void* Parse_stitchJob(void* argument)
+{
+    parse_job_t* job        = argument;
+    parse_shared_t* shared  = job->shared;
+    size_t iterator         = 0u;
+    size_t position         = job->operator_offset;
+
+    memcpy(shared->postfix[job->offset], shared->scratch[job->span_first], job->length * MAX_TOKEN_LEN);
+
+    for (iterator = job->span_last; (job->operators > 0u) && (iterator-- > job->span_first); )
+    {
+        if (Parse_isSplit(shared, iterator, 0, shared->best))
+        {
+            strcpy(shared->postfix[position++], shared->tokens[iterator]);
+        }
+    }
+
+    return NULL;
+}
+
+/** ============================================================================
+  @fn       Parse_run
+  @package  parse
+
+  @brief    Runs one phase, one job per thread.
+
+  @param    jobs    [in/out]:   Jobs of the phase.
+  @param    count   [in]:       Number of jobs.
+  @param    routine [in]:       Phase to run on each job.
+
+  @return   0 if every job succeeded, otherwise the first error.
+ =========================================================================== **/
+static int Parse_run(parse_job_t* jobs, size_t count, void* (*routine)(void*))
+{
+    size_t iterator = 0u;
+    int ret         = FUNCTION_SUCCESS;
+
+    pthread_t threads[PARSE_MAX_THREADS];
+    int started[PARSE_MAX_THREADS];
+
+    for (iterator = 1u; iterator < count; iterator++)
+    {
+        started[iterator] = (pthread_create(&threads[iterator], NULL, routine, &jobs[iterator]) == 0);
+        if (!started[iterator])
+        {
+            routine(&jobs[iterator]);
+        }
+    }
+
+    routine(&jobs[0]);
+
+    for (iterator = 0u; iterator < count; iterator++)
+    {
+        if ((iterator > 0u) && started[iterator])
+        {
+            pthread_join(threads[iterator], NULL);
+        }
+
+        ret = (ret == FUNCTION_SUCCESS) ? jobs[iterator].status : ret;
+    }
+
+    return ret;
+}
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS DEFINITION      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Parse_infixToPostfix
+  @package  parse
+
+  @brief    Converts an infix expression of any length to postfix.
+
+  @details  The length is unbounded, but nesting is not: a bracketed group
+            or function call too long for RPNCalculator_infixToPostfix is
+            opened up recursively, one level per bracket, and may sit at
+            most MAX_STACK_SIZE brackets deep.
+
+  @param    expression  [in]:   String representing the infix expression.
+  @param    threads     [in]:   Threads to use, at most PARSE_MAX_THREADS;
+                                0 uses one per online processor. Fewer are
+                                used for short expressions.
+  @param    postfix     [out]:  Receives the newly allocated postfix tokens,
+                                to be released with Alloc_free.
+  @param    count       [out]:  Receives the number of postfix tokens.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -EINVAL if the expression is malformed, nests a long group
+            deeper than MAX_STACK_SIZE, or has a part that can be neither
+            split nor handed to RPNCalculator_infixToPostfix.
+ =========================================================================== **/
+int Parse_infixToPostfix(const char* expression, size_t threads, char (**postfix)[MAX_TOKEN_LEN], size_t* count)
+{
+    /*< Variable Declarations >*/
+    int ret                             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t length                       = 0u;
+    size_t iterator                     = 0u;
+    size_t index                        = 0u;
+    size_t operands                     = 0u;
+    size_t operators                    = 0u;
+    int depth                           = 0;
+
+    char (*buffers)[MAX_TOKEN_LEN]      = NULL;
+    parse_shared_t shared               = { 0 };
+    parse_job_t jobs[PARSE_MAX_THREADS];
+
+    /*< Security Checks >*/
+    if ((expression == NULL) || (postfix == NULL) || (count == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    length              = strlen(expression);
+    shared.expression   = expression;
+    shared.best         = NO_RANK;
+
+    threads = (threads == 0u) ? (size_t)sysconf(_SC_NPROCESSORS_ONLN) : threads;
+    threads = (threads > (length / PARSE_MIN_CHUNK)) ? ((length / PARSE_MIN_CHUNK) + 1u) : threads;
+    threads = (threads > PARSE_MAX_THREADS) ? PARSE_MAX_THREADS : threads;
+    threads = (threads == 0u) ? 1u : threads;
+
+    memset(jobs, 0, sizeof(jobs));
+
+    buffers = Alloc_malloc(threads * 2u * MAX_NUM_TOKENS * MAX_TOKEN_LEN);
+    if (buffers == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Chunks end where no token can span the cut >*/
+    for (iterator = 0u; iterator < threads; iterator++)
+    {
+        jobs[iterator].shared   = &shared;
+        jobs[iterator].buffer   = &buffers[iterator * 2u * MAX_NUM_TOKENS];
+        jobs[iterator].begin    = (iterator == 0u) ? 0u : jobs[iterator - 1u].end;
+        jobs[iterator].end      = ((iterator + 1u) == threads) ? length : ((length / threads) * (iterator + 1u));
+        jobs[iterator].end      = (jobs[iterator].end < jobs[iterator].begin) ? jobs[iterator].begin : jobs[iterator].end;
+
+        while ((jobs[iterator].end > 0u) && (jobs[iterator].end < length) && Parse_isTokenChar(expression[jobs[iterator].end - 1u])
+                                                                          && Parse_isTokenChar(expression[jobs[iterator].end]))
+        {
+            jobs[iterator].end++;
+        }
+    }
+
+    /*< Start Function Algorithm >*/
+    ret = Parse_run(jobs, threads, Parse_countJob);
+    if (ret != FUNCTION_SUCCESS)
+    {
+        goto end_of_function;
+    }
+
+    /*< Exclusive prefix sum of the token counts and the bracket depths >*/
+    for (iterator = 0u; iterator < threads; iterator++)
+    {
+        jobs[iterator].first    = shared.token_count;
+        jobs[iterator].base     = depth;
+        shared.token_count     += jobs[iterator].count;
+
+        if ((depth + jobs[iterator].low) < 0)
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+
+        depth += jobs[iterator].delta;
+    }
+
+    if ((depth != 0) || (shared.token_count == 0u))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    shared.tokens   = Alloc_malloc(shared.token_count * MAX_TOKEN_LEN);
+    shared.scratch  = Alloc_malloc(shared.token_count * MAX_TOKEN_LEN);
+    shared.depths   = Alloc_malloc(shared.token_count * sizeof(int));
+    shared.ranks    = Alloc_malloc(shared.token_count * sizeof(int8_t));
+    if ((shared.tokens == NULL) || (shared.scratch == NULL) || (shared.depths == NULL) || (shared.ranks == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    ret = Parse_run(jobs, threads, Parse_fillJob);
+    if (ret != FUNCTION_SUCCESS)
+    {
+        goto end_of_function;
+    }
+
+    /*< Expressions the sequential conversion takes whole are not split >*/
+    for (iterator = 0u; (shared.token_count > MAX_NUM_TOKENS) && (iterator < shared.token_count); iterator++)
+    {
+        if (shared.ranks[iterator] > shared.best)
+        {
+            shared.best     = shared.ranks[iterator];
+            shared.right    = RPNCalculator_isRightAssociative(shared.tokens[iterator]);
+        }
+    }
+
+    /*< Each span after the first starts at an operator at depth 0 >*/
+    for (iterator = 0u, index = 0u; iterator < threads; iterator++)
+    {
+        jobs[iterator].span_first = index;
+
+        index = ((iterator + 1u) == threads) ? shared.token_count : ((shared.token_count / threads) * (iterator + 1u));
+        index = (index < jobs[iterator].span_first) ? jobs[iterator].span_first : index;
+        while ((index < shared.token_count) && ((shared.best == NO_RANK) || (shared.ranks[index] != shared.best)))
+        {
+            index++;
+        }
+
+        jobs[iterator].span_last = index;
+        jobs[iterator].operators = 0u;
+        for (operators = jobs[iterator].span_first; (shared.right != 0) && (operators < index); operators++)
+        {
+            jobs[iterator].operators += (shared.ranks[operators] == shared.best) ? 1u : 0u;
+        }
+    }
+
+    ret = Parse_run(jobs, threads, Parse_convertJob);
+    if (ret != FUNCTION_SUCCESS)
+    {
+        goto end_of_function;
+    }
+
+    /*< Exclusive prefix sums of the span lengths; right-associative operators come last, the rightmost first >*/
+    for (iterator = 0u; iterator < threads; iterator++)
+    {
+        jobs[iterator].offset   = operands;
+        operands               += jobs[iterator].length;
+    }
+
+    for (iterator = threads, operators = 0u; iterator-- > 0u; )
+    {
+        jobs[iterator].operator_offset  = operands + operators;
+        operators                      += jobs[iterator].operators;
+    }
+
+    shared.postfix_count    = operands + operators;
+    shared.postfix          = Alloc_malloc(shared.postfix_count * MAX_TOKEN_LEN);
+    if (shared.postfix == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    ret = Parse_run(jobs, threads, Parse_stitchJob);
+
+    *postfix        = shared.postfix;
+    *count          = shared.postfix_count;
+    shared.postfix  = NULL;
+
+    /*< Function Output >*/
+end_of_function:
+    Alloc_free(shared.postfix);
+    Alloc_free(shared.ranks);
+    Alloc_free(shared.depths);
+    Alloc_free(shared.scratch);
+    Alloc_free(shared.tokens);
+    Alloc_free(buffers);
+    return ret;
+}
+
+/*< end of file >*/
@@ -0,0 +1,293 @@
+/** ===========================================================================
+    @ingroup    Plugin
+    @addtogroup Plugin_Module plugin
+
+    @package    plugin
+    @brief      This module registers native C functions, loaded from shared
+                objects or linked into the host, that compiled programs call
+                by name.
+
+    @file       plugin.c
+    @headerfile plugin.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    The natives are kept in a fixed array that only grows. A
+                writer fills the next entry under a mutex and then publishes
+                it by storing the new count with release ordering, so readers
+                load the count with acquire ordering and never take the lock.
+
+    @see        - Plugin_load
+                - Plugin_register
+                - Plugin_find
+                - Plugin_get
+ =========================================================================== **/
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <dlfcn.h>
+#include <errno.h>
+
+/*< Implements >*/
+#include <RPNCalculator.h>
+#include <plugin.h>
+
+/* ==================================== *\
+ *            PRIVATE DEFINES           *
+\* ==================================== */
+
+/** ====================================
+  @def      FUNCTION_SUCCESS
+  @package  plugin
+  @brief    Indicates successful function
+            execution.
+
+  @details  Represents a successful
+            operation, typically with
+            a value of 0.
+ ==================================== **/
+#define FUNCTION_SUCCESS        (int)(0)
+
+/* ==================================== *\
+ *  PRIVATE GLOBAL VARIABLES DEFINITION *
+\* ==================================== */
+
+/** ============================================================================
+  @var      plugin_functions
+  @package  plugin
+
+  @brief    Registered natives, indexed by OPCODE_NATIVE operands.
+ =========================================================================== **/
+static plugin_function_t plugin_functions[PLUGIN_MAX_FUNCTIONS];
+
+/** ============================================================================
+  @var      plugin_count
+  @package  plugin
+
+  @brief    Number of published entries of `plugin_functions`.
+ =========================================================================== **/
+static atomic_size_t plugin_count;
+
+/** ============================================================================
+  @var      plugin_lock
+  @package  plugin
+
+  @brief    Serializes registrations.
+ =========================================================================== **/
+static pthread_mutex_t plugin_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS DEFINITION      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Plugin_register
+  @package  plugin
+
+  @brief    Registers a native function.
+
+  @details  The descriptor is copied. The name must be an identifier that is
+            neither a built-in function nor an already registered native.
+
+  @param    function    [in]:   Native to register.
+
+  @return   Index of the native on success.
+            -ENOMEM if function is NULL.
+            -EINVAL if the descriptor is invalid or the name is taken.
+            -ENOSPC if PLUGIN_MAX_FUNCTIONS natives are registered.
+ =========================================================================== **/
+int Plugin_register(const plugin_function_t* function)
+{
+    /*< Variable Declarations >*/
+    int ret         = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t count    = 0u;
+
+    /*< Security Checks >*/
+    if (function == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if ((function->scalar == NULL) || (function->arity > PLUGIN_MAX_ARITY)
+                                   || (memchr(function->name, '\0', MAX_TOKEN_LEN) == NULL)
+                                   || (RPNCalculator_isVariable(function->name) != FUNCTION_SUCCESS))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    pthread_mutex_lock(&plugin_lock);
+
+    if (Plugin_find(function->name) >= FUNCTION_SUCCESS)
+    {
+        ret = -(EINVAL);
+    }
+    else
+    {
+        count = atomic_load_explicit(&plugin_count, memory_order_relaxed);
+        if (count >= PLUGIN_MAX_FUNCTIONS)
+        {
+            ret = -(ENOSPC);
+        }
+        else
+        {
+            plugin_functions[count] = *function;
+            atomic_store_explicit(&plugin_count, count + 1u, memory_order_release);
+            ret = (int)count;
+        }
+    }
+
+    pthread_mutex_unlock(&plugin_lock);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Plugin_load
+  @package  plugin
+
+  @brief    Loads a shared object and registers its natives.
+
+  @param    path    [in]:   Path of the shared object.
+
+  @return   Number of natives registered on success.
+            -ENOMEM if path is NULL.
+            -ENOENT if the object cannot be loaded or lacks
+            PLUGIN_ENTRY_SYMBOL.
+            The error of Plugin_register for the first rejected entry; the
+            entries before it stay registered.
+ =========================================================================== **/
+int Plugin_load(const char* path)
+{
+    /*< Variable Declarations >*/
+    int ret                             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t iterator                     = 0u;
+    size_t count                        = 0u;
+
+    void* handle                        = NULL;
+    plugin_entry_t entry                = NULL;
+    const plugin_function_t* functions  = NULL;
+
+    /*< Security Checks >*/
+    if (path == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    if (handle == NULL)
+    {
+        ret = -(ENOENT);
+        goto end_of_function;
+    }
+
+    /*< POSIX guarantees that a data pointer converts to a function pointer >*/
+    *(void**)(&entry) = dlsym(handle, PLUGIN_ENTRY_SYMBOL);
+    if (entry == NULL)
+    {
+        dlclose(handle);
+        ret = -(ENOENT);
+        goto end_of_function;
+    }
+
+    functions = entry(&count);
+
+    for (iterator = 0u; (functions != NULL) && (iterator < count); iterator++)
+    {
+        ret = Plugin_register(&functions[iterator]);
+        if (ret < FUNCTION_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    /*< The handle stays open while any of its natives is registered >*/
+    if (iterator == 0u)
+    {
+        dlclose(handle);
+    }
+
+    ret = (ret < FUNCTION_SUCCESS) ? ret : (int)iterator;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Plugin_find
+  @package  plugin
+
+  @brief    Returns the index of a native.
+
+  @param    name    [in]:   Function name.
+
+  @return   Index on success.
+            -ENOMEM if name is NULL.
+            -ENOENT if no native has that name.
+ =========================================================================== **/
+int Plugin_find(const char* name)
+{
+    /*< Variable Declarations >*/
+    int ret         = -(ENOENT); /*< Return Control >*/
+
+    size_t iterator = 0u;
+    size_t count    = 0u;
+
+    /*< Security Checks >*/
+    if (name == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    count = atomic_load_explicit(&plugin_count, memory_order_acquire);
+
+    for (iterator = 0u; iterator < count; iterator++)
+    {
+        if (strcmp(plugin_functions[iterator].name, name) == 0)
+        {
+            ret = (int)iterator;
+            break;
+        }
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Plugin_get
+  @package  plugin
+
+  @brief    Returns a native by index.
+
+  @param    index   [in]:   Index returned by Plugin_register or Plugin_find.
+
+  @return   The native, or NULL if the index is not registered.
+ =========================================================================== **/
+const plugin_function_t* Plugin_get(uint32_t index)
+{
+    return (index < atomic_load_explicit(&plugin_count, memory_order_acquire)) ? &plugin_functions[index] : NULL;
+}
+
+/*< end of file >*/
@@ -0,0 +1,719 @@
+/** ===========================================================================
+    @ingroup    Pool
+    @addtogroup Pool_Module pool
+
+    @package    pool
+    @brief      This module provides a work-stealing thread pool for
+                fork-join tasks.
+
+    @file       pool.c
+    @headerfile pool.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    Deque 0 belongs to the threads outside the pool and deque i
+                to worker i. Each deque is a growable array guarded by its
+                own mutex: its owner pushes and pops at the tail, thieves
+                take from the head. Contention is limited to a thief and an
+                owner meeting on the same deque, which only happens when
+                there is little work left to share.
+
+                A worker finds its deque through a thread-local index set
+                when it starts; every other thread uses deque 0. A count of
+                queued tasks lets idle workers sleep on a condition variable
+                instead of spinning.
+
+    @see        - Pool_create
+                - Pool_spawn
+                - Pool_submit
+                - Pool_wait
+                - Pool_destroy
+ =========================================================================== **/
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <errno.h>
+
+/*< Implements >*/
+#include <alloc.h>
+#include <pool.h>
+
+/* ==================================== *\
+ *            PRIVATE DEFINES           *
+\* ==================================== */
+
+/** ====================================
+  @def      FUNCTION_SUCCESS
+  @package  pool
+  @brief    Indicates successful function
+            execution.
+
+  @details  Represents a successful
+            operation, typically with
+            a value of 0.
+ ==================================== **/
+#define FUNCTION_SUCCESS        (int)(0)
+
+/** ====================================
+  @def      CACHE_LINE_SIZE
+  @package  pool
+  @brief    Size of a cache line in
+            bytes.
+
+  @details  Deques are aligned to it
+            so workers never share a
+            line.
+ ==================================== **/
+#define CACHE_LINE_SIZE         (unsigned int)(64U)
+
+/** ====================================
+  @def      POOL_DEQUE_CAPACITY
+  @package  pool
+  @brief    Initial number of tasks a
+            deque holds.
+ ==================================== **/
+#define POOL_DEQUE_CAPACITY     (size_t)(64U)
+
+/* ==================================== *\
+ *       PRIVATE TYPES DEFINITION       *
+\* ==================================== */
+
+/** ============================================================================
+  @struct   pool_task
+  @package  pool
+
+  @brief    Represents a spawned task.
+ =========================================================================== **/
+struct pool_task
+{
+    void            (*routine)(void*);      /*< Function to run >*/
+    void*           argument;               /*< Argument of routine >*/
+    atomic_int      done;                   /*< Non-zero once routine returned >*/
+    int             detached;               /*< Non-zero if nobody waits for it >*/
+};
+
+/** ============================================================================
+  @struct   pool_deque_t
+  @package  pool
+
+  @typedef  pool_deque_t
+
+  @brief    Represents the queued tasks of one owner.
+
+  @details  Tasks live in items[head, tail); the owner works at the tail
+            and thieves at the head.
+ =========================================================================== **/
+typedef struct
+{
+    _Alignas(CACHE_LINE_SIZE)
+    pthread_mutex_t lock;                   /*< Guards every other field >*/
+    pool_task_t**   items;                  /*< Queued tasks >*/
+    size_t          head;                   /*< Oldest task >*/
+    size_t          tail;                   /*< Past the newest task >*/
+    size_t          capacity;               /*< Room of items >*/
+} pool_deque_t;
+
+/** ============================================================================
+  @struct   pool_worker_t
+  @package  pool
+
+  @typedef  pool_worker_t
+
+  @brief    Represents the start argument of a worker.
+ =========================================================================== **/
+typedef struct
+{
+    pool_t*         pool;                   /*< Pool of the worker >*/
+    size_t          index;                  /*< Deque of the worker >*/
+} pool_worker_t;
+
+/** ============================================================================
+  @struct   pool
+  @package  pool
+
+  @brief    Represents a thread pool.
+ =========================================================================== **/
+struct pool
+{
+    pool_deque_t    deques[POOL_MAX_THREADS];   /*< One deque per thread >*/
+    pool_worker_t   workers[POOL_MAX_THREADS];  /*< Start arguments >*/
+    pthread_t       threads[POOL_MAX_THREADS];  /*< Workers, from index 1 >*/
+    size_t          count;                      /*< Threads, including the waiting one >*/
+    size_t          started;                    /*< Workers started >*/
+    atomic_size_t   pending;                    /*< Tasks queued in any deque >*/
+    atomic_int      stop;                       /*< Non-zero once workers must exit >*/
+    pthread_mutex_t idle_lock;                  /*< Guards the sleep of idle workers >*/
+    pthread_cond_t  idle;                       /*< Signaled when a task is queued >*/
+};
+
+/* ==================================== *\
+ *  PRIVATE GLOBAL VARIABLES DEFINITION *
+\* ==================================== */
+
+/** ============================================================================
+  @var      pool_current
+  @package  pool
+
+  @brief    Pool the calling thread works for, NULL outside any pool.
+ =========================================================================== **/
+static _Thread_local pool_t* pool_current;
+
+/** ============================================================================
+  @var      pool_index
+  @package  pool
+
+  @brief    Deque of the calling thread in `pool_current`.
+ =========================================================================== **/
+static _Thread_local size_t pool_index;
+
+/* ==================================== *\
+ *     PRIVATE FUNCTIONS DEFINITION     *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Pool_self
+  @package  pool
+
+  @brief    Returns the deque of the calling thread.
+
+  @param    pool    [in]:   Pool in use.
+
+  @return   The deque of the worker, or 0 outside the pool.
+ =========================================================================== **/
+static size_t Pool_self(const pool_t* pool)
+{
+    return (pool_current == pool) ? pool_index : 0u;
+}
+
+/** ============================================================================
+  @fn       Pool_push
+  @package  pool
+
+  @brief    Appends a task at the tail of a deque.
+
+  @param    deque   [in/out]:   Deque to push to.
+  @param    task    [in]:       Task to queue.
+
+  @return   0 on success.
+            -ENOMEM if the deque cannot grow.
+ =========================================================================== **/
+static int Pool_push(pool_deque_t* deque, pool_task_t* task)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    pool_task_t** grown     = NULL;
+    size_t capacity         = 0u;
+
+    /*< Start Function Algorithm >*/
+    pthread_mutex_lock(&deque->lock);
+
+    if (deque->tail == deque->capacity)
+    {
+        /*< Reuse the room left by thieves before growing >*/
+        if (deque->head > 0u)
+        {
+            memmove(deque->items, &deque->items[deque->head], (deque->tail - deque->head) * sizeof(pool_task_t*));
+            deque->tail    -= deque->head;
+            deque->head     = 0u;
+        }
+        else
+        {
+            capacity    = (deque->capacity == 0u) ? POOL_DEQUE_CAPACITY : (deque->capacity * 2u);
+            grown       = Alloc_realloc(deque->items, capacity * sizeof(pool_task_t*));
+            if (grown == NULL)
+            {
+                ret = -(ENOMEM);
+                goto end_of_function;
+            }
+
+            deque->items    = grown;
+            deque->capacity = capacity;
+        }
+    }
+
+    deque->items[deque->tail++] = task;
+
+    /*< Function Output >*/
+end_of_function:
+    pthread_mutex_unlock(&deque->lock);
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Pool_pop
+  @package  pool
+
+  @brief    Removes a task from a deque.
+
+  @param    deque   [in/out]:   Deque to take from.
+  @param    owner   [in]:       Non-zero to take the newest task, zero to
+                                steal the oldest.
+
+  @return   The task, or NULL if the deque is empty.
+ =========================================================================== **/
+static pool_task_t* Pool_pop(pool_deque_t* deque, int owner)
+{
+    pool_task_t* task = NULL;
+
+    pthread_mutex_lock(&deque->lock);
+
+    if (deque->head < deque->tail)
+    {
+        task = (owner != 0) ? deque->items[--deque->tail] : deque->items[deque->head++];
+    }
+
+    if (deque->head == deque->tail)
+    {
+        deque->head = 0u;
+        deque->tail = 0u;
+    }
+
+    pthread_mutex_unlock(&deque->lock);
+
+    return task;
+}
+
+/** ============================================================================
+  @fn       Pool_take
+  @package  pool
+
+  @brief    Finds a task to run, from the own deque first, then by
+            stealing from the others in turn.
+
+  @param    pool    [in/out]:   Pool in use.
+  @param    index   [in]:       Deque of the calling thread.
+
+  @return   The task, or NULL if every deque is empty.
+ =========================================================================== **/
+static pool_task_t* Pool_take(pool_t* pool, size_t index)
+{
+    pool_task_t* task   = NULL;
+    size_t iterator     = 0u;
+
+    task = Pool_pop(&pool->deques[index], 1);
+
+    for (iterator = 1u; (task == NULL) && (iterator < pool->count); iterator++)
+    {
+        task = Pool_pop(&pool->deques[(index + iterator) % pool->count], 0);
+    }
+
+    if (task != NULL)
+    {
+        atomic_fetch_sub_explicit(&pool->pending, 1u, memory_order_relaxed);
+    }
+
+    return task;
+}
+
+/** ============================================================================
+  @fn       Pool_execute
+  @package  pool
+
+  @brief    Runs a task and publishes its completion, or releases it if
+            it is detached.
+
+  @param    task    [in/out]:   Task to run.
+ =========================================================================== **/
+static void Pool_execute(pool_task_t* task)
+{
+    task->routine(task->argument);
+
+    if (task->detached != 0)
+    {
+        Alloc_free(task);
+        return;
+    }
+
+    atomic_store_explicit(&task->done, 1, memory_order_release);
+}
+
+/** ============================================================================
+  @fn       Pool_worker
+  @package  pool
+
+  @brief    Runs tasks until the pool stops, sleeping while there are none.
+
+  @param    argument    [in]:   Start argument of the worker.
+
+  @return   NULL.
+ =========================================================================== **/
+static void* Pool_worker(void* argument)
+{
+    pool_worker_t* worker   = argument;
+    pool_t* pool            = worker->pool;
+    pool_task_t* task       = NULL;
+
+    pool_current    = pool;
+    pool_index      = worker->index;
+
+    while (1)
+    {
+        task = Pool_take(pool, worker->index);
+        if (task != NULL)
+        {
+            Pool_execute(task);
+            continue;
+        }
+
+        pthread_mutex_lock(&pool->idle_lock);
+
+        while ((atomic_load(&pool->pending) == 0u) && (atomic_load(&pool->stop) == 0))
+        {
+            pthread_cond_wait(&pool->idle, &pool->idle_lock);
+        }
+
+        pthread_mutex_unlock(&pool->idle_lock);
+
+        if (atomic_load(&pool->stop) != 0)
+        {
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+/** ============================================================================
+  @fn       Pool_queue
+  @package  pool
+
+  @brief    Creates a task and queues it on the deque of the caller.
+
+  @param    pool        [in/out]:   Pool to run the task on.
+  @param    routine     [in]:       Function to run.
+  @param    argument    [in]:       Argument passed to routine.
+  @param    detached    [in]:       Non-zero if nobody waits for the task.
+  @param    task        [out]:      Receives the task.
+
+  @return   0 on success.
+            -ENOMEM if an allocation fails.
+ =========================================================================== **/
+static int Pool_queue(pool_t* pool, void (*routine)(void*), void* argument, int detached, pool_task_t** task)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    pool_task_t* created    = NULL;
+
+    /*< Start Function Algorithm >*/
+    created = Alloc_malloc(sizeof(pool_task_t));
+    if (created == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    created->routine    = routine;
+    created->argument   = argument;
+    created->detached   = detached;
+    atomic_init(&created->done, 0);
+
+    /*< Published before the push: a detached task may be run and freed at once >*/
+    *task = created;
+
+    ret = Pool_push(&pool->deques[Pool_self(pool)], created);
+    if (ret != FUNCTION_SUCCESS)
+    {
+        *task = NULL;
+        Alloc_free(created);
+        goto end_of_function;
+    }
+
+    /*< Counted before the lock, so a worker about to sleep sees it or is woken >*/
+    atomic_fetch_add(&pool->pending, 1u);
+
+    pthread_mutex_lock(&pool->idle_lock);
+    pthread_cond_signal(&pool->idle);
+    pthread_mutex_unlock(&pool->idle_lock);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS DEFINITION      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Pool_create
+  @package  pool
+
+  @brief    Creates a thread pool.
+
+  @param    threads [in]:   Threads that run tasks, at most POOL_MAX_THREADS;
+                            0 uses one per online processor. One of them is
+                            the thread that waits, so threads - 1 workers
+                            are started.
+  @param    pool    [out]:  Receives the new pool.
+
+  @return   0 on success.
+            -ENOMEM if pool is NULL or an allocation fails.
+            -EINVAL if threads exceeds POOL_MAX_THREADS.
+            -EAGAIN if a worker cannot be started.
+ =========================================================================== **/
+int Pool_create(size_t threads, pool_t** pool)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    pool_t* created     = NULL;
+    size_t iterator     = 0u;
+    long online         = 0;
+
+    /*< Security Checks >*/
+    if (pool == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if (threads > POOL_MAX_THREADS)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    if (threads == 0u)
+    {
+        online  = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (online < 1) ? 1u : (size_t)online;
+        threads = (threads > POOL_MAX_THREADS) ? POOL_MAX_THREADS : threads;
+    }
+
+    /*< Start Function Algorithm >*/
+    created = Alloc_aligned(CACHE_LINE_SIZE, sizeof(pool_t));
+    if (created == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    memset(created, 0, sizeof(pool_t));
+    created->count = threads;
+    atomic_init(&created->pending, 0u);
+    atomic_init(&created->stop, 0);
+    pthread_mutex_init(&created->idle_lock, NULL);
+    pthread_cond_init(&created->idle, NULL);
+
+    for (iterator = 0u; iterator < threads; iterator++)
+    {
+        pthread_mutex_init(&created->deques[iterator].lock, NULL);
+        created->workers[iterator].pool     = created;
+        created->workers[iterator].index    = iterator;
+    }
+
+    for (iterator = 1u; iterator < threads; iterator++)
+    {
+        if (pthread_create(&created->threads[iterator], NULL, Pool_worker, &created->workers[iterator]) != 0)
+        {
+            ret = -(EAGAIN);
+            Pool_destroy(created);
+            goto end_of_function;
+        }
+
+        created->started = iterator;
+    }
+
+    *pool = created;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Pool_threads
+  @package  pool
+
+  @brief    Returns the number of threads that run the tasks of a pool.
+
+  @param    pool    [in]:   Pool to query.
+
+  @return   The number of threads, or 1 if pool is NULL.
+ =========================================================================== **/
+size_t Pool_threads(const pool_t* pool)
+{
+    return (pool == NULL) ? 1u : pool->count;
+}
+
+/** ============================================================================
+  @fn       Pool_spawn
+  @package  pool
+
+  @brief    Queues a task to run concurrently with the caller.
+
+  @param    pool        [in]:   Pool to run the task on.
+  @param    routine     [in]:   Function to run.
+  @param    argument    [in]:   Argument passed to routine.
+  @param    task        [out]:  Receives the task, to be passed to
+                                Pool_wait.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or an allocation fails.
+ =========================================================================== **/
+int Pool_spawn(pool_t* pool, void (*routine)(void*), void* argument, pool_task_t** task)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    /*< Security Checks >*/
+    if ((pool == NULL) || (routine == NULL) || (task == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    ret = Pool_queue(pool, routine, argument, 0, task);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Pool_submit
+  @package  pool
+
+  @brief    Queues a task that nobody waits for.
+
+  @param    pool        [in]:   Pool to run the task on.
+  @param    routine     [in]:   Function to run.
+  @param    argument    [in]:   Argument passed to routine.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or an allocation fails.
+ =========================================================================== **/
+int Pool_submit(pool_t* pool, void (*routine)(void*), void* argument)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    pool_task_t* task   = NULL;
+
+    /*< Security Checks >*/
+    if ((pool == NULL) || (routine == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    ret = Pool_queue(pool, routine, argument, 1, &task);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Pool_wait
+  @package  pool
+
+  @brief    Waits for a task, running other tasks meanwhile, and releases it.
+
+  @param    pool    [in]:   Pool the task was spawned on.
+  @param    task    [in]:   Task to wait for.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+ =========================================================================== **/
+int Pool_wait(pool_t* pool, pool_task_t* task)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    pool_task_t* other  = NULL;
+    size_t index        = 0u;
+
+    /*< Security Checks >*/
+    if ((pool == NULL) || (task == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    index = Pool_self(pool);
+
+    /*< Start Function Algorithm >*/
+    while (atomic_load_explicit(&task->done, memory_order_acquire) == 0)
+    {
+        other = Pool_take(pool, index);
+        if (other != NULL)
+        {
+            Pool_execute(other);
+            continue;
+        }
+
+        /*< The task is running on another thread >*/
+        sched_yield();
+    }
+
+    Alloc_free(task);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Pool_destroy
+  @package  pool
+
+  @brief    Runs the tasks still queued, stops the workers and releases a
+            pool.
+
+  @param    pool    [in]:   Pool to release. NULL is ignored.
+ =========================================================================== **/
+void Pool_destroy(pool_t* pool)
+{
+    pool_task_t* task   = NULL;
+    size_t iterator     = 0u;
+
+    if (pool == NULL)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&pool->idle_lock);
+    atomic_store(&pool->stop, 1);
+    pthread_cond_broadcast(&pool->idle);
+    pthread_mutex_unlock(&pool->idle_lock);
+
+    for (iterator = 1u; iterator <= pool->started; iterator++)
+    {
+        pthread_join(pool->threads[iterator], NULL);
+    }
+
+    /*< Workers leave only once the deques are empty; without workers, run what is left here >*/
+    while ((task = Pool_take(pool, 0u)) != NULL)
+    {
+        Pool_execute(task);
+    }
+
+    for (iterator = 0u; iterator < pool->count; iterator++)
+    {
+        pthread_mutex_destroy(&pool->deques[iterator].lock);
+        Alloc_free(pool->deques[iterator].items);
+    }
+
+    pthread_cond_destroy(&pool->idle);
+    pthread_mutex_destroy(&pool->idle_lock);
+    Alloc_free(pool);
+}
+
+/*< end of file >*/
@@ -0,0 +1,1694 @@
+/** ===========================================================================
+    @ingroup    Program
+    @addtogroup Program_Module program
+
+    @package    program
+    @brief      This module compiles infix expressions into compact bytecode
+                programs and evaluates them without string dispatch.
+
+    @file       program.c
+    @headerfile program.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    A program is produced once from an infix expression through
+                RPNCalculator_tokenize and RPNCalculator_infixToPostfix, and
+                the postfix tokens are lowered into fixed-size instructions
+                plus a constant pool. The whole program lives in a single
+                contiguous, pointer-free block addressed through offsets, so
+                it can be shared between threads, copied with memcpy and
+                evaluated any number of times.
+
+                Calls to user functions are inlined while lowering: the
+                arguments, already on the value stack, are popped into fresh
+                local slots, and the body instructions are appended with
+                their constants rebased, their parameters turned into local
+                loads and their free variables merged into the caller's
+                name table.
+
+    @note       - Programs are immutable after Program_compile returns, and
+                  Program_evaluate may be called concurrently on the same
+                  program from any number of threads.
+                - Evaluation errors follow RPNCalculator_evaluatePostfix:
+                  division by zero, invalid factorials and stack underflow
+                  are reported as -EINVAL.
+
+    @see        - Program_compile
+                - Program_compileWith
+                - Program_compileLength
+                - Program_evaluate
+                - Program_evaluateWith
+                - Program_evaluateBlock
+                - Program_evaluateBlockLocals
+                - Program_findVariable
+                - Program_destroy
+ =========================================================================== **/
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <limits.h>
+#include <errno.h>
+
+/*< Implements >*/
+#include <alloc.h>
+#include <RPNCalculator.h>
+#include <program.h>
+#include <registry.h>
+#include <plugin.h>
+#include <cpu.h>
+
+/* ==================================== *\
+ *            PRIVATE DEFINES           *
+\* ==================================== */
+
+/** ====================================
+  @def      FUNCTION_SUCCESS
+  @package  program
+  @brief    Indicates successful function
+            execution.
+
+  @details  Represents a successful
+            operation, typically with
+            a value of 0.
+ ==================================== **/
+#define FUNCTION_SUCCESS        (int)(0)
+
+/** ====================================
+  @def      INLINE_STACK_DEPTH
+  @package  program
+  @brief    Depth of the value stack kept
+            on the C stack during
+            evaluation.
+
+  @details  Programs deeper than this
+            allocate their value stack
+            on the heap instead.
+ ==================================== **/
+#define INLINE_STACK_DEPTH      (unsigned int)(64U)
+
+/* ==================================== *\
+ *       PRIVATE TYPES DEFINITION       *
+\* ==================================== */
+
+/** ============================================================================
+  @typedef  program_tile_t
+  @package  program
+
+  @brief    Tile evaluator of one CPU tier, see Program_evaluateTile.
+ =========================================================================== **/
+typedef void (*program_tile_t)(const rpn_program_t* program, const double* const* columns, size_t base, size_t count,
+                               double* stack, double* locals, uint8_t* failed);
+
+/* ==================================== *\
+ *  PRIVATE GLOBAL VARIABLES DEFINITION *
+\* ==================================== */
+
+/** ============================================================================
+  @var      program_functions
+  @package  program
+
+  @brief    Direct call table for OPCODE_FUNC.
+
+  @details  Maps the indices of `func_index_t` to the libm routines applied by
+            RPNCalculator_applyFunction, so evaluation never compares strings.
+ =========================================================================== **/
+static double (*const program_functions[FUNC_COUNT])(double) =
+{
+    [FUNC_SQRT]   = sqrt,
+    [FUNC_LOG]    = log10,
+    [FUNC_LN]     = log,
+    [FUNC_SIN]    = sin,
+    [FUNC_COS]    = cos,
+    [FUNC_TAN]    = tan,
+    [FUNC_COSH]   = cosh,
+    [FUNC_SINH]   = sinh,
+    [FUNC_TANH]   = tanh,
+    [FUNC_ASIN]   = asin,
+    [FUNC_ACOS]   = acos,
+    [FUNC_ATAN]   = atan,
+    [FUNC_ARCSIN] = asin,
+    [FUNC_ARCCOS] = acos,
+    [FUNC_ARCTAN] = atan
+};
+
+/* ==================================== *\
+ *     PRIVATE FUNCTIONS DEFINITION     *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Program_isNumber
+  @package  program
+
+  @brief    Checks whether a postfix token is a numeric literal.
+
+  @details  Uses the same rule as RPNCalculator_evaluatePostfix.
+
+  @param    token   [in]:   Token to check.
+
+  @return   Non-zero if the token is a number, 0 otherwise.
+ =========================================================================== **/
+static int Program_isNumber(const char* token)
+{
+    return (isdigit((unsigned char)token[0]))
+                            ||
+           ((token[0] == '.') && (isdigit((unsigned char)token[1])));
+}
+
+/** ============================================================================
+  @fn       Program_findName
+  @package  program
+
+  @brief    Looks a name up in a list of names.
+
+  @param    names   [in]:   Names collected so far.
+  @param    count   [in]:   Number of names.
+  @param    name    [in]:   Name to look up.
+
+  @return   Index of the name, or count if it is not in the list.
+ =========================================================================== **/
+static size_t Program_findName(const char* const* names, size_t count, const char* name)
+{
+    size_t iterator = 0u;
+
+    for (iterator = 0u; iterator < count; iterator++)
+    {
+        if (strcmp(names[iterator], name) == 0)
+        {
+            break;
+        }
+    }
+
+    return iterator;
+}
+
+/** ============================================================================
+  @fn       Program_addName
+  @package  program
+
+  @brief    Adds a variable name to a list unless it is already there.
+
+  @param    names   [in/out]:   Names collected so far.
+  @param    count   [in/out]:   Number of names.
+  @param    name    [in]:       Name to add.
+
+  @return   0 on success.
+            -EINVAL if the list is full.
+ =========================================================================== **/
+static int Program_addName(const char** names, size_t* count, const char* name)
+{
+    if (Program_findName(names, *count, name) < *count)
+    {
+        return FUNCTION_SUCCESS;
+    }
+
+    if (*count >= MAX_NUM_TOKENS)
+    {
+        return -(EINVAL);
+    }
+
+    names[(*count)++] = name;
+
+    return FUNCTION_SUCCESS;
+}
+
+/** ============================================================================
+  @fn       Program_findParam
+  @package  program
+
+  @brief    Returns the parameter index of a body variable.
+
+  @param    function    [in]:   User function.
+  @param    name        [in]:   Variable name of the body.
+
+  @return   Parameter index, or the arity if the name is a free variable.
+ =========================================================================== **/
+static uint32_t Program_findParam(const registry_function_t* function, const char* name)
+{
+    uint32_t param = 0u;
+
+    for (param = 0u; param < function->arity; param++)
+    {
+        if (strcmp(function->params[param], name) == 0)
+        {
+            break;
+        }
+    }
+
+    return param;
+}
+
+/** ============================================================================
+  @fn       Program_checkCalls
+  @package  program
+
+  @brief    Checks the calls of an infix token list.
+
+  @details  An identifier followed by an open bracket must name a user
+            function of the registry or a registered native and be given as
+            many arguments as it takes; any other identifier must not name
+            one. Bracketed calls to built-in functions are checked against
+            their arity as well.
+
+  @param    tokens      [in]:   Infix tokens.
+  @param    number      [in]:   Number of tokens.
+  @param    registry    [in]:   User functions, or NULL for none.
+
+  @return   0 on success.
+            -EINVAL if a call is invalid.
+ =========================================================================== **/
+static int Program_checkCalls(char tokens[][MAX_TOKEN_LEN], int number, const registry_t* registry)
+{
+    /*< Variable Declarations >*/
+    int ret                                 = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    int iterator                            = 0;
+    int cursor                              = 0;
+    int depth                               = 0;
+    int native                              = 0;
+    int call                                = 0;
+    uint32_t arguments                      = 0u;
+    uint32_t expected                       = 0u;
+    const registry_function_t* function     = NULL;
+
+    /*< Start Function Algorithm >*/
+    for (iterator = 0; iterator < number; iterator++)
+    {
+        call        = ((iterator + 1) < number) && (strchr("([{", tokens[iterator + 1][0]) != NULL);
+        function    = NULL;
+        native      = -(ENOENT);
+
+        if (RPNCalculator_isVariable(tokens[iterator]) == FUNCTION_SUCCESS)
+        {
+            function    = Registry_find(registry, tokens[iterator]);
+            native      = (function == NULL) ? Plugin_find(tokens[iterator]) : -(ENOENT);
+
+            /*< A plain identifier is a variable, a call must resolve >*/
+            if (call != ((function != NULL) || (native >= FUNCTION_SUCCESS)))
+            {
+                ret = -(EINVAL);
+                goto end_of_function;
+            }
+        }
+        else if (RPNCalculator_whichFunction(tokens[iterator]) < FUNCTION_SUCCESS)
+        {
+            continue;
+        }
+
+        if (!call)
+        {
+            continue;
+        }
+
+        expected = (function != NULL)              ? function->arity                              :
+                   (native >= FUNCTION_SUCCESS)    ? Plugin_get((uint32_t)native)->arity          :
+                                                     (uint32_t)RPNCalculator_functionArity(tokens[iterator]);
+
+        /*< "f()" has no argument, "f(a, b)" one more than its top-level commas >*/
+        arguments   = (((iterator + 2) < number) && (strchr(")]}", tokens[iterator + 2][0]) != NULL)) ? 0u : 1u;
+        depth       = 0;
+        for (cursor = iterator + 1; (cursor < number) && (arguments > 0u); cursor++)
+        {
+            if (strchr("([{", tokens[cursor][0]) != NULL)
+            {
+                depth++;
+            }
+            else if (strchr(")]}", tokens[cursor][0]) != NULL)
+            {
+                if (--depth == 0)
+                {
+                    break;
+                }
+            }
+            else if ((depth == 1) && (tokens[cursor][0] == ','))
+            {
+                arguments++;
+            }
+        }
+
+        if (arguments != expected)
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Program_emitCall
+  @package  program
+
+  @brief    Appends the inlined body of a user function call.
+
+  @details  The arguments are on the value stack, the last one on top, so
+            they are stored into the new local slots in reverse order. The
+            body is then copied with constants moved past the caller's,
+            parameters read from the argument slots, free variables mapped
+            to the caller's slots and the body's own locals moved past the
+            argument slots.
+
+  @param    function    [in]:       User function being called.
+  @param    names       [in]:       Variable names of the caller.
+  @param    var_count   [in]:       Number of caller variables.
+  @param    code        [out]:      Caller instructions.
+  @param    code_index  [in/out]:   Next free instruction.
+  @param    constants   [out]:      Caller constant pool.
+  @param    const_index [in/out]:   Next free constant.
+  @param    local_base  [in/out]:   Next free local slot.
+ =========================================================================== **/
+static void Program_emitCall(const registry_function_t* function, const char* const* names, size_t var_count,
+                             program_instr_t* code, size_t* code_index, double* constants, size_t* const_index, size_t* local_base)
+{
+    const rpn_program_t* body           = function->body;
+    const program_instr_t* body_code    = PROGRAM_CODE(body);
+
+    size_t iterator                     = 0u;
+    uint32_t param                      = 0u;
+    program_instr_t instruction         = {0};
+
+    for (param = function->arity; param > 0u; param--)
+    {
+        code[*code_index].opcode    = OPCODE_STORE;
+        code[*code_index].operand   = (uint32_t)(*local_base + param - 1u);
+        (*code_index)++;
+    }
+
+    for (iterator = 0u; iterator < body->code_count; iterator++)
+    {
+        instruction = body_code[iterator];
+
+        switch (instruction.opcode)
+        {
+            case OPCODE_CONST:
+                instruction.operand += (uint32_t)(*const_index);
+                break;
+
+            case OPCODE_VAR:
+                param = Program_findParam(function, PROGRAM_VARIABLES(body)[instruction.operand]);
+                if (param < function->arity)
+                {
+                    instruction.opcode  = OPCODE_LOAD;
+                    instruction.operand = (uint32_t)(*local_base + param);
+                }
+                else
+                {
+                    instruction.operand = (uint32_t)Program_findName(names, var_count, PROGRAM_VARIABLES(body)[instruction.operand]);
+                }
+                break;
+
+            case OPCODE_STORE:
+            case OPCODE_LOAD:
+                instruction.operand += (uint32_t)(*local_base + function->arity);
+                break;
+
+            default:
+                break;
+        }
+
+        code[(*code_index)++] = instruction;
+    }
+
+    memcpy(&constants[*const_index], PROGRAM_CONSTANTS(body), body->const_count * sizeof(double));
+
+    *const_index    += body->const_count;
+    *local_base     += function->arity + body->local_count;
+}
+
+/** ============================================================================
+  @fn       Program_lowerPostfix
+  @package  program
+
+  @brief    Lowers postfix tokens into a bytecode program.
+
+  @details  A first pass classifies every token, counts the instructions,
+            constants and local slots, collects the distinct variable names
+            and simulates the value stack to find the maximum depth and
+            reject malformed input. A second pass fills the single
+            allocation that holds the header, the instructions, the constant
+            pool and the variable names.
+
+  @param    postfix     [in]:   Array of postfix tokens.
+  @param    number      [in]:   Number of postfix tokens.
+  @param    registry    [in]:   User functions, or NULL for none.
+  @param    names       [in]:   Scratch for MAX_NUM_TOKENS variable names.
+  @param    program     [out]:  Receives the newly allocated program.
+
+  @return   0 on success.
+            -ENOMEM if the allocation fails.
+            -EINVAL if the postfix expression is malformed.
+ =========================================================================== **/
+static int Program_lowerPostfix(char postfix[][MAX_TOKEN_LEN], int number, const registry_t* registry, const char** names,
+                                rpn_program_t** program)
+{
+    /*< Variable Declarations >*/
+    int ret                             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t iterator                     = 0u;
+    size_t slot                         = 0u;
+    size_t code_count                   = 0u;
+    size_t const_count                  = 0u;
+    size_t var_count                    = 0u;
+    size_t local_count                  = 0u;
+    size_t depth                        = 0u;
+    size_t max_depth                    = 0u;
+    size_t total_size                   = 0u;
+    size_t code_index                   = 0u;
+
+    int index                           = 0;
+
+    const registry_function_t* function = NULL;
+    const rpn_program_t* body           = NULL;
+    const plugin_function_t* native     = NULL;
+
+    rpn_program_t* block                = NULL;
+    program_instr_t* code               = NULL;
+    double* constants                   = NULL;
+    char (*variables)[MAX_TOKEN_LEN]    = NULL;
+
+    /*< Security Checks >*/
+    if ((number <= 0) || (number > (int)MAX_NUM_TOKENS))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    for (iterator = 0u; iterator < (size_t)number; iterator++)
+    {
+        function    = (RPNCalculator_isVariable(postfix[iterator]) == FUNCTION_SUCCESS) ? Registry_find(registry, postfix[iterator]) : NULL;
+        native      = (RPNCalculator_isVariable(postfix[iterator]) == FUNCTION_SUCCESS) ? Plugin_get((uint32_t)Plugin_find(postfix[iterator])) : NULL;
+
+        if (Program_isNumber(postfix[iterator]))
+        {
+            const_count++;
+            depth++;
+        }
+        else if (function != NULL)
+        {
+            body = function->body;
+            if (depth < function->arity)
+            {
+                ret = -(EINVAL);
+                goto end_of_function;
+            }
+
+            for (slot = 0u; slot < body->var_count; slot++)
+            {
+                if (Program_findParam(function, PROGRAM_VARIABLES(body)[slot]) == function->arity)
+                {
+                    ret = Program_addName(names, &var_count, PROGRAM_VARIABLES(body)[slot]);
+                    if (ret != FUNCTION_SUCCESS)
+                    {
+                        goto end_of_function;
+                    }
+                }
+            }
+
+            code_count  += function->arity + body->code_count - 1u;
+            const_count += body->const_count;
+            local_count += function->arity + body->local_count;
+
+            depth      -= function->arity;
+            max_depth   = ((depth + body->max_depth) > max_depth) ? (depth + body->max_depth) : max_depth;
+            depth++;
+        }
+        else if (native != NULL)
+        {
+            if (depth < native->arity)
+            {
+                ret = -(EINVAL);
+                goto end_of_function;
+            }
+
+            depth = depth - native->arity + 1u;
+        }
+        else if (RPNCalculator_isVariable(postfix[iterator]) == FUNCTION_SUCCESS)
+        {
+            ret = Program_addName(names, &var_count, postfix[iterator]);
+            if (ret != FUNCTION_SUCCESS)
+            {
+                goto end_of_function;
+            }
+            depth++;
+        }
+        else if (RPNCalculator_whichOperator(postfix[iterator]) == OP_FACT)
+        {
+            if (depth < 1u)
+            {
+                ret = -(EINVAL);
+                goto end_of_function;
+            }
+        }
+        else if (RPNCalculator_whichOperator(postfix[iterator]) >= FUNCTION_SUCCESS)
+        {
+            if (depth < 2u)
+            {
+                ret = -(EINVAL);
+                goto end_of_function;
+            }
+
+            depth--;
+        }
+        else if (RPNCalculator_whichFunction(postfix[iterator]) >= FUNCTION_SUCCESS)
+        {
+            if (depth < (size_t)RPNCalculator_functionArity(postfix[iterator]))
+            {
+                ret = -(EINVAL);
+                goto end_of_function;
+            }
+
+            depth = depth + 1u - (size_t)RPNCalculator_functionArity(postfix[iterator]);
+        }
+        else
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+
+        code_count++;
+        max_depth = (depth > max_depth) ? depth : max_depth;
+    }
+
+    /*< Exactly one value must remain on the stack >*/
+    if (depth != 1u)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    total_size = sizeof(rpn_program_t)
+               + (code_count * sizeof(program_instr_t))
+               + (const_count * sizeof(double))
+               + (var_count * MAX_TOKEN_LEN);
+
+    block = Alloc_malloc(total_size);
+    if (block == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    block->size         = (uint32_t)total_size;
+    block->code_count   = (uint32_t)code_count;
+    block->const_count  = (uint32_t)const_count;
+    block->max_depth    = (uint32_t)max_depth;
+    block->code_offset  = (uint32_t)sizeof(rpn_program_t);
+    block->const_offset = (uint32_t)(sizeof(rpn_program_t) + (code_count * sizeof(program_instr_t)));
+    block->var_count    = (uint32_t)var_count;
+    block->var_offset   = (uint32_t)(block->const_offset + (const_count * sizeof(double)));
+    block->local_count  = (uint32_t)local_count;
+    block->reserved     = 0u;
+
+    code        = (program_instr_t*)PROGRAM_CODE(block);
+    constants   = (double*)PROGRAM_CONSTANTS(block);
+    variables   = (char (*)[MAX_TOKEN_LEN])((char*)block + block->var_offset);
+    const_count = 0u;
+    local_count = 0u;
+
+    for (iterator = 0u; iterator < var_count; iterator++)
+    {
+        memset(variables[iterator], 0, MAX_TOKEN_LEN);
+        strncpy(variables[iterator], names[iterator], MAX_TOKEN_LEN - 1u);
+    }
+
+    for (iterator = 0u; iterator < (size_t)number; iterator++)
+    {
+        if (Program_isNumber(postfix[iterator]))
+        {
+            constants[const_count]      = atof(postfix[iterator]);
+            code[code_index].opcode     = OPCODE_CONST;
+            code[code_index].operand    = (uint32_t)const_count++;
+            code_index++;
+            continue;
+        }
+
+        if (RPNCalculator_isVariable(postfix[iterator]) == FUNCTION_SUCCESS)
+        {
+            function = Registry_find(registry, postfix[iterator]);
+            if (function != NULL)
+            {
+                Program_emitCall(function, names, var_count, code, &code_index, constants, &const_count, &local_count);
+                continue;
+            }
+
+            index = Plugin_find(postfix[iterator]);
+            if (index >= FUNCTION_SUCCESS)
+            {
+                code[code_index].opcode     = OPCODE_NATIVE;
+                code[code_index].operand    = (uint32_t)index;
+                code_index++;
+                continue;
+            }
+
+            code[code_index].opcode     = OPCODE_VAR;
+            code[code_index].operand    = (uint32_t)Program_findName(names, var_count, postfix[iterator]);
+            code_index++;
+            continue;
+        }
+
+        index = RPNCalculator_whichOperator(postfix[iterator]);
+        if (index >= FUNCTION_SUCCESS)
+        {
+            code[code_index].opcode     = (index == OP_ADD)  ? OPCODE_ADD  :
+                                          (index == OP_SUB)  ? OPCODE_SUB  :
+                                          (index == OP_MUL)  ? OPCODE_MUL  :
+                                          (index == OP_DIV)  ? OPCODE_DIV  :
+                                          (index == OP_POW)  ? OPCODE_POW  : OPCODE_FACT;
+            code[code_index].operand    = 0u;
+            code_index++;
+            continue;
+        }
+
+        /*< Functions from FUNC_POW10 on have their own opcodes >*/
+        index = RPNCalculator_whichFunction(postfix[iterator]);
+        code[code_index].opcode     = (index >= FUNC_POW10) ? (uint32_t)(OPCODE_POW10 + (index - FUNC_POW10)) : OPCODE_FUNC;
+        code[code_index].operand    = (uint32_t)index;
+        code_index++;
+    }
+
+    *program = block;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Program_checkNatives
+  @package  program
+
+  @brief    Checks that every native a program calls is registered.
+
+  @details  OPCODE_NATIVE holds an index into the native table of this
+            process, so a program built elsewhere may name a native that
+            does not exist here. The tile evaluators cannot fail midway,
+            so they check the whole program before the first tile.
+
+  @param    program [in]:   Program to check.
+
+  @return   0 on success.
+            -EINVAL if a native is not registered.
+ =========================================================================== **/
+static int Program_checkNatives(const rpn_program_t* program)
+{
+    /*< Variable Declarations >*/
+    int ret                     = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    const program_instr_t* code = PROGRAM_CODE(program);
+    size_t iterator             = 0u;
+
+    /*< Start Function Algorithm >*/
+    for (iterator = 0u; iterator < program->code_count; iterator++)
+    {
+        if ((code[iterator].opcode == OPCODE_NATIVE) && (Plugin_get(code[iterator].operand) == NULL))
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Program_evaluateNative
+  @package  program
+
+  @brief    Applies a native to the argument tiles on top of a tile stack.
+
+  @details  The arguments are consecutive tiles and the result replaces the
+            first one. The vector entry point receives the whole tile at
+            once; natives without one are called row by row.
+
+  @param    native  [in]:       Native to apply.
+  @param    tiles   [in/out]:   First argument tile, or the result tile of a
+                                native without arguments.
+  @param    count   [in]:       Rows in the tile.
+ =========================================================================== **/
+static void Program_evaluateNative(const plugin_function_t* native, double* tiles, size_t count)
+{
+    size_t row          = 0u;
+    uint32_t argument   = 0u;
+
+    const double* columns[PLUGIN_MAX_ARITY];
+    double arguments[PLUGIN_MAX_ARITY];
+
+    for (argument = 0u; argument < native->arity; argument++)
+    {
+        columns[argument] = &tiles[argument * PROGRAM_BLOCK_ROWS];
+    }
+
+    if (native->vector != NULL)
+    {
+        native->vector(columns, count, tiles);
+        return;
+    }
+
+    for (row = 0u; row < count; row++)
+    {
+        for (argument = 0u; argument < native->arity; argument++)
+        {
+            arguments[argument] = columns[argument][row];
+        }
+
+        tiles[row] = native->scalar(arguments);
+    }
+}
+
+/** ============================================================================
+  @fn       Program_evaluateTile
+  @package  program
+
+  @brief    Runs every instruction over one tile of rows.
+
+  @details  Stack entry `d` occupies `stack[d * PROGRAM_BLOCK_ROWS]` onwards.
+            Binary opcodes combine two disjoint entries element by element
+            over the full tile width, which keeps the hot loops free of
+            aliasing, branches and remainder handling; lanes past `count`
+            carry stale values that are never read back. Rows that hit a
+            division by zero or an invalid factorial are marked in `failed`
+            and keep computing on whatever value results.
+
+  @param    program [in]:       Program to evaluate.
+  @param    columns [in]:       One column per variable slot.
+  @param    base    [in]:       First row of the tile.
+  @param    count   [in]:       Rows in the tile, at most PROGRAM_BLOCK_ROWS.
+  @param    stack   [out]:      Tile stack of max_depth entries; entry 0
+                                holds the results.
+  @param    locals  [out]:      Tile slots of local_count entries.
+  @param    failed  [in/out]:   Non-zero for failed rows.
+ =========================================================================== **/
+CPU_KERNEL void Program_evaluateTile(const rpn_program_t* program, const double* const* columns, size_t base, size_t count,
+                                     double* stack, double* locals, uint8_t* failed)
+{
+    const program_instr_t* code = PROGRAM_CODE(program);
+    const double* constants     = PROGRAM_CONSTANTS(program);
+
+    size_t iterator             = 0u;
+    size_t top                  = 0u;
+    size_t row                  = 0u;
+
+    double value                = 0.0;
+    double* restrict left       = NULL;
+    const double* restrict right = NULL;
+    const double* restrict addend = NULL;
+
+    double (*function)(double)  = NULL;
+
+    for (iterator = 0u; iterator < program->code_count; iterator++)
+    {
+        if (code[iterator].opcode == OPCODE_NATIVE)
+        {
+            top -= Plugin_get(code[iterator].operand)->arity;
+            Program_evaluateNative(Plugin_get(code[iterator].operand), &stack[top * PROGRAM_BLOCK_ROWS], count);
+            top++;
+            continue;
+        }
+
+        if (code[iterator].opcode == OPCODE_STORE)
+        {
+            top--;
+            memcpy(&locals[code[iterator].operand * PROGRAM_BLOCK_ROWS], &stack[top * PROGRAM_BLOCK_ROWS], PROGRAM_BLOCK_ROWS * sizeof(double));
+            continue;
+        }
+
+        if (code[iterator].opcode == OPCODE_LOAD)
+        {
+            memcpy(&stack[top * PROGRAM_BLOCK_ROWS], &locals[code[iterator].operand * PROGRAM_BLOCK_ROWS], PROGRAM_BLOCK_ROWS * sizeof(double));
+            top++;
+            continue;
+        }
+
+        if ((code[iterator].opcode == OPCODE_CONST) || (code[iterator].opcode == OPCODE_VAR))
+        {
+            left = &stack[top * PROGRAM_BLOCK_ROWS];
+            top++;
+
+            if (code[iterator].opcode == OPCODE_VAR)
+            {
+                memcpy(left, &columns[code[iterator].operand][base], count * sizeof(double));
+                continue;
+            }
+
+            value = constants[code[iterator].operand];
+            for (row = 0u; row < PROGRAM_BLOCK_ROWS; row++)
+            {
+                left[row] = value;
+            }
+            continue;
+        }
+
+        if (code[iterator].opcode == OPCODE_POW10)
+        {
+            left = &stack[(top - 1u) * PROGRAM_BLOCK_ROWS];
+            for (row = 0u; row < count; row++)
+            {
+                left[row] = pow(10.0, left[row]);
+            }
+            continue;
+        }
+
+        if (code[iterator].opcode == OPCODE_FMA)
+        {
+            top    -= 2u;
+            left    = &stack[(top - 1u) * PROGRAM_BLOCK_ROWS];
+            right   = &stack[top * PROGRAM_BLOCK_ROWS];
+            addend  = &stack[(top + 1u) * PROGRAM_BLOCK_ROWS];
+            for (row = 0u; row < PROGRAM_BLOCK_ROWS; row++)
+            {
+                left[row] = fma(left[row], right[row], addend[row]);
+            }
+            continue;
+        }
+
+        if ((code[iterator].opcode == OPCODE_FACT) || (code[iterator].opcode == OPCODE_FUNC))
+        {
+            left = &stack[(top - 1u) * PROGRAM_BLOCK_ROWS];
+            function = (code[iterator].opcode == OPCODE_FUNC) ? program_functions[code[iterator].operand] : NULL;
+
+            for (row = 0u; row < count; row++)
+            {
+                if (function != NULL)
+                {
+                    left[row] = function(left[row]);
+                }
+                else if ((left[row] < 0.0) || ((left[row] - (int)(left[row])) != 0.0))
+                {
+                    failed[row] = 1u;
+                }
+                else
+                {
+                    left[row] = RPNCalculator_factorialCalculate((unsigned int)left[row]);
+                }
+            }
+            continue;
+        }
+
+        top--;
+        left    = &stack[(top - 1u) * PROGRAM_BLOCK_ROWS];
+        right   = &stack[top * PROGRAM_BLOCK_ROWS];
+
+        switch (code[iterator].opcode)
+        {
+            case OPCODE_ADD:
+                for (row = 0u; row < PROGRAM_BLOCK_ROWS; row++)
+                {
+                    left[row] += right[row];
+                }
+                break;
+
+            case OPCODE_SUB:
+                for (row = 0u; row < PROGRAM_BLOCK_ROWS; row++)
+                {
+                    left[row] -= right[row];
+                }
+                break;
+
+            case OPCODE_MUL:
+                for (row = 0u; row < PROGRAM_BLOCK_ROWS; row++)
+                {
+                    left[row] *= right[row];
+                }
+                break;
+
+            case OPCODE_DIV:
+                for (row = 0u; row < count; row++)
+                {
+                    failed[row] |= (uint8_t)(right[row] == 0.0);
+                }
+                for (row = 0u; row < PROGRAM_BLOCK_ROWS; row++)
+                {
+                    left[row] /= right[row];
+                }
+                break;
+
+            case OPCODE_ATAN2:
+                for (row = 0u; row < count; row++)
+                {
+                    left[row] = atan2(left[row], right[row]);
+                }
+                break;
+
+            case OPCODE_HYPOT:
+                for (row = 0u; row < count; row++)
+                {
+                    left[row] = hypot(left[row], right[row]);
+                }
+                break;
+
+            /*< Select form of fmin / fmax, NaN only wins if both are NaN >*/
+            case OPCODE_MIN:
+                for (row = 0u; row < PROGRAM_BLOCK_ROWS; row++)
+                {
+                    left[row] = ((right[row] < left[row]) || (left[row] != left[row])) ? right[row] : left[row];
+                }
+                break;
+
+            case OPCODE_MAX:
+                for (row = 0u; row < PROGRAM_BLOCK_ROWS; row++)
+                {
+                    left[row] = ((right[row] > left[row]) || (left[row] != left[row])) ? right[row] : left[row];
+                }
+                break;
+
+            case OPCODE_POW:
+            default:
+                for (row = 0u; row < PROGRAM_BLOCK_ROWS; row++)
+                {
+                    left[row] = pow(left[row], right[row]);
+                }
+                break;
+        }
+    }
+}
+
+/** ============================================================================
+  @fn       Program_evaluateTileBaseline
+  @package  program
+
+  @brief    Program_evaluateTile built for the compiler's baseline target.
+
+  @details  Serves the scalar and SSE2 tiers; on x86-64 the baseline already
+            vectorizes the tile loops with SSE2.
+ =========================================================================== **/
+static void Program_evaluateTileBaseline(const rpn_program_t* program, const double* const* columns, size_t base, size_t count,
+                                         double* stack, double* locals, uint8_t* failed)
+{
+    Program_evaluateTile(program, columns, base, count, stack, locals, failed);
+}
+
+#if CPU_DISPATCH
+
+/** ============================================================================
+  @fn       Program_evaluateTileAvx2
+  @package  program
+
+  @brief    Program_evaluateTile built for the AVX2 tier.
+ =========================================================================== **/
+CPU_TARGET_AVX2 static void Program_evaluateTileAvx2(const rpn_program_t* program, const double* const* columns, size_t base, size_t count,
+                                                     double* stack, double* locals, uint8_t* failed)
+{
+    Program_evaluateTile(program, columns, base, count, stack, locals, failed);
+}
+
+/** ============================================================================
+  @fn       Program_evaluateTileAvx512
+  @package  program
+
+  @brief    Program_evaluateTile built for the AVX-512 tier.
+ =========================================================================== **/
+CPU_TARGET_AVX512 static void Program_evaluateTileAvx512(const rpn_program_t* program, const double* const* columns, size_t base, size_t count,
+                                                         double* stack, double* locals, uint8_t* failed)
+{
+    Program_evaluateTile(program, columns, base, count, stack, locals, failed);
+}
+
+#endif /* CPU_DISPATCH */
+
+/** ============================================================================
+  @fn       Program_selectTile
+  @package  program
+
+  @brief    Returns the tile evaluator for the CPU tier.
+
+  @return   Widest evaluator the host may run.
+ =========================================================================== **/
+static program_tile_t Program_selectTile(void)
+{
+#if CPU_DISPATCH
+    switch (Cpu_tier())
+    {
+        case CPU_TIER_AVX512:
+            return Program_evaluateTileAvx512;
+
+        case CPU_TIER_AVX2:
+            return Program_evaluateTileAvx2;
+
+        default:
+            break;
+    }
+#endif
+
+    return Program_evaluateTileBaseline;
+}
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS DEFINITION      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Program_compile
+  @package  program
+
+  @brief    Compiles an infix expression into a bytecode program.
+
+  @details  Tokenizes the expression, converts it to postfix and lowers the
+            postfix tokens into instructions. The value stack depth is
+            simulated during lowering, so malformed expressions are rejected
+            here instead of at evaluation time.
+
+  @param    expression  [in]:   String representing the infix expression.
+  @param    program     [out]:  Receives the newly allocated program.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or the allocation fails.
+            -EINVAL if the expression is malformed.
+ =========================================================================== **/
+int Program_compile(const char* expression, rpn_program_t** program)
+{
+    return Program_compileWith(expression, NULL, program);
+}
+
+/** ============================================================================
+  @fn       Program_compileWith
+  @package  program
+
+  @brief    Compiles an infix expression that may call user functions.
+
+  @details  Works as Program_compile, and additionally accepts calls such as
+            "f(a, b)" to the functions of the registry. Every call is checked
+            against the arity of its function and replaced by the function
+            body, so the program runs without any call overhead. Calls to
+            registered natives become a single OPCODE_NATIVE.
+
+  @param    expression  [in]:   String representing the infix expression.
+  @param    registry    [in]:   User functions, or NULL for none.
+  @param    program     [out]:  Receives the newly allocated program.
+
+  @return   0 on success.
+            -ENOMEM if expression or program is NULL or the allocation fails.
+            -EINVAL if the expression is malformed, calls an unknown function
+            or passes the wrong number of arguments.
+ =========================================================================== **/
+int Program_compileWith(const char* expression, const registry_t* registry, rpn_program_t** program)
+{
+    return Program_compileLength(expression, (expression == NULL) ? 0u : strlen(expression), registry, program);
+}
+
+/** ============================================================================
+  @fn       Program_compileLength
+  @package  program
+
+  @brief    Compiles an infix expression of known length.
+
+  @details  Works as Program_compileWith on the first `length` characters,
+            which need no NUL terminator, so an expression inside a larger
+            buffer is compiled without being copied out first.
+
+            The token, postfix and name buffers are taken from the scratch
+            arena of the thread and released by rewinding it, so the only
+            allocation of a compilation is the program itself.
+
+  @param    expression  [in]:   String representing the infix expression.
+  @param    length      [in]:   Number of characters of the expression.
+  @param    registry    [in]:   User functions, or NULL for none.
+  @param    program     [out]:  Receives the newly allocated program.
+
+  @return   0 on success.
+            -ENOMEM if expression or program is NULL or the allocation fails.
+            -EINVAL if the expression is malformed, calls an unknown function
+            or passes the wrong number of arguments.
+ =========================================================================== **/
+int Program_compileLength(const char* expression, size_t length, const registry_t* registry, rpn_program_t** program)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    int token_count                 = 0;
+    int postfix_count               = 0;
+
+    alloc_arena_t* scratch          = NULL;
+    alloc_mark_t mark               = { NULL, 0u };
+
+    char (*tokens)[MAX_TOKEN_LEN]   = NULL;
+    char (*postfix)[MAX_TOKEN_LEN]  = NULL;
+    const char** names              = NULL;
+
+    /*< Security Checks >*/
+    if ((expression == NULL) || (program == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if (length >= MAX_EXPRESSION_SIZE)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    *program = NULL;
+
+    scratch = Alloc_scratch();
+    mark    = Alloc_arenaMark(scratch);
+
+    /*< Start Function Algorithm >*/
+    tokens  = Alloc_arenaMalloc(scratch, MAX_NUM_TOKENS * sizeof(*tokens));
+    postfix = Alloc_arenaMalloc(scratch, MAX_NUM_TOKENS * sizeof(*postfix));
+    names   = Alloc_arenaMalloc(scratch, MAX_NUM_TOKENS * sizeof(*names));
+    if ((tokens == NULL) || (postfix == NULL) || (names == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    token_count = RPNCalculator_tokenizeLength(expression, length, tokens);
+    if (token_count <= 0)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    ret = Program_checkCalls(tokens, token_count, registry);
+    if (ret != FUNCTION_SUCCESS)
+    {
+        goto end_of_function;
+    }
+
+    postfix_count = RPNCalculator_infixToPostfix(tokens, postfix, token_count);
+    if (postfix_count <= 0)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    ret = Program_lowerPostfix(postfix, postfix_count, registry, names, program);
+
+    /*< Function Output >*/
+end_of_function:
+    Alloc_arenaRewind(scratch, mark);
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Program_evaluate
+  @package  program
+
+  @brief    Evaluates a compiled program.
+
+  @details  Runs the instructions over a local value stack. The program is not
+            modified, so concurrent evaluation of one program is safe.
+
+  @param    program     [in]:   Program to evaluate.
+  @param    result      [out]:  Receives the value of the expression.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -EINVAL if the evaluation fails (e.g., division by zero) or the
+            program has variables.
+ =========================================================================== **/
+int Program_evaluate(const rpn_program_t* program, double* result)
+{
+    return Program_evaluateWith(program, NULL, result);
+}
+
+/** ============================================================================
+  @fn       Program_evaluateWith
+  @package  program
+
+  @brief    Evaluates a compiled program with bound variables.
+
+  @param    program     [in]:   Program to evaluate.
+  @param    variables   [in]:   One value per variable slot, in the order of
+                                PROGRAM_VARIABLES. May be NULL when the
+                                program has no variables.
+  @param    result      [out]:  Receives the value of the expression.
+
+  @return   0 on success.
+            -ENOMEM if program or result is NULL.
+            -EINVAL if the evaluation fails, variables are missing or a
+            native called by the program is not registered.
+ =========================================================================== **/
+int Program_evaluateWith(const rpn_program_t* program, const double* variables, double* result)
+{
+    /*< Variable Declarations >*/
+    int ret                         = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t iterator                 = 0u;
+    size_t top                      = 0u;
+
+    double value                    = 0.0;
+    double inline_stack[INLINE_STACK_DEPTH];
+    double* stack                   = inline_stack;
+    double* locals                  = NULL;
+
+    const program_instr_t* code     = NULL;
+    const plugin_function_t* native = NULL;
+    const double* constants         = NULL;
+
+    /*< Security Checks >*/
+    if ((program == NULL) || (result == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if ((program->var_count > 0u) && (variables == NULL))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    code        = PROGRAM_CODE(program);
+    constants   = PROGRAM_CONSTANTS(program);
+
+    /*< Local slots follow the value stack in the same buffer >*/
+    if (((size_t)program->max_depth + program->local_count) > INLINE_STACK_DEPTH)
+    {
+        stack = Alloc_malloc(((size_t)program->max_depth + program->local_count) * sizeof(double));
+        if (stack == NULL)
+        {
+            ret = -(ENOMEM);
+            goto end_of_function;
+        }
+    }
+
+    locals = stack + program->max_depth;
+
+    /*< Start Function Algorithm >*/
+    for (iterator = 0u; iterator < program->code_count; iterator++)
+    {
+        switch (code[iterator].opcode)
+        {
+            case OPCODE_CONST:
+                stack[top++] = constants[code[iterator].operand];
+                break;
+
+            case OPCODE_VAR:
+                stack[top++] = variables[code[iterator].operand];
+                break;
+
+            case OPCODE_STORE:
+                locals[code[iterator].operand] = stack[--top];
+                break;
+
+            case OPCODE_LOAD:
+                stack[top++] = locals[code[iterator].operand];
+                break;
+
+            case OPCODE_NATIVE:
+                native           = Plugin_get(code[iterator].operand);
+                if (native == NULL)
+                {
+                    ret = -(EINVAL);
+                    goto end_of_function;
+                }
+
+                top             -= native->arity;
+                stack[top]       = native->scalar(&stack[top]);
+                top++;
+                break;
+
+            case OPCODE_ADD:
+                top--;
+                stack[top - 1u] = stack[top - 1u] + stack[top];
+                break;
+
+            case OPCODE_SUB:
+                top--;
+                stack[top - 1u] = stack[top - 1u] - stack[top];
+                break;
+
+            case OPCODE_MUL:
+                top--;
+                stack[top - 1u] = stack[top - 1u] * stack[top];
+                break;
+
+            case OPCODE_DIV:
+                top--;
+                if (stack[top] == 0.0)
+                {
+                    ret = -(EINVAL);
+                    goto end_of_function;
+                }
+                stack[top - 1u] = stack[top - 1u] / stack[top];
+                break;
+
+            case OPCODE_POW:
+                top--;
+                stack[top - 1u] = pow(stack[top - 1u], stack[top]);
+                break;
+
+            case OPCODE_FACT:
+                value = stack[top - 1u];
+                if ((value < 0.0) || ((value - (int)(value)) != 0.0))
+                {
+                    ret = -(EINVAL);
+                    goto end_of_function;
+                }
+                stack[top - 1u] = RPNCalculator_factorialCalculate((unsigned int)value);
+                break;
+
+            case OPCODE_FUNC:
+                stack[top - 1u] = program_functions[code[iterator].operand](stack[top - 1u]);
+                break;
+
+            case OPCODE_POW10:
+                stack[top - 1u] = pow(10.0, stack[top - 1u]);
+                break;
+
+            case OPCODE_ATAN2:
+                top--;
+                stack[top - 1u] = atan2(stack[top - 1u], stack[top]);
+                break;
+
+            case OPCODE_HYPOT:
+                top--;
+                stack[top - 1u] = hypot(stack[top - 1u], stack[top]);
+                break;
+
+            case OPCODE_MIN:
+                top--;
+                stack[top - 1u] = fmin(stack[top - 1u], stack[top]);
+                break;
+
+            case OPCODE_MAX:
+                top--;
+                stack[top - 1u] = fmax(stack[top - 1u], stack[top]);
+                break;
+
+            case OPCODE_FMA:
+                top -= 2u;
+                stack[top - 1u] = fma(stack[top - 1u], stack[top], stack[top + 1u]);
+                break;
+
+            default:
+                ret = -(EINVAL);
+                goto end_of_function;
+        }
+    }
+
+    *result = stack[0];
+
+    /*< Function Output >*/
+end_of_function:
+    if (stack != inline_stack)
+    {
+        Alloc_free(stack);
+    }
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Program_evaluateBlock
+  @package  program
+
+  @brief    Evaluates a compiled program over many rows.
+
+  @details  Rows are processed in tiles of PROGRAM_BLOCK_ROWS. Every
+            instruction is applied to the whole tile before the next one, and
+            rows that fail (division by zero, invalid factorial) are flagged
+            instead of stopping the tile.
+
+  @param    program     [in]:   Program to evaluate.
+  @param    columns     [in]:   One column of `rows` values per variable slot.
+                                May be NULL when the program has no variables.
+  @param    rows        [in]:   Number of rows.
+  @param    results     [out]:  Value of each row, NaN for failed rows.
+  @param    status      [out]:  0 or -EINVAL for each row.
+
+  @return   Number of failed rows on success, saturated at INT_MAX.
+            -ENOMEM if an argument is NULL or the tile stack cannot be
+            allocated.
+            -EINVAL if variable columns are missing or a native called by
+            the program is not registered.
+ =========================================================================== **/
+int Program_evaluateBlock(const rpn_program_t* program, const double* const* columns, size_t rows, double* results, int* status)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t base         = 0u;
+    size_t count        = 0u;
+    size_t row          = 0u;
+    size_t slot         = 0u;
+
+    double* stack       = NULL;
+    uint8_t failed[PROGRAM_BLOCK_ROWS];
+
+    program_tile_t tile = NULL;
+
+    /*< Security Checks >*/
+    if ((program == NULL) || (results == NULL) || (status == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if ((program->var_count > 0u) && (columns == NULL))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    for (slot = 0u; slot < program->var_count; slot++)
+    {
+        if (columns[slot] == NULL)
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+    }
+
+    ret = Program_checkNatives(program);
+    if (ret != FUNCTION_SUCCESS)
+    {
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    stack = Alloc_calloc(((size_t)program->max_depth + program->local_count) * PROGRAM_BLOCK_ROWS, sizeof(double));
+    if (stack == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    tile = Program_selectTile();
+
+    for (base = 0u; base < rows; base += count)
+    {
+        count = ((rows - base) < PROGRAM_BLOCK_ROWS) ? (rows - base) : PROGRAM_BLOCK_ROWS;
+
+        memset(failed, 0, sizeof(failed));
+        tile(program, columns, base, count, stack, stack + ((size_t)program->max_depth * PROGRAM_BLOCK_ROWS), failed);
+
+        for (row = 0u; row < count; row++)
+        {
+            results[base + row] = (failed[row] != 0u) ? NAN : stack[row];
+            status[base + row]  = (failed[row] != 0u) ? -(EINVAL) : FUNCTION_SUCCESS;
+            ret                += ((failed[row] != 0u) && (ret < INT_MAX)) ? 1 : 0;
+        }
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    Alloc_free(stack);
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Program_evaluateBlockLocals
+  @package  program
+
+  @brief    Evaluates a program over many rows and reads its results from
+            local slots.
+
+  @details  Runs like Program_evaluateBlock, but a program may leave several
+            results behind: output `k` of each row is the value that local
+            slot `slots[k]` holds once the tile is done. A failed row is
+            failed for every output, since the tile keeps a single failure
+            flag per row.
+
+  @param    program     [in]:   Program to evaluate.
+  @param    columns     [in]:   One column of `rows` values per variable slot.
+                                May be NULL when the program has no variables.
+  @param    rows        [in]:   Number of rows.
+  @param    slots       [in]:   Local slot of each output.
+  @param    outputs     [in]:   Number of outputs.
+  @param    results     [out]:  One column of `rows` values per output.
+  @param    status      [out]:  0 or -EINVAL for each row.
+
+  @return   Number of failed rows on success, saturated at INT_MAX.
+            -ENOMEM if an argument is NULL or the tile stack cannot be
+            allocated.
+            -EINVAL if variable columns are missing, a slot is out of range
+            or a native called by the program is not registered.
+ =========================================================================== **/
+int Program_evaluateBlockLocals(const rpn_program_t* program, const double* const* columns, size_t rows, const uint32_t* slots,
+                                size_t outputs, double* const* results, int* status)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t base         = 0u;
+    size_t count        = 0u;
+    size_t row          = 0u;
+    size_t slot         = 0u;
+    size_t output       = 0u;
+
+    double* stack       = NULL;
+    double* locals      = NULL;
+    uint8_t failed[PROGRAM_BLOCK_ROWS];
+
+    program_tile_t tile = NULL;
+
+    /*< Security Checks >*/
+    if ((program == NULL) || (slots == NULL) || (results == NULL) || (status == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if ((program->var_count > 0u) && (columns == NULL))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    for (slot = 0u; slot < program->var_count; slot++)
+    {
+        if (columns[slot] == NULL)
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+    }
+
+    ret = Program_checkNatives(program);
+    if (ret != FUNCTION_SUCCESS)
+    {
+        goto end_of_function;
+    }
+
+    for (output = 0u; output < outputs; output++)
+    {
+        if (results[output] == NULL)
+        {
+            ret = -(ENOMEM);
+            goto end_of_function;
+        }
+
+        if (slots[output] >= program->local_count)
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+    }
+
+    /*< Assign Initial Values >*/
+    stack = Alloc_calloc(((size_t)program->max_depth + program->local_count) * PROGRAM_BLOCK_ROWS, sizeof(double));
+    if (stack == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    locals = stack + ((size_t)program->max_depth * PROGRAM_BLOCK_ROWS);
+
+    /*< Start Function Algorithm >*/
+    tile = Program_selectTile();
+
+    for (base = 0u; base < rows; base += count)
+    {
+        count = ((rows - base) < PROGRAM_BLOCK_ROWS) ? (rows - base) : PROGRAM_BLOCK_ROWS;
+
+        memset(failed, 0, sizeof(failed));
+        tile(program, columns, base, count, stack, locals, failed);
+
+        for (output = 0u; output < outputs; output++)
+        {
+            memcpy(&results[output][base], &locals[slots[output] * PROGRAM_BLOCK_ROWS], count * sizeof(double));
+        }
+
+        for (row = 0u; row < count; row++)
+        {
+            status[base + row]  = (failed[row] != 0u) ? -(EINVAL) : FUNCTION_SUCCESS;
+            ret                += ((failed[row] != 0u) && (ret < INT_MAX)) ? 1 : 0;
+
+            for (output = 0u; (failed[row] != 0u) && (output < outputs); output++)
+            {
+                results[output][base + row] = NAN;
+            }
+        }
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    Alloc_free(stack);
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Program_findVariable
+  @package  program
+
+  @brief    Returns the slot of a variable.
+
+  @param    program     [in]:   Compiled program.
+  @param    name        [in]:   Variable name.
+
+  @return   Slot index on success.
+            -ENOMEM if an argument is NULL.
+            -ENOENT if the program has no such variable.
+ =========================================================================== **/
+int Program_findVariable(const rpn_program_t* program, const char* name)
+{
+    /*< Variable Declarations >*/
+    int ret         = -(ENOENT); /*< Return Control >*/
+
+    uint32_t slot   = 0u;
+
+    /*< Security Checks >*/
+    if ((program == NULL) || (name == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    for (slot = 0u; slot < program->var_count; slot++)
+    {
+        if (strcmp(PROGRAM_VARIABLES(program)[slot], name) == 0)
+        {
+            ret = (int)slot;
+            goto end_of_function;
+        }
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Program_destroy
+  @package  program
+
+  @brief    Releases a compiled program.
+
+  @param    program     [in]:   Program to release. NULL is ignored.
+ =========================================================================== **/
+void Program_destroy(rpn_program_t* program)
+{
+    Alloc_free(program);
+}
+
+/*< end of file >*/
@@ -0,0 +1,602 @@
+/** ===========================================================================
+    @ingroup    ProgramTable
+    @addtogroup ProgramTable_Module program_table
+
+    @package    program_table
+    @brief      This module provides a concurrent table of compiled programs
+                shared by every worker thread.
+
+    @file       programtable.c
+    @headerfile programtable.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    The table maps expression strings to compiled programs so
+                that each expression is compiled once per process instead of
+                once per thread. Buckets are singly linked lists with
+                lock-free reads (plain acquire loads) and lock-free inserts
+                (compare-and-swap on the bucket head). When two threads
+                compile the same expression concurrently, the loser discards
+                its copy and uses the published one.
+
+                Memory is reclaimed with the `epoch` module: ProgramTable_flush
+                publishes an empty bucket array and frees the old entries only
+                after every reader has left its read-side section.
+
+    @note       - Every thread registers once with
+                  ProgramTable_registerReader and passes the returned slot
+                  to the other calls.
+                - The number of buckets is chosen at creation and never
+                  grows; size it for the expected number of distinct
+                  expressions.
+
+    @see        - ProgramTable_create
+                - ProgramTable_evaluate
+                - ProgramTable_evaluateWith
+                - ProgramTable_flush
+ =========================================================================== **/
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <errno.h>
+
+/*< Implements >*/
+#include <alloc.h>
+#include <program.h>
+#include <epoch.h>
+#include <programtable.h>
+
+/* ==================================== *\
+ *            PRIVATE DEFINES           *
+\* ==================================== */
+
+/** ====================================
+  @def      FUNCTION_SUCCESS
+  @package  program_table
+  @brief    Indicates successful function
+            execution.
+
+  @details  Represents a successful
+            operation, typically with
+            a value of 0.
+ ==================================== **/
+#define FUNCTION_SUCCESS        (int)(0)
+
+/** ====================================
+  @def      MIN_BUCKETS
+  @package  program_table
+  @brief    Smallest number of buckets
+            of a table.
+ ==================================== **/
+#define MIN_BUCKETS             (size_t)(16U)
+
+/** ====================================
+  @def      FNV_OFFSET_BASIS
+  @package  program_table
+  @brief    64-bit FNV-1a offset basis.
+ ==================================== **/
+#define FNV_OFFSET_BASIS        (uint64_t)(0xcbf29ce484222325ULL)
+
+/** ====================================
+  @def      FNV_PRIME
+  @package  program_table
+  @brief    64-bit FNV-1a prime.
+ ==================================== **/
+#define FNV_PRIME               (uint64_t)(0x100000001b3ULL)
+
+/* ==================================== *\
+ *       PRIVATE TYPES DEFINITION       *
+\* ==================================== */
+
+/** ============================================================================
+  @struct   table_node_t
+  @package  program_table
+
+  @typedef  table_node_t
+
+  @brief    Represents one cached program.
+
+  @details  Every field, `next` included, is written before the node is
+            published and never modified afterwards.
+ =========================================================================== **/
+typedef struct tableNode
+{
+    struct tableNode*   next;           /*< Next node of the bucket >*/
+    uint64_t            hash;           /*< Hash of the expression >*/
+    rpn_program_t*      program;        /*< Compiled expression >*/
+    char                expression[];   /*< NUL-terminated key >*/
+} table_node_t;
+
+/** ============================================================================
+  @struct   table_buckets_t
+  @package  program_table
+
+  @typedef  table_buckets_t
+
+  @brief    Represents one bucket array generation.
+ =========================================================================== **/
+typedef struct
+{
+    size_t                  mask;       /*< Bucket count minus one >*/
+    _Atomic(table_node_t*)  heads[];    /*< Bucket list heads >*/
+} table_buckets_t;
+
+/** ============================================================================
+  @struct   programTable
+  @package  program_table
+
+  @brief    Represents a concurrent program table.
+ =========================================================================== **/
+struct programTable
+{
+    _Atomic(table_buckets_t*)   buckets;        /*< Published bucket array >*/
+    size_t                      bucket_count;   /*< Buckets per generation >*/
+    epoch_domain_t*             epoch;          /*< Reader tracking >*/
+    pthread_mutex_t             flush_lock;     /*< Serializes flushes >*/
+};
+
+/* ==================================== *\
+ *     PRIVATE FUNCTIONS DEFINITION     *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       ProgramTable_hash
+  @package  program_table
+
+  @brief    Hashes an expression with 64-bit FNV-1a.
+
+  @param    expression  [in]:   NUL-terminated expression.
+  @param    length      [out]:  Receives the length of the expression.
+
+  @return   Hash of the expression.
+ =========================================================================== **/
+static uint64_t ProgramTable_hash(const char* expression, size_t* length)
+{
+    uint64_t hash       = FNV_OFFSET_BASIS;
+    const char* cursor  = expression;
+
+    while (*cursor != '\0')
+    {
+        hash = (hash ^ (uint8_t)(*cursor++)) * FNV_PRIME;
+    }
+
+    *length = (size_t)(cursor - expression);
+
+    return hash;
+}
+
+/** ============================================================================
+  @fn       ProgramTable_newBuckets
+  @package  program_table
+
+  @brief    Allocates an empty bucket array.
+
+  @param    bucket_count    [in]:   Number of buckets, a power of two.
+
+  @return   The bucket array, or NULL if the allocation fails.
+ =========================================================================== **/
+static table_buckets_t* ProgramTable_newBuckets(size_t bucket_count)
+{
+    size_t iterator             = 0u;
+    table_buckets_t* buckets    = NULL;
+
+    buckets = Alloc_malloc(sizeof(table_buckets_t) + (bucket_count * sizeof(_Atomic(table_node_t*))));
+    if (buckets == NULL)
+    {
+        return NULL;
+    }
+
+    buckets->mask = bucket_count - 1u;
+
+    for (iterator = 0u; iterator < bucket_count; iterator++)
+    {
+        atomic_init(&buckets->heads[iterator], NULL);
+    }
+
+    return buckets;
+}
+
+/** ============================================================================
+  @fn       ProgramTable_freeBuckets
+  @package  program_table
+
+  @brief    Releases a bucket array and every node it holds.
+
+  @param    buckets [in]:   Bucket array to release. NULL is ignored.
+ =========================================================================== **/
+static void ProgramTable_freeBuckets(table_buckets_t* buckets)
+{
+    size_t iterator     = 0u;
+    table_node_t* node  = NULL;
+    table_node_t* next  = NULL;
+
+    if (buckets == NULL)
+    {
+        return;
+    }
+
+    for (iterator = 0u; iterator <= buckets->mask; iterator++)
+    {
+        for (node = atomic_load_explicit(&buckets->heads[iterator], memory_order_relaxed); node != NULL; node = next)
+        {
+            next = node->next;
+            Program_destroy(node->program);
+            Alloc_free(node);
+        }
+    }
+
+    Alloc_free(buckets);
+}
+
+/** ============================================================================
+  @fn       ProgramTable_find
+  @package  program_table
+
+  @brief    Searches a bucket list, stopping at a given node.
+
+  @param    node        [in]:   First node to inspect.
+  @param    stop        [in]:   Node at which to stop, or NULL.
+  @param    hash        [in]:   Hash of the expression.
+  @param    expression  [in]:   Expression to find.
+
+  @return   The matching program, or NULL.
+ =========================================================================== **/
+static const rpn_program_t* ProgramTable_find(const table_node_t* node, const table_node_t* stop, uint64_t hash, const char* expression)
+{
+    for (; node != stop; node = node->next)
+    {
+        if ((node->hash == hash) && (strcmp(node->expression, expression) == 0))
+        {
+            return node->program;
+        }
+    }
+
+    return NULL;
+}
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS DEFINITION      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       ProgramTable_create
+  @package  program_table
+
+  @brief    Creates an empty table.
+
+  @param    table           [out]:  Receives the new table.
+  @details  The bucket array never grows: past bucket_count distinct
+            expressions the chains get longer and lookups slow down
+            linearly. Size it for the expected working set, or call
+            ProgramTable_flush to start over.
+
+  @param    bucket_count    [in]:   Number of buckets, rounded up to a power
+                                    of two.
+
+  @return   0 on success.
+            -ENOMEM if table is NULL or an allocation fails.
+ =========================================================================== **/
+int ProgramTable_create(program_table_t** table, size_t bucket_count)
+{
+    /*< Variable Declarations >*/
+    int ret                     = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t rounded              = MIN_BUCKETS;
+
+    program_table_t* created    = NULL;
+    table_buckets_t* buckets    = NULL;
+
+    /*< Security Checks >*/
+    if (table == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    while (rounded < bucket_count)
+    {
+        rounded <<= 1u;
+    }
+
+    /*< Start Function Algorithm >*/
+    created = Alloc_calloc(1u, sizeof(program_table_t));
+    buckets = ProgramTable_newBuckets(rounded);
+
+    if ((created == NULL) || (buckets == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    ret = Epoch_create(&created->epoch);
+    if (ret != FUNCTION_SUCCESS)
+    {
+        goto end_of_function;
+    }
+
+    created->bucket_count = rounded;
+    atomic_init(&created->buckets, buckets);
+    pthread_mutex_init(&created->flush_lock, NULL);
+
+    *table  = created;
+    created = NULL;
+    buckets = NULL;
+
+    /*< Function Output >*/
+end_of_function:
+    Alloc_free(created);
+    Alloc_free(buckets);
+    return ret;
+}
+
+/** ============================================================================
+  @fn       ProgramTable_destroy
+  @package  program_table
+
+  @brief    Releases a table and every program it holds.
+
+  @details  No thread may use the table once this function has been called.
+
+  @param    table   [in]:   Table to release. NULL is ignored.
+ =========================================================================== **/
+void ProgramTable_destroy(program_table_t* table)
+{
+    if (table == NULL)
+    {
+        return;
+    }
+
+    ProgramTable_freeBuckets(atomic_load(&table->buckets));
+    Epoch_destroy(table->epoch);
+    pthread_mutex_destroy(&table->flush_lock);
+    Alloc_free(table);
+}
+
+/** ============================================================================
+  @fn       ProgramTable_registerReader
+  @package  program_table
+
+  @brief    Registers the calling thread with the table.
+
+  @param    table   [in]:   Table to use.
+
+  @return   Reader slot on success.
+            -ENOMEM if table is NULL.
+            -EBUSY if too many threads are registered.
+ =========================================================================== **/
+int ProgramTable_registerReader(program_table_t* table)
+{
+    return (table == NULL) ? -(ENOMEM) : Epoch_register(table->epoch);
+}
+
+/** ============================================================================
+  @fn       ProgramTable_unregisterReader
+  @package  program_table
+
+  @brief    Releases a reader slot.
+
+  @param    table   [in]:   Table the slot belongs to.
+  @param    reader  [in]:   Slot returned by ProgramTable_registerReader.
+ =========================================================================== **/
+void ProgramTable_unregisterReader(program_table_t* table, int reader)
+{
+    if (table != NULL)
+    {
+        Epoch_unregister(table->epoch, reader);
+    }
+}
+
+/** ============================================================================
+  @fn       ProgramTable_evaluate
+  @package  program_table
+
+  @brief    Evaluates an expression without variables through the shared
+            table.
+
+  @param    table       [in]:   Table to use.
+  @param    reader      [in]:   Slot returned by ProgramTable_registerReader.
+  @param    expression  [in]:   Infix expression.
+  @param    result      [out]:  Receives the value of the expression.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -EINVAL if the expression does not compile or evaluate, has
+            variables or reader is not a valid slot.
+ =========================================================================== **/
+int ProgramTable_evaluate(program_table_t* table, int reader, const char* expression, double* result)
+{
+    return ProgramTable_evaluateWith(table, reader, expression, NULL, result);
+}
+
+/** ============================================================================
+  @fn       ProgramTable_evaluateWith
+  @package  program_table
+
+  @brief    Evaluates an expression with bound variables through the shared
+            table.
+
+  @details  On a hit the cached program is evaluated without taking any lock.
+            On a miss the expression is compiled outside any read-side
+            section and pushed onto the bucket head with a compare-and-swap.
+            A failed swap only rescans the nodes published meanwhile; if one
+            of them holds the same expression, the local copy is dropped.
+
+  @param    table       [in]:   Table to use.
+  @param    reader      [in]:   Slot returned by ProgramTable_registerReader.
+  @param    expression  [in]:   Infix expression.
+  @param    variables   [in]:   One value per variable, in order of first use
+                                in the expression. May be NULL when the
+                                expression has no variables.
+  @param    result      [out]:  Receives the value of the expression.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -EINVAL if the expression does not compile or evaluate,
+            variables are missing or reader is not a valid slot.
+ =========================================================================== **/
+int ProgramTable_evaluateWith(program_table_t* table, int reader, const char* expression, const double* variables, double* result)
+{
+    /*< Variable Declarations >*/
+    int ret                         = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    uint64_t hash                   = 0u;
+    size_t length                   = 0u;
+
+    table_buckets_t* buckets        = NULL;
+    _Atomic(table_node_t*)* head    = NULL;
+    table_node_t* first             = NULL;
+    table_node_t* node              = NULL;
+    rpn_program_t* compiled         = NULL;
+    const rpn_program_t* program    = NULL;
+
+    /*< Security Checks >*/
+    if ((table == NULL) || (expression == NULL) || (result == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    hash = ProgramTable_hash(expression, &length);
+
+    /*< Start Function Algorithm >*/
+    ret = Epoch_enter(table->epoch, reader);
+    if (ret != FUNCTION_SUCCESS)
+    {
+        goto end_of_function;
+    }
+
+    buckets = atomic_load(&table->buckets);
+    first   = atomic_load_explicit(&buckets->heads[hash & buckets->mask], memory_order_acquire);
+    program = ProgramTable_find(first, NULL, hash, expression);
+
+    if (program != NULL)
+    {
+        ret = Program_evaluateWith(program, variables, result);
+        Epoch_exit(table->epoch, reader);
+        goto end_of_function;
+    }
+
+    Epoch_exit(table->epoch, reader);
+
+    /*< Miss: compile without holding up writers >*/
+    ret = Program_compile(expression, &compiled);
+    if (ret != FUNCTION_SUCCESS)
+    {
+        goto end_of_function;
+    }
+
+    node = Alloc_malloc(sizeof(table_node_t) + length + 1u);
+    if (node == NULL)
+    {
+        Program_destroy(compiled);
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    node->hash      = hash;
+    node->program   = compiled;
+    memcpy(node->expression, expression, length + 1u);
+
+    /*< The slot was validated by the first Epoch_enter >*/
+    (void)Epoch_enter(table->epoch, reader);
+
+    buckets = atomic_load(&table->buckets);
+    head    = &buckets->heads[hash & buckets->mask];
+    first   = atomic_load_explicit(head, memory_order_acquire);
+    program = ProgramTable_find(first, NULL, hash, expression);
+
+    while (program == NULL)
+    {
+        node->next = first;
+
+        if (atomic_compare_exchange_weak_explicit(head, &first, node, memory_order_release, memory_order_acquire))
+        {
+            program = compiled;
+            node    = NULL;
+            break;
+        }
+
+        /*< Only nodes pushed since the last attempt can hold the key >*/
+        program = ProgramTable_find(first, node->next, hash, expression);
+    }
+
+    ret = Program_evaluateWith(program, variables, result);
+
+    Epoch_exit(table->epoch, reader);
+
+    /*< Lost the race: the published copy is used instead >*/
+    if (node != NULL)
+    {
+        Program_destroy(node->program);
+        Alloc_free(node);
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       ProgramTable_flush
+  @package  program_table
+
+  @brief    Drops every cached program.
+
+  @details  Publishes an empty bucket array and releases the old entries after
+            an epoch grace period. Concurrent readers are never blocked.
+            Must not be called from inside ProgramTable_evaluate.
+
+  @param    table   [in]:   Table to flush.
+
+  @return   0 on success.
+            -ENOMEM if table is NULL or an allocation fails.
+ =========================================================================== **/
+int ProgramTable_flush(program_table_t* table)
+{
+    /*< Variable Declarations >*/
+    int ret                     = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    table_buckets_t* fresh      = NULL;
+    table_buckets_t* previous   = NULL;
+
+    /*< Security Checks >*/
+    if (table == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    fresh = ProgramTable_newBuckets(table->bucket_count);
+    if (fresh == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    pthread_mutex_lock(&table->flush_lock);
+
+    previous = atomic_exchange(&table->buckets, fresh);
+    (void)Epoch_synchronize(table->epoch);
+
+    pthread_mutex_unlock(&table->flush_lock);
+
+    ProgramTable_freeBuckets(previous);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/*< end of file >*/
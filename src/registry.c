@@ -0,0 +1,488 @@
+/** ===========================================================================
+    @ingroup    Registry
+    @addtogroup Registry_Module registry
+
+    @package    registry
+    @brief      This module holds user-defined functions such as
+                "f(x, y) = x^2 + sin(y)" for the compiler to inline.
+
+    @file       registry.c
+    @headerfile registry.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    Functions live in individual allocations so that pointers
+                returned by Registry_find stay valid while the table grows.
+                The table stores them by hash with linear probing and doubles
+                when half full.
+
+    @see        - Registry_create
+                - Registry_define
+                - Registry_find
+ =========================================================================== **/
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+
+/*< Implements >*/
+#include <alloc.h>
+#include <RPNCalculator.h>
+#include <program.h>
+#include <registry.h>
+
+/* ==================================== *\
+ *            PRIVATE DEFINES           *
+\* ==================================== */
+
+/** ====================================
+  @def      FUNCTION_SUCCESS
+  @package  registry
+  @brief    Indicates successful function
+            execution.
+
+  @details  Represents a successful
+            operation, typically with
+            a value of 0.
+ ==================================== **/
+#define FUNCTION_SUCCESS        (int)(0)
+
+/** ====================================
+  @def      INITIAL_CAPACITY
+  @package  registry
+  @brief    Slots of an empty registry,
+            a power of two.
+ ==================================== **/
+#define INITIAL_CAPACITY        (size_t)(16U)
+
+/** ====================================
+  @def      DEFINITION_SEPARATOR
+  @package  registry
+  @brief    Separates the head of a
+            definition from its body.
+ ==================================== **/
+#define DEFINITION_SEPARATOR    '='
+
+/* ==================================== *\
+ *       PRIVATE TYPES DEFINITION       *
+\* ==================================== */
+
+/** ============================================================================
+  @struct   registry
+  @package  registry
+
+  @brief    Represents a table of user-defined functions.
+============================================================================ **/
+struct registry
+{
+    size_t                  capacity;   /*< Number of slots, a power of two >*/
+    size_t                  count;      /*< Number of functions >*/
+    registry_function_t**   slots;      /*< Hash slots, NULL when free >*/
+};
+
+/* ==================================== *\
+ *     PRIVATE FUNCTIONS DEFINITION     *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Registry_hash
+  @package  registry
+
+  @brief    Hashes a name with FNV-1a.
+
+  @param    name    [in]:   NUL-terminated name.
+
+  @return   64-bit hash.
+ =========================================================================== **/
+static uint64_t Registry_hash(const char* name)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+
+    while (*name != '\0')
+    {
+        hash = (hash ^ (uint64_t)(unsigned char)(*name++)) * 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+/** ============================================================================
+  @fn       Registry_slot
+  @package  registry
+
+  @brief    Finds the slot of a name, or the free slot where it belongs.
+
+  @param    slots       [in]:   Hash slots.
+  @param    capacity    [in]:   Number of slots, a power of two.
+  @param    name        [in]:   Name to look up.
+
+  @return   Slot index.
+ =========================================================================== **/
+static size_t Registry_slot(registry_function_t* const* slots, size_t capacity, const char* name)
+{
+    size_t slot = (size_t)Registry_hash(name) & (capacity - 1u);
+
+    while ((slots[slot] != NULL) && (strcmp(slots[slot]->name, name) != 0))
+    {
+        slot = (slot + 1u) & (capacity - 1u);
+    }
+
+    return slot;
+}
+
+/** ============================================================================
+  @fn       Registry_grow
+  @package  registry
+
+  @brief    Doubles the number of slots and rehashes every function.
+
+  @param    registry    [in/out]:   Registry to grow.
+
+  @return   0 on success.
+            -ENOMEM if the allocation fails.
+ =========================================================================== **/
+static int Registry_grow(registry_t* registry)
+{
+    /*< Variable Declarations >*/
+    int ret                         = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t iterator                 = 0u;
+    size_t capacity                 = 0u;
+    registry_function_t** slots     = NULL;
+
+    /*< Assign Initial Values >*/
+    capacity    = registry->capacity * 2u;
+    slots       = Alloc_calloc(capacity, sizeof(registry_function_t*));
+
+    /*< Security Checks >*/
+    if (slots == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    for (iterator = 0u; iterator < registry->capacity; iterator++)
+    {
+        if (registry->slots[iterator] != NULL)
+        {
+            slots[Registry_slot(slots, capacity, registry->slots[iterator]->name)] = registry->slots[iterator];
+        }
+    }
+
+    Alloc_free(registry->slots);
+    registry->slots     = slots;
+    registry->capacity  = capacity;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Registry_parseHead
+  @package  registry
+
+  @brief    Parses "name(p1, ..., pn)" into a function record.
+
+  @param    registry    [in]:   Registry the function is added to.
+  @param    head        [in]:   NUL-terminated head of the definition.
+  @param    function    [out]:  Receives the name, arity and parameters.
+
+  @return   0 on success.
+            -EINVAL if the head is malformed, a parameter is repeated or
+            names a user function, or there are too many parameters.
+ =========================================================================== **/
+static int Registry_parseHead(const registry_t* registry, const char* head, registry_function_t* function)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    int count           = 0;
+    int iterator        = 0;
+    uint32_t param      = 0u;
+
+    char tokens[MAX_NUM_TOKENS][MAX_TOKEN_LEN];
+
+    /*< Assign Initial Values >*/
+    count = RPNCalculator_tokenize(head, tokens);
+
+    /*< Security Checks >*/
+    if (
+            (count < 3)
+                    ||
+            (RPNCalculator_isVariable(tokens[0]) != FUNCTION_SUCCESS)
+                    ||
+            (strcmp(tokens[1], "(") != 0)
+                    ||
+            (strcmp(tokens[count - 1], ")") != 0)
+        )
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    strcpy(function->name, tokens[0]);
+    function->arity = 0u;
+
+    /*< Parameters alternate with commas: "(" p1 "," p2 ... ")" >*/
+    for (iterator = 2; iterator < (count - 1); iterator += 2)
+    {
+        if (
+                (function->arity >= REGISTRY_MAX_PARAMS)
+                                ||
+                (RPNCalculator_isVariable(tokens[iterator]) != FUNCTION_SUCCESS)
+                                ||
+                (Registry_find(registry, tokens[iterator]) != NULL)
+                                ||
+                (((iterator + 1) < (count - 1)) && (strcmp(tokens[iterator + 1], ",") != 0))
+                                ||
+                ((iterator + 2) == (count - 1) && (strcmp(tokens[iterator + 1], ",") == 0))
+            )
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+
+        for (param = 0u; param < function->arity; param++)
+        {
+            if (strcmp(function->params[param], tokens[iterator]) == 0)
+            {
+                ret = -(EINVAL);
+                goto end_of_function;
+            }
+        }
+
+        strcpy(function->params[function->arity++], tokens[iterator]);
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS DEFINITION      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Registry_create
+  @package  registry
+
+  @brief    Creates an empty registry.
+
+  @param    registry    [out]:  Receives the new registry.
+
+  @return   0 on success.
+            -ENOMEM if registry is NULL or an allocation fails.
+ =========================================================================== **/
+int Registry_create(registry_t** registry)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    registry_t* created     = NULL;
+
+    /*< Security Checks >*/
+    if (registry == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    created = Alloc_calloc(1u, sizeof(registry_t));
+    if (created == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    created->slots = Alloc_calloc(INITIAL_CAPACITY, sizeof(registry_function_t*));
+    if (created->slots == NULL)
+    {
+        Alloc_free(created);
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    created->capacity   = INITIAL_CAPACITY;
+    *registry           = created;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Registry_destroy
+  @package  registry
+
+  @brief    Releases a registry and the bodies of its functions.
+
+  @param    registry    [in]:   Registry to release. NULL is ignored.
+ =========================================================================== **/
+void Registry_destroy(registry_t* registry)
+{
+    size_t iterator = 0u;
+
+    if (registry == NULL)
+    {
+        return;
+    }
+
+    for (iterator = 0u; iterator < registry->capacity; iterator++)
+    {
+        if (registry->slots[iterator] != NULL)
+        {
+            Program_destroy(registry->slots[iterator]->body);
+            Alloc_free(registry->slots[iterator]);
+        }
+    }
+
+    Alloc_free(registry->slots);
+    Alloc_free(registry);
+}
+
+/** ============================================================================
+  @fn       Registry_define
+  @package  registry
+
+  @brief    Compiles and registers a function definition.
+
+  @details  The definition has the form "name(p1, ..., pn) = body", with at
+            most REGISTRY_MAX_PARAMS distinct parameters. The body may use
+            the parameters, free variables, and functions already in the
+            registry.
+
+  @param    registry    [in/out]:   Registry to update.
+  @param    definition  [in]:       Function definition.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -EINVAL if the definition is malformed or its body does not
+            compile.
+ =========================================================================== **/
+int Registry_define(registry_t* registry, const char* definition)
+{
+    /*< Variable Declarations >*/
+    int ret                         = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t slot                     = 0u;
+    size_t head_length              = 0u;
+    const char* separator           = NULL;
+    registry_function_t* function   = NULL;
+    rpn_program_t* body             = NULL;
+
+    char head[MAX_EXPRESSION_SIZE];
+
+    /*< Security Checks >*/
+    if ((registry == NULL) || (definition == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    separator = strchr(definition, DEFINITION_SEPARATOR);
+    if (separator == NULL)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    head_length = (size_t)(separator - definition);
+    if (head_length >= MAX_EXPRESSION_SIZE)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    memcpy(head, definition, head_length);
+    head[head_length] = '\0';
+
+    function = Alloc_calloc(1u, sizeof(registry_function_t));
+    if (function == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    ret = Registry_parseHead(registry, head, function);
+    if (ret != FUNCTION_SUCCESS)
+    {
+        goto end_of_function;
+    }
+
+    ret = Program_compileWith(separator + 1, registry, &body);
+    if (ret != FUNCTION_SUCCESS)
+    {
+        goto end_of_function;
+    }
+
+    function->body = body;
+    body = NULL;
+
+    /*< Redefinition: the record in place is updated, so lookups stay valid >*/
+    slot = Registry_slot(registry->slots, registry->capacity, function->name);
+    if (registry->slots[slot] != NULL)
+    {
+        Program_destroy(registry->slots[slot]->body);
+        memcpy(registry->slots[slot], function, sizeof(registry_function_t));
+        goto end_of_function;
+    }
+
+    if (((registry->count + 1u) * 2u) > registry->capacity)
+    {
+        ret = Registry_grow(registry);
+        if (ret != FUNCTION_SUCCESS)
+        {
+            Program_destroy(function->body);
+            goto end_of_function;
+        }
+
+        slot = Registry_slot(registry->slots, registry->capacity, function->name);
+    }
+
+    registry->slots[slot] = function;
+    registry->count++;
+    function = NULL;
+
+    /*< Function Output >*/
+end_of_function:
+    Alloc_free(function);
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Registry_find
+  @package  registry
+
+  @brief    Looks a user function up by name.
+
+  @param    registry    [in]:   Registry to search.
+  @param    name        [in]:   Function name.
+
+  @return   The function, or NULL if the registry or name is NULL or the
+            function does not exist.
+ =========================================================================== **/
+const registry_function_t* Registry_find(const registry_t* registry, const char* name)
+{
+    if ((registry == NULL) || (name == NULL))
+    {
+        return NULL;
+    }
+
+    return registry->slots[Registry_slot(registry->slots, registry->capacity, name)];
+}
+
+/*< end of file >*/
@@ -0,0 +1,2029 @@
+/** ===========================================================================
+    @ingroup    Session
+    @addtogroup Session_Module session
+
+    @package    session
+    @brief      This module keeps the state of an interactive, HP-style
+                calculator: a persistent value stack and an infix input line
+                previewed on every edit.
+
+    @file       session.c
+    @headerfile session.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    Tokens of the input line are stored with their span in the
+                buffer. An edit rescans from the first token it touches with
+                RPNCalculator_nextToken into a scratch list, until the scan
+                lands on the shifted start of an old token past the edit;
+                the old tail is then moved behind the new tokens.
+
+                The preview converts the tokens with
+                RPNCalculator_infixToPostfix and evaluates the postfix form
+                on a stack_val_t, carrying next to every value the hash of
+                the subtree that produced it. Results of function, power and
+                factorial nodes are looked up in a direct-mapped cache keyed
+                by that hash before they are computed. Variable leaves hash
+                their name together with their current value.
+
+                The session is one fixed-size block whose first bytes are a
+                magic string and the block size. Stored programs are copied
+                into the trailing arena at 8-byte aligned offsets, so the
+                block holds no pointer and a snapshot is the block itself.
+
+    @see        - Session_create
+                - Session_apply
+                - Session_edit
+                - Session_preview
+                - Session_save
+                - Session_restore
+ =========================================================================== **/
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+#include <limits.h>
+#include <math.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/*< Implements >*/
+#include <alloc.h>
+#include <RPNCalculator.h>
+#include <stackops.h>
+#include <program.h>
+#include <session.h>
+
+/* ==================================== *\
+ *            PRIVATE DEFINES           *
+\* ==================================== */
+
+/** ====================================
+  @def      FUNCTION_SUCCESS
+  @package  session
+  @brief    Indicates successful function
+            execution.
+
+  @details  Represents a successful
+            operation, typically with
+            a value of 0.
+ ==================================== **/
+#define FUNCTION_SUCCESS        (int)(0)
+
+/** ====================================
+  @def      EMPTY_TOP
+  @package  session
+  @brief    Top index of an empty value
+            stack.
+ ==================================== **/
+#define EMPTY_TOP               (int)(-1)
+
+/** ====================================
+  @def      MEMO_SIZE
+  @package  session
+  @brief    Number of entries of the
+            subtree cache, a power of
+            two.
+ ==================================== **/
+#define MEMO_SIZE               (size_t)(4096U)
+
+/** ====================================
+  @def      FACTORIAL_LIMIT
+  @package  session
+  @brief    Largest factorial that fits
+            a double; beyond it the
+            result is infinite.
+ ==================================== **/
+#define FACTORIAL_LIMIT         (double)(170.0)
+
+/** ====================================
+  @def      HASH_OFFSET
+  @package  session
+  @brief    FNV-1a 64-bit offset basis.
+ ==================================== **/
+#define HASH_OFFSET             (uint64_t)(0xcbf29ce484222325ULL)
+
+/** ====================================
+  @def      HASH_PRIME
+  @package  session
+  @brief    FNV-1a 64-bit prime.
+ ==================================== **/
+#define HASH_PRIME              (uint64_t)(0x100000001b3ULL)
+
+/** ====================================
+  @def      SNAPSHOT_MAGIC
+  @package  session
+  @brief    Identifies a session block
+            and its snapshot files.
+ ==================================== **/
+#define SNAPSHOT_MAGIC          "RPNSES01"
+
+/** ====================================
+  @def      SNAPSHOT_MAGIC_SIZE
+  @package  session
+  @brief    Length of SNAPSHOT_MAGIC
+            without terminator.
+ ==================================== **/
+#define SNAPSHOT_MAGIC_SIZE     (size_t)(8U)
+
+/** ====================================
+  @def      ARENA_ALIGNMENT
+  @package  session
+  @brief    Alignment of the programs
+            stored in the arena.
+ ==================================== **/
+#define ARENA_ALIGNMENT         (size_t)(8U)
+
+/* ==================================== *\
+ *       PRIVATE TYPES DEFINITION       *
+\* ==================================== */
+
+/** ============================================================================
+  @struct   session_span_t
+  @package  session
+
+  @typedef  session_span_t
+
+  @brief    Represents the place of a token in the input line.
+============================================================================ **/
+typedef struct
+{
+    size_t  start;      /*< Offset of the first character >*/
+    size_t  length;     /*< Number of characters >*/
+} session_span_t;
+
+/** ============================================================================
+  @struct   session_memo_t
+  @package  session
+
+  @typedef  session_memo_t
+
+  @brief    Represents a cached subtree value.
+============================================================================ **/
+typedef struct
+{
+    uint64_t    hash;   /*< Subtree hash, 0 for an empty entry >*/
+    double      value;  /*< Value of the subtree >*/
+} session_memo_t;
+
+/** ============================================================================
+  @struct   session_variable_t
+  @package  session
+
+  @typedef  session_variable_t
+
+  @brief    Represents a named variable.
+============================================================================ **/
+typedef struct
+{
+    char    name[MAX_TOKEN_LEN];    /*< Variable name >*/
+    double  value;                  /*< Current value >*/
+} session_variable_t;
+
+/** ============================================================================
+  @struct   session_program_t
+  @package  session
+
+  @typedef  session_program_t
+
+  @brief    Represents a named program stored in the arena.
+============================================================================ **/
+typedef struct
+{
+    char        name[MAX_TOKEN_LEN];    /*< Program name >*/
+    uint32_t    offset;                 /*< Offset of the rpn_program_t in the arena >*/
+} session_program_t;
+
+/** ============================================================================
+  @struct   rpnSession
+  @package  session
+
+  @brief    Represents a calculator session.
+============================================================================ **/
+struct rpnSession
+{
+    char                magic[SNAPSHOT_MAGIC_SIZE];                         /*< SNAPSHOT_MAGIC >*/
+    uint32_t            size;                                               /*< Size of this block >*/
+    uint32_t            mapped;                                             /*< Non-zero if mapped from a snapshot >*/
+    stack_val_t         stack;                                              /*< Persistent value stack >*/
+    char                input[MAX_EXPRESSION_SIZE];                         /*< Input line >*/
+    size_t              input_length;                                       /*< Characters in the input line >*/
+    int                 token_count;                                        /*< Tokens of the input line >*/
+    int                 token_status;                                       /*< 0, or the tokenizer error >*/
+    session_span_t      spans[MAX_NUM_TOKENS];                              /*< Token spans >*/
+    char                tokens[MAX_NUM_TOKENS][MAX_TOKEN_LEN];              /*< Token texts >*/
+    session_span_t      scratch_spans[MAX_NUM_TOKENS];                      /*< Spans of rescanned tokens >*/
+    char                scratch[MAX_NUM_TOKENS][MAX_TOKEN_LEN];             /*< Texts of rescanned tokens >*/
+    char                postfix[MAX_NUM_TOKENS][MAX_TOKEN_LEN];             /*< Postfix form of the input >*/
+    int                 preview_status;                                     /*< Result of the last preview >*/
+    int                 preview_valid;                                      /*< Non-zero if no edit since >*/
+    double              preview_value;                                      /*< Value of the last preview >*/
+    session_memo_t      memo[MEMO_SIZE];                                    /*< Subtree cache >*/
+    uint32_t            variable_count;                                     /*< Named variables >*/
+    uint32_t            program_count;                                      /*< Named programs >*/
+    uint32_t            arena_used;                                         /*< Arena bytes in use >*/
+    session_variable_t  variables[SESSION_MAX_VARIABLES];                   /*< Variable table >*/
+    session_program_t   programs[SESSION_MAX_PROGRAMS];                     /*< Program table >*/
+    uint64_t            arena[SESSION_ARENA_SIZE / sizeof(uint64_t)];       /*< Stored program blocks >*/
+};
+
+/* ==================================== *\
+ *     PRIVATE FUNCTIONS DEFINITION     *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Session_arity
+  @package  session
+
+  @brief    Returns the number of operands of an operator or function.
+
+  @param    token   [in]:   Operator or function name.
+
+  @return   1 to MAX_FUNCTION_ARITY on success.
+            -EINVAL if the token is neither an operator nor a function.
+ =========================================================================== **/
+static int Session_arity(const char* token)
+{
+    int index = RPNCalculator_whichOperator(token);
+
+    if (index >= FUNCTION_SUCCESS)
+    {
+        return (index == OP_FACT) ? 1 : 2;
+    }
+
+    return RPNCalculator_functionArity(token);
+}
+
+/** ============================================================================
+  @fn       Session_operate
+  @package  session
+
+  @brief    Replaces the operands on a value stack by the result of a token.
+
+  @details  The operands are validated before anything is popped, so the
+            stack is unchanged on failure.
+
+  @param    stack   [in/out]:   Value stack.
+  @param    token   [in]:       Operator or function name.
+
+  @return   0 on success.
+            -EINVAL if the token is unknown, lacks operands or the operation
+            fails.
+ =========================================================================== **/
+static int Session_operate(stack_val_t* stack, const char* token)
+{
+    /*< Variable Declarations >*/
+    int ret         = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    int arity       = 0;
+    int index       = 0;
+    double left     = 0.0;
+    double right    = 0.0;
+    double result   = 0.0;
+
+    /*< Assign Initial Values >*/
+    arity = Session_arity(token);
+
+    /*< Security Checks >*/
+    if ((arity < FUNCTION_SUCCESS) || (stack->top < (arity - 1)))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    right   = stack->data[stack->top];
+    index   = RPNCalculator_whichOperator(token);
+
+    if (index < FUNCTION_SUCCESS)
+    {
+        /*< The arguments lie in call order at the top of the stack >*/
+        result = RPNCalculator_applyFunctionArgs(token, &stack->data[stack->top - (arity - 1)]);
+    }
+    else if (index == OP_FACT)
+    {
+        if ((right < 0.0) || ((right - (int)(right)) != 0.0))
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+
+        /*< Keeps a keystroke like "99999!" from recursing that deep >*/
+        result = (right > FACTORIAL_LIMIT) ? INFINITY : RPNCalculator_factorialCalculate((unsigned int)right);
+    }
+    else
+    {
+        left = stack->data[stack->top - 1];
+
+        if ((index == OP_DIV) && (right == 0.0))
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+
+        result = (index == OP_ADD) ? (left + right) :
+                 (index == OP_SUB) ? (left - right) :
+                 (index == OP_MUL) ? (left * right) :
+                 (index == OP_DIV) ? (left / right) : pow(left, right);
+    }
+
+    stack->top                  -= (arity - 1);
+    stack->data[stack->top]     = result;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Session_hashToken
+  @package  session
+
+  @brief    Hashes the text of a token with FNV-1a.
+
+  @param    token   [in]:   NUL-terminated token.
+
+  @return   64-bit hash.
+ =========================================================================== **/
+static uint64_t Session_hashToken(const char* token)
+{
+    uint64_t hash = HASH_OFFSET;
+
+    while (*token != '\0')
+    {
+        hash = (hash ^ (uint64_t)(unsigned char)(*token++)) * HASH_PRIME;
+    }
+
+    return hash;
+}
+
+/** ============================================================================
+  @fn       Session_hashNode
+  @package  session
+
+  @brief    Combines the hash of an operator with the hashes of its operands.
+
+  @param    token       [in]:   Hash of the operator or function name.
+  @param    operands    [in]:   Operand hashes, left to right.
+  @param    arity       [in]:   Number of operands.
+
+  @return   Non-zero 64-bit hash.
+ =========================================================================== **/
+static uint64_t Session_hashNode(uint64_t token, const uint64_t* operands, int arity)
+{
+    uint64_t hash   = token;
+    int iterator    = 0;
+
+    for (iterator = 0; iterator < arity; iterator++)
+    {
+        hash = (hash ^ operands[iterator]) * HASH_PRIME;
+        hash ^= hash >> 29U;
+    }
+
+    hash = (hash ^ (hash >> 32U)) * 0xd6e8feb86659fd93ULL;
+    hash ^= hash >> 32U;
+
+    return (hash == 0u) ? 1u : hash;
+}
+
+/** ============================================================================
+  @fn       Session_findVariable
+  @package  session
+
+  @brief    Looks up a named variable.
+
+  @param    session [in]:   Session to search.
+  @param    name    [in]:   Variable name.
+
+  @return   Index in the variable table on success.
+            -ENOENT if the variable does not exist.
+ =========================================================================== **/
+static int Session_findVariable(const rpn_session_t* session, const char* name)
+{
+    uint32_t iterator = 0u;
+
+    for (iterator = 0u; iterator < session->variable_count; iterator++)
+    {
+        if (strcmp(session->variables[iterator].name, name) == FUNCTION_SUCCESS)
+        {
+            return (int)iterator;
+        }
+    }
+
+    return -(ENOENT);
+}
+
+/** ============================================================================
+  @fn       Session_findProgram
+  @package  session
+
+  @brief    Looks up a named program.
+
+  @param    session [in]:   Session to search.
+  @param    name    [in]:   Program name.
+
+  @return   Index in the program table on success.
+            -ENOENT if the program does not exist.
+ =========================================================================== **/
+static int Session_findProgram(const rpn_session_t* session, const char* name)
+{
+    uint32_t iterator = 0u;
+
+    for (iterator = 0u; iterator < session->program_count; iterator++)
+    {
+        if (strcmp(session->programs[iterator].name, name) == FUNCTION_SUCCESS)
+        {
+            return (int)iterator;
+        }
+    }
+
+    return -(ENOENT);
+}
+
+/** ============================================================================
+  @fn       Session_retokenize
+  @package  session
+
+  @brief    Updates the tokens after an edit of the input line.
+
+  @param    session     [in/out]:   Session whose input was edited.
+  @param    offset      [in]:       Start of the edit.
+  @param    removed     [in]:       Number of characters removed.
+  @param    inserted    [in]:       Number of characters inserted.
+
+  @return   0 on success.
+            -EINVAL if the input does not tokenize or has too many tokens.
+ =========================================================================== **/
+static int Session_retokenize(rpn_session_t* session, size_t offset, size_t removed, size_t inserted)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    int length          = 0;
+    size_t first        = 0u;
+    size_t old          = 0u;
+    size_t count        = 0u;
+    size_t tail         = 0u;
+    size_t start        = 0u;
+    size_t position     = 0u;
+    size_t iterator     = 0u;
+    size_t edit_end     = 0u;
+    size_t token_count  = 0u;
+
+    /*< Assign Initial Values >*/
+    edit_end    = offset + inserted;
+    token_count = (session->token_status == FUNCTION_SUCCESS) ? (size_t)session->token_count : 0u;
+
+    /*< Start Function Algorithm >*/
+    /*< First token that ends at or after the edit, which may have changed >*/
+    while ((first < token_count) && ((session->spans[first].start + session->spans[first].length) < offset))
+    {
+        first++;
+    }
+
+    position    = ((first < token_count) && (session->spans[first].start < offset)) ? session->spans[first].start : offset;
+    old         = first;
+
+    for (;;)
+    {
+        start = position;
+        while (isspace((unsigned char)session->input[start]))
+        {
+            start++;
+        }
+
+        if (session->input[start] == '\0')
+        {
+            old = token_count;
+            break;
+        }
+
+        /*< Past the edit, an old token starting here is unchanged, and so is the rest >*/
+        if (start >= edit_end)
+        {
+            while ((old < token_count) && ((session->spans[old].start + inserted) < (start + removed)))
+            {
+                old++;
+            }
+
+            if ((old < token_count) && ((session->spans[old].start + inserted) == (start + removed)))
+            {
+                break;
+            }
+        }
+
+        if ((first + count) >= MAX_NUM_TOKENS)
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+
+        length = RPNCalculator_nextToken(session->input, &position, session->scratch[count]);
+        if (length < FUNCTION_SUCCESS)
+        {
+            ret = length;
+            goto end_of_function;
+        }
+
+        session->scratch_spans[count].start     = start;
+        session->scratch_spans[count].length    = position - start;
+        count++;
+    }
+
+    tail = token_count - old;
+    if ((first + count + tail) > MAX_NUM_TOKENS)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    memmove(&session->spans[first + count], &session->spans[old], tail * sizeof(session_span_t));
+    memmove(session->tokens[first + count], session->tokens[old], tail * MAX_TOKEN_LEN);
+
+    for (iterator = first + count; iterator < (first + count + tail); iterator++)
+    {
+        session->spans[iterator].start = (session->spans[iterator].start + inserted) - removed;
+    }
+
+    memcpy(&session->spans[first], session->scratch_spans, count * sizeof(session_span_t));
+    memcpy(session->tokens[first], session->scratch, count * MAX_TOKEN_LEN);
+
+    session->token_count = (int)(first + count + tail);
+
+    /*< Function Output >*/
+end_of_function:
+    session->token_status = ret;
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Session_evaluate
+  @package  session
+
+  @brief    Evaluates the tokens of the input line, reusing cached subtrees.
+
+  @param    session [in/out]:   Session to evaluate.
+  @param    result  [out]:      Receives the value.
+
+  @return   0 on success.
+            -EINVAL if the input is empty, uses an unknown variable or fails
+            to evaluate.
+ =========================================================================== **/
+static int Session_evaluate(rpn_session_t* session, double* result)
+{
+    /*< Variable Declarations >*/
+    int ret                             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    int number                          = 0;
+    int arity                           = 0;
+    int index                           = 0;
+    int cached                          = 0;
+    int iterator                        = 0;
+    int variable                        = 0;
+    char* token                         = NULL;
+    char* stop                          = NULL;
+    uint64_t hash                       = 0u;
+    uint64_t bits                       = 0u;
+    session_memo_t* entry               = NULL;
+
+    stack_val_t values                  = {0};
+    uint64_t hashes[MAX_STACK_SIZE];
+
+    /*< Assign Initial Values >*/
+    values.top = EMPTY_TOP;
+
+    /*< Security Checks >*/
+    if (session->token_count == 0)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    number = RPNCalculator_infixToPostfix(session->tokens, session->postfix, session->token_count);
+    if (number <= FUNCTION_SUCCESS)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    for (iterator = 0; iterator < number; iterator++)
+    {
+        token = session->postfix[iterator];
+
+        if (isdigit((unsigned char)token[0]) || ((token[0] == '.') && isdigit((unsigned char)token[1])))
+        {
+            if (Stack_pushVal(&values, strtod(token, &stop)) != FUNCTION_SUCCESS)
+            {
+                ret = -(EINVAL);
+                goto end_of_function;
+            }
+
+            hashes[values.top] = Session_hashToken(token);
+            continue;
+        }
+
+        if (RPNCalculator_isVariable(token) == FUNCTION_SUCCESS)
+        {
+            variable = Session_findVariable(session, token);
+            if (
+                    (variable < FUNCTION_SUCCESS)
+                                ||
+                    (Stack_pushVal(&values, session->variables[variable].value) != FUNCTION_SUCCESS)
+                )
+            {
+                ret = -(EINVAL);
+                goto end_of_function;
+            }
+
+            /*< The value is part of the hash, so a new value misses the cache >*/
+            memcpy(&bits, &session->variables[variable].value, sizeof(bits));
+            hashes[values.top] = Session_hashNode(Session_hashToken(token), &bits, 1);
+            continue;
+        }
+
+        arity = Session_arity(token);
+        if ((arity < FUNCTION_SUCCESS) || (values.top < (arity - 1)))
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+
+        /*< Arithmetic is cheaper than a lookup; cache only math library calls >*/
+        index   = RPNCalculator_whichOperator(token);
+        cached  = (index < FUNCTION_SUCCESS) || (index == OP_POW) || (index == OP_FACT);
+        hash    = Session_hashNode(Session_hashToken(token), &hashes[values.top - (arity - 1)], arity);
+        entry   = &session->memo[hash & (MEMO_SIZE - 1u)];
+
+        if (cached && (entry->hash == hash))
+        {
+            values.top                  -= (arity - 1);
+            values.data[values.top]     = entry->value;
+        }
+        else
+        {
+            ret = Session_operate(&values, token);
+            if (ret != FUNCTION_SUCCESS)
+            {
+                goto end_of_function;
+            }
+
+            if (cached)
+            {
+                entry->hash     = hash;
+                entry->value    = values.data[values.top];
+            }
+        }
+
+        hashes[values.top] = hash;
+    }
+
+    if (values.top != 0)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    *result = values.data[0];
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Session_hasNative
+  @package  session
+
+  @brief    Tells whether a program calls a native.
+
+  @param    program [in]:   Program to scan.
+
+  @return   Non-zero if an instruction is OPCODE_NATIVE.
+ =========================================================================== **/
+static int Session_hasNative(const rpn_program_t* program)
+{
+    const program_instr_t* code = PROGRAM_CODE(program);
+    uint32_t iterator           = 0u;
+
+    for (iterator = 0u; iterator < program->code_count; iterator++)
+    {
+        if (code[iterator].opcode == OPCODE_NATIVE)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/** ============================================================================
+  @fn       Session_isName
+  @package  session
+
+  @brief    Tells whether a fixed-size name field is terminated.
+
+  @param    name    [in]:   Field of MAX_TOKEN_LEN characters.
+
+  @return   Non-zero if the field holds a terminator.
+ =========================================================================== **/
+static int Session_isName(const char* name)
+{
+    return memchr(name, '\0', MAX_TOKEN_LEN) != NULL;
+}
+
+/** ============================================================================
+  @fn       Session_checkProgram
+  @package  session
+
+  @brief    Validates a program stored in the arena of a restored session.
+
+  @details  The block must lie inside the used arena, its tables inside the
+            block, and every operand inside its table. Neither the stack
+            depth nor the local slots can exceed the instruction count. The value stack is
+            simulated so that no instruction underflows it or exceeds
+            max_depth, and exactly one value remains. Natives are refused,
+            since their indices only mean something in the process that
+            compiled them.
+
+  @param    session [in]:   Session whose arena holds the program.
+  @param    offset  [in]:   Offset of the program in the arena.
+
+  @return   0 on success.
+            -EINVAL if the program is corrupted or calls a native.
+ =========================================================================== **/
+static int Session_checkProgram(const rpn_session_t* session, uint32_t offset)
+{
+    /*< Variable Declarations >*/
+    int ret                         = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    const rpn_program_t* program    = NULL;
+    const program_instr_t* code     = NULL;
+    uint32_t iterator               = 0u;
+    uint32_t operand                = 0u;
+    uint64_t depth                  = 0u;
+    uint64_t pops                   = 0u;
+    uint64_t limit                  = 0u;
+
+    /*< Security Checks >*/
+    if (
+            ((offset % ARENA_ALIGNMENT) != 0u)
+                                ||
+            (offset > session->arena_used)
+                                ||
+            ((session->arena_used - offset) < sizeof(rpn_program_t))
+        )
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    program = (const rpn_program_t*)((const char*)session->arena + offset);
+    limit   = program->size;
+
+    /*< Start Function Algorithm >*/
+    if (
+            (limit > (session->arena_used - offset))
+                                ||
+            (program->code_count == 0u)
+                                ||
+            (program->var_count > MAX_NUM_TOKENS)
+                                ||
+            (program->max_depth > program->code_count)
+                                ||
+            (program->local_count > program->code_count)
+                                ||
+            ((program->code_offset % sizeof(uint64_t)) != 0u)
+                                ||
+            ((program->const_offset % sizeof(uint64_t)) != 0u)
+                                ||
+            (((uint64_t)program->code_offset + ((uint64_t)program->code_count * sizeof(program_instr_t))) > limit)
+                                ||
+            (((uint64_t)program->const_offset + ((uint64_t)program->const_count * sizeof(double))) > limit)
+                                ||
+            (((uint64_t)program->var_offset + ((uint64_t)program->var_count * MAX_TOKEN_LEN)) > limit)
+                                ||
+            (program->code_offset < sizeof(rpn_program_t))
+                                ||
+            (program->const_offset < sizeof(rpn_program_t))
+                                ||
+            (program->var_offset < sizeof(rpn_program_t))
+        )
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    for (iterator = 0u; iterator < program->var_count; iterator++)
+    {
+        if (!Session_isName(PROGRAM_VARIABLES(program)[iterator]))
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+    }
+
+    code = PROGRAM_CODE(program);
+
+    for (iterator = 0u; iterator < program->code_count; iterator++)
+    {
+        operand = code[iterator].operand;
+
+        switch (code[iterator].opcode)
+        {
+            case OPCODE_CONST:
+                ret     = (operand < program->const_count) ? FUNCTION_SUCCESS : -(EINVAL);
+                pops    = 0u;
+                break;
+
+            case OPCODE_VAR:
+                ret     = (operand < program->var_count) ? FUNCTION_SUCCESS : -(EINVAL);
+                pops    = 0u;
+                break;
+
+            case OPCODE_LOAD:
+                ret     = (operand < program->local_count) ? FUNCTION_SUCCESS : -(EINVAL);
+                pops    = 0u;
+                break;
+
+            case OPCODE_STORE:
+                ret     = (operand < program->local_count) ? FUNCTION_SUCCESS : -(EINVAL);
+                pops    = 1u;
+                break;
+
+            case OPCODE_FUNC:
+                ret     = (operand < (uint32_t)FUNC_COUNT) ? FUNCTION_SUCCESS : -(EINVAL);
+                pops    = 1u;
+                break;
+
+            case OPCODE_FACT:
+            case OPCODE_POW10:
+                pops    = 1u;
+                break;
+
+            case OPCODE_ADD:
+            case OPCODE_SUB:
+            case OPCODE_MUL:
+            case OPCODE_DIV:
+            case OPCODE_POW:
+            case OPCODE_ATAN2:
+            case OPCODE_HYPOT:
+            case OPCODE_MIN:
+            case OPCODE_MAX:
+                pops    = 2u;
+                break;
+
+            case OPCODE_FMA:
+                pops    = 3u;
+                break;
+
+            default:
+                ret     = -(EINVAL);
+                break;
+        }
+
+        if ((ret != FUNCTION_SUCCESS) || (depth < pops))
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+
+        /*< Everything but STORE leaves one value >*/
+        depth = depth - pops + ((code[iterator].opcode == OPCODE_STORE) ? 0u : 1u);
+        if (depth > program->max_depth)
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+    }
+
+    if (depth != 1u)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Session_checkSnapshot
+  @package  session
+
+  @brief    Validates the counts, indices and tables of a mapped snapshot.
+
+  @details  Everything a later call uses as an index or a length is checked
+            against its table, so a truncated or corrupted file is refused
+            instead of read out of bounds.
+
+  @param    session [in]:   Mapped snapshot, magic and size already checked.
+
+  @return   0 on success.
+            -EINVAL if any field is out of range.
+ =========================================================================== **/
+static int Session_checkSnapshot(const rpn_session_t* session)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    uint32_t iterator   = 0u;
+
+    /*< Start Function Algorithm >*/
+    if (
+            (session->variable_count > SESSION_MAX_VARIABLES)
+                                ||
+            (session->program_count > SESSION_MAX_PROGRAMS)
+                                ||
+            (session->arena_used > SESSION_ARENA_SIZE)
+                                ||
+            (session->stack.top < EMPTY_TOP)
+                                ||
+            (session->stack.top >= (int)MAX_STACK_SIZE)
+                                ||
+            (session->token_count < 0)
+                                ||
+            (session->token_count > (int)MAX_NUM_TOKENS)
+                                ||
+            (session->input_length >= MAX_EXPRESSION_SIZE)
+                                ||
+            (session->input[session->input_length] != '\0')
+        )
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    for (iterator = 0u; iterator < (uint32_t)session->token_count; iterator++)
+    {
+        if (
+                (session->spans[iterator].start > session->input_length)
+                                ||
+                (session->spans[iterator].length > (session->input_length - session->spans[iterator].start))
+                                ||
+                (!Session_isName(session->tokens[iterator]))
+            )
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+    }
+
+    for (iterator = 0u; iterator < session->variable_count; iterator++)
+    {
+        if (!Session_isName(session->variables[iterator].name))
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+    }
+
+    for (iterator = 0u; iterator < session->program_count; iterator++)
+    {
+        if (!Session_isName(session->programs[iterator].name))
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+
+        ret = Session_checkProgram(session, session->programs[iterator].offset);
+        if (ret != FUNCTION_SUCCESS)
+        {
+            goto end_of_function;
+        }
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Session_syncDirectory
+  @package  session
+
+  @brief    Flushes the directory holding a file, so a rename into it is
+            durable.
+
+  @param    path    [in]:   Path of a file in the directory.
+
+  @return   0 on success.
+            -EIO if the directory cannot be opened or flushed.
+ =========================================================================== **/
+static int Session_syncDirectory(const char* path)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    int descriptor      = -1;
+    char* separator     = NULL;
+    char directory[PATH_MAX];
+
+    /*< Assign Initial Values >*/
+    if (snprintf(directory, sizeof(directory), "%s", path) >= (int)sizeof(directory))
+    {
+        ret = -(EIO);
+        goto end_of_function;
+    }
+
+    separator = strrchr(directory, '/');
+    if (separator == NULL)
+    {
+        strcpy(directory, ".");
+    }
+    else
+    {
+        separator[(separator == directory) ? 1 : 0] = '\0';
+    }
+
+    /*< Start Function Algorithm >*/
+    descriptor = open(directory, O_RDONLY | O_DIRECTORY);
+    if ((descriptor < 0) || (fsync(descriptor) != 0))
+    {
+        ret = -(EIO);
+        goto end_of_function;
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    if (descriptor >= 0)
+    {
+        close(descriptor);
+    }
+    return ret;
+}
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS DEFINITION      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Session_create
+  @package  session
+
+  @brief    Creates a session with an empty stack and an empty input line.
+
+  @param    session [out]:  Receives the new session.
+
+  @return   0 on success.
+            -ENOMEM if session is NULL or the allocation fails.
+ =========================================================================== **/
+int Session_create(rpn_session_t** session)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    rpn_session_t* created  = NULL;
+
+    /*< Security Checks >*/
+    if (session == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    created = Alloc_calloc(1u, sizeof(rpn_session_t));
+    if (created == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    memcpy(created->magic, SNAPSHOT_MAGIC, SNAPSHOT_MAGIC_SIZE);
+    created->size       = (uint32_t)sizeof(rpn_session_t);
+    created->stack.top  = EMPTY_TOP;
+
+    *session = created;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Session_destroy
+  @package  session
+
+  @brief    Releases a session.
+
+  @details  A session obtained from Session_restore is unmapped.
+
+  @param    session [in]:   Session to release. NULL is ignored.
+ =========================================================================== **/
+void Session_destroy(rpn_session_t* session)
+{
+    if ((session != NULL) && (session->mapped != 0u))
+    {
+        munmap(session, sizeof(rpn_session_t));
+        return;
+    }
+
+    Alloc_free(session);
+}
+
+/** ============================================================================
+  @fn       Session_push
+  @package  session
+
+  @brief    Pushes a value onto level 1.
+
+  @param    session [in/out]:   Session to update.
+  @param    value   [in]:       Value to push.
+
+  @return   0 on success.
+            -ENOMEM if session is NULL.
+            -EINVAL if the stack is full.
+ =========================================================================== **/
+int Session_push(rpn_session_t* session, double value)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    /*< Security Checks >*/
+    if (session == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    ret = Stack_pushVal(&session->stack, value);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Session_pop
+  @package  session
+
+  @brief    Removes the value of level 1.
+
+  @param    session [in/out]:   Session to update.
+  @param    value   [out]:      Receives the value, or NULL to drop it.
+
+  @return   0 on success.
+            -ENOMEM if session is NULL.
+            -EINVAL if the stack is empty.
+ =========================================================================== **/
+int Session_pop(rpn_session_t* session, double* value)
+{
+    /*< Variable Declarations >*/
+    int ret         = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    double popped   = 0.0;
+
+    /*< Security Checks >*/
+    if (session == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if (Stack_isEmptyVal(&session->stack) == STACK_EMPTY)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    popped = Stack_popVal(&session->stack);
+
+    if (value != NULL)
+    {
+        *value = popped;
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Session_swap
+  @package  session
+
+  @brief    Exchanges levels 1 and 2.
+
+  @param    session [in/out]:   Session to update.
+
+  @return   0 on success.
+            -ENOMEM if session is NULL.
+            -EINVAL if the stack holds less than two values.
+ =========================================================================== **/
+int Session_swap(rpn_session_t* session)
+{
+    return Session_roll(session, 2u);
+}
+
+/** ============================================================================
+  @fn       Session_dup
+  @package  session
+
+  @brief    Pushes a copy of level 1.
+
+  @param    session [in/out]:   Session to update.
+
+  @return   0 on success.
+            -ENOMEM if session is NULL.
+            -EINVAL if the stack is empty or full.
+ =========================================================================== **/
+int Session_dup(rpn_session_t* session)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    /*< Security Checks >*/
+    if (session == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if (Stack_isEmptyVal(&session->stack) == STACK_EMPTY)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    ret = Stack_pushVal(&session->stack, session->stack.data[session->stack.top]);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Session_roll
+  @package  session
+
+  @brief    Moves a level to the top, shifting the levels above it down.
+
+  @details  Session_roll(session, 3) turns "a b c" (c on level 1) into
+            "b c a". Level 1 is a no-op and level 2 is a swap.
+
+  @param    session [in/out]:   Session to update.
+  @param    level   [in]:       Level to move, 1 being the top.
+
+  @return   0 on success.
+            -ENOMEM if session is NULL.
+            -EINVAL if level is 0 or deeper than the stack.
+ =========================================================================== **/
+int Session_roll(rpn_session_t* session, size_t level)
+{
+    /*< Variable Declarations >*/
+    int ret         = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t index    = 0u;
+    double value    = 0.0;
+
+    /*< Security Checks >*/
+    if (session == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if ((level == 0u) || (level > (size_t)(session->stack.top + 1)))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    index = (size_t)(session->stack.top + 1) - level;
+    value = session->stack.data[index];
+
+    /*< Start Function Algorithm >*/
+    memmove(&session->stack.data[index], &session->stack.data[index + 1u], (level - 1u) * sizeof(double));
+    session->stack.data[session->stack.top] = value;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Session_depth
+  @package  session
+
+  @brief    Returns the number of values on the stack.
+
+  @param    session [in]:   Session to query.
+
+  @return   Number of values on success.
+            -ENOMEM if session is NULL.
+ =========================================================================== **/
+int Session_depth(const rpn_session_t* session)
+{
+    return (session == NULL) ? -(ENOMEM) : (session->stack.top + 1);
+}
+
+/** ============================================================================
+  @fn       Session_peek
+  @package  session
+
+  @brief    Reads a level without removing it.
+
+  @param    session [in]:   Session to query.
+  @param    level   [in]:   Level to read, 1 being the top.
+  @param    value   [out]:  Receives the value.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -EINVAL if level is 0 or deeper than the stack.
+ =========================================================================== **/
+int Session_peek(const rpn_session_t* session, size_t level, double* value)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    /*< Security Checks >*/
+    if ((session == NULL) || (value == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if ((level == 0u) || (level > (size_t)(session->stack.top + 1)))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    *value = session->stack.data[(size_t)(session->stack.top + 1) - level];
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Session_apply
+  @package  session
+
+  @brief    Applies an operator or a function to the stack.
+
+  @details  Binary operators take level 2 as left and level 1 as right
+            operand; "!" takes level 1. A function of n arguments takes
+            levels n down to 1 as its arguments in call order. The operands
+            are replaced by the result.
+
+  @param    session [in/out]:   Session to update.
+  @param    token   [in]:       Operator or function name.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -EINVAL if the token is unknown, lacks operands or the operation
+            fails (e.g., division by zero).
+ =========================================================================== **/
+int Session_apply(rpn_session_t* session, const char* token)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    /*< Security Checks >*/
+    if ((session == NULL) || (token == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    ret = Session_operate(&session->stack, token);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Session_edit
+  @package  session
+
+  @brief    Replaces a range of the input line and retokenizes it.
+
+  @param    session [in/out]:   Session to update.
+  @param    offset  [in]:       Start of the replaced range.
+  @param    removed [in]:       Number of characters removed at offset.
+  @param    text    [in]:       Inserted text, not NUL-terminated; may be
+                                NULL if length is 0.
+  @param    length  [in]:       Number of characters inserted.
+
+  @return   0 on success, even if the new input does not tokenize; the
+            error is then reported by Session_preview.
+            -ENOMEM if session is NULL, or text is NULL with length > 0.
+            -EINVAL if the range is outside the input, the text contains a
+            NUL character or the result would not fit the buffer.
+ =========================================================================== **/
+int Session_edit(rpn_session_t* session, size_t offset, size_t removed, const char* text, size_t length)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    /*< Security Checks >*/
+    if ((session == NULL) || ((text == NULL) && (length > 0u)))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if (
+            (offset > session->input_length)
+                            ||
+            (removed > (session->input_length - offset))
+                            ||
+            (length >= (MAX_EXPRESSION_SIZE - (session->input_length - removed)))
+                            ||
+            ((length > 0u) && (memchr(text, '\0', length) != NULL))
+        )
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    memmove(&session->input[offset + length], &session->input[offset + removed], (session->input_length - offset - removed) + 1u);
+    if (length > 0u)
+    {
+        memcpy(&session->input[offset], text, length);
+    }
+
+    session->input_length   = (session->input_length - removed) + length;
+    session->preview_valid  = 0;
+
+    /*< A tokenizer error is kept in the session for Session_preview >*/
+    (void)Session_retokenize(session, offset, removed, length);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Session_text
+  @package  session
+
+  @brief    Returns the input line.
+
+  @param    session [in]:   Session to query.
+
+  @return   NUL-terminated input line, or NULL if session is NULL.
+ =========================================================================== **/
+const char* Session_text(const rpn_session_t* session)
+{
+    return (session == NULL) ? NULL : session->input;
+}
+
+/** ============================================================================
+  @fn       Session_preview
+  @package  session
+
+  @brief    Evaluates the input line without changing the stack.
+
+  @param    session [in/out]:   Session to evaluate.
+  @param    result  [out]:      Receives the value of the input line.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -EINVAL if the input is empty, does not tokenize, uses a
+            variable or fails to evaluate.
+ =========================================================================== **/
+int Session_preview(rpn_session_t* session, double* result)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    /*< Security Checks >*/
+    if ((session == NULL) || (result == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    if (!session->preview_valid)
+    {
+        session->preview_status = session->token_status;
+
+        if (session->preview_status == FUNCTION_SUCCESS)
+        {
+            session->preview_status = Session_evaluate(session, &session->preview_value);
+        }
+
+        session->preview_valid = 1;
+    }
+
+    ret = session->preview_status;
+    if (ret == FUNCTION_SUCCESS)
+    {
+        *result = session->preview_value;
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Session_enter
+  @package  session
+
+  @brief    Pushes the value of the input line and clears it.
+
+  @details  On an empty input line, duplicates level 1 instead.
+
+  @param    session [in/out]:   Session to update.
+
+  @return   0 on success.
+            -ENOMEM if session is NULL.
+            -EINVAL if the input does not evaluate or the stack cannot
+            take the value; the input is kept.
+ =========================================================================== **/
+int Session_enter(rpn_session_t* session)
+{
+    /*< Variable Declarations >*/
+    int ret         = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    double value    = 0.0;
+
+    /*< Security Checks >*/
+    if (session == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    if ((session->token_status == FUNCTION_SUCCESS) && (session->token_count == 0))
+    {
+        ret = Session_dup(session);
+        goto end_of_function;
+    }
+
+    ret = Session_preview(session, &value);
+    if (ret != FUNCTION_SUCCESS)
+    {
+        goto end_of_function;
+    }
+
+    ret = Stack_pushVal(&session->stack, value);
+    if (ret != FUNCTION_SUCCESS)
+    {
+        goto end_of_function;
+    }
+
+    ret = Session_edit(session, 0u, session->input_length, NULL, 0u);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Session_store
+  @package  session
+
+  @brief    Assigns a value to a named variable, creating it if needed.
+
+  @param    session [in/out]:   Session to update.
+  @param    name    [in]:       Variable name.
+  @param    value   [in]:       Value to assign.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -EINVAL if name is not a valid variable name.
+            -ENOSPC if SESSION_MAX_VARIABLES variables already exist.
+ =========================================================================== **/
+int Session_store(rpn_session_t* session, const char* name, double value)
+{
+    /*< Variable Declarations >*/
+    int ret         = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    int variable    = 0;
+
+    /*< Security Checks >*/
+    if ((session == NULL) || (name == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if ((RPNCalculator_isVariable(name) != FUNCTION_SUCCESS) || (strlen(name) >= MAX_TOKEN_LEN))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    variable = Session_findVariable(session, name);
+    if (variable < FUNCTION_SUCCESS)
+    {
+        if (session->variable_count >= SESSION_MAX_VARIABLES)
+        {
+            ret = -(ENOSPC);
+            goto end_of_function;
+        }
+
+        variable = (int)session->variable_count++;
+        strcpy(session->variables[variable].name, name);
+    }
+
+    session->variables[variable].value  = value;
+    session->preview_valid              = 0;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Session_recall
+  @package  session
+
+  @brief    Reads a named variable.
+
+  @param    session [in]:   Session to query.
+  @param    name    [in]:   Variable name.
+  @param    value   [out]:  Receives the value.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -ENOENT if the variable does not exist.
+ =========================================================================== **/
+int Session_recall(const rpn_session_t* session, const char* name, double* value)
+{
+    /*< Variable Declarations >*/
+    int ret         = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    int variable    = 0;
+
+    /*< Security Checks >*/
+    if ((session == NULL) || (name == NULL) || (value == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    variable = Session_findVariable(session, name);
+    if (variable < FUNCTION_SUCCESS)
+    {
+        ret = variable;
+        goto end_of_function;
+    }
+
+    *value = session->variables[variable].value;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Session_define
+  @package  session
+
+  @brief    Compiles an expression and stores it as a named program.
+
+  @details  The compiled block is copied into the session arena. Redefining
+            a name points it to the new block; the space of the old one is
+            not reclaimed. Programs that call natives are refused, since a
+            snapshot must be usable by another process, where the native
+            indices differ.
+
+  @param    session     [in/out]:   Session to update.
+  @param    name        [in]:       Program name.
+  @param    expression  [in]:       Infix expression.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or compilation runs out of
+            memory.
+            -EINVAL if name is not a valid name, the expression is
+            malformed or it calls a native.
+            -ENOSPC if the program table or the arena is full.
+ =========================================================================== **/
+int Session_define(rpn_session_t* session, const char* name, const char* expression)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    int index               = 0;
+    size_t size             = 0u;
+    rpn_program_t* program  = NULL;
+
+    /*< Security Checks >*/
+    if ((session == NULL) || (name == NULL) || (expression == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if ((RPNCalculator_isVariable(name) != FUNCTION_SUCCESS) || (strlen(name) >= MAX_TOKEN_LEN))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    index = Session_findProgram(session, name);
+    if ((index < FUNCTION_SUCCESS) && (session->program_count >= SESSION_MAX_PROGRAMS))
+    {
+        ret = -(ENOSPC);
+        goto end_of_function;
+    }
+
+    ret = Program_compile(expression, &program);
+    if (ret != FUNCTION_SUCCESS)
+    {
+        goto end_of_function;
+    }
+
+    /*< A native index is only valid in this process, the snapshot would not be >*/
+    if (Session_hasNative(program))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    size = ((size_t)program->size + (ARENA_ALIGNMENT - 1u)) & ~(ARENA_ALIGNMENT - 1u);
+    if (size > (SESSION_ARENA_SIZE - session->arena_used))
+    {
+        ret = -(ENOSPC);
+        goto end_of_function;
+    }
+
+    if (index < FUNCTION_SUCCESS)
+    {
+        index = (int)session->program_count++;
+        strcpy(session->programs[index].name, name);
+    }
+
+    memcpy((char*)session->arena + session->arena_used, program, program->size);
+    session->programs[index].offset = session->arena_used;
+    session->arena_used             += (uint32_t)size;
+
+    /*< Function Output >*/
+end_of_function:
+    Program_destroy(program);
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Session_run
+  @package  session
+
+  @brief    Evaluates a named program and pushes its result.
+
+  @details  The variables of the program are bound to the session variables
+            of the same name.
+
+  @param    session [in/out]:   Session to update.
+  @param    name    [in]:       Program name.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -ENOENT if the program or one of its variables does not exist.
+            -EINVAL if the evaluation fails or the stack is full.
+ =========================================================================== **/
+int Session_run(rpn_session_t* session, const char* name)
+{
+    /*< Variable Declarations >*/
+    int ret                         = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    int index                       = 0;
+    int variable                    = 0;
+    uint32_t slot                   = 0u;
+    double value                    = 0.0;
+    const rpn_program_t* program    = NULL;
+
+    double bound[MAX_NUM_TOKENS];
+
+    /*< Security Checks >*/
+    if ((session == NULL) || (name == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    index = Session_findProgram(session, name);
+    if (index < FUNCTION_SUCCESS)
+    {
+        ret = index;
+        goto end_of_function;
+    }
+
+    program = (const rpn_program_t*)((const char*)session->arena + session->programs[index].offset);
+
+    /*< Start Function Algorithm >*/
+    for (slot = 0u; slot < program->var_count; slot++)
+    {
+        variable = Session_findVariable(session, PROGRAM_VARIABLES(program)[slot]);
+        if (variable < FUNCTION_SUCCESS)
+        {
+            ret = variable;
+            goto end_of_function;
+        }
+
+        bound[slot] = session->variables[variable].value;
+    }
+
+    ret = Program_evaluateWith(program, bound, &value);
+    if (ret != FUNCTION_SUCCESS)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    ret = Stack_pushVal(&session->stack, value);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Session_save
+  @package  session
+
+  @brief    Atomically writes a snapshot of a session.
+
+  @details  Writes "<path>.tmp", flushes it to disk, renames it over path
+            and flushes the directory so the rename survives a crash.
+
+  @param    session [in]:   Session to save.
+  @param    path    [in]:   Path of the snapshot file.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -EIO if the file or its directory cannot be written.
+ =========================================================================== **/
+int Session_save(const rpn_session_t* session, const char* path)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    FILE* file              = NULL;
+    char temporary[PATH_MAX];
+
+    /*< Security Checks >*/
+    if ((session == NULL) || (path == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if (snprintf(temporary, sizeof(temporary), "%s.tmp", path) >= (int)sizeof(temporary))
+    {
+        ret = -(EIO);
+        goto end_of_function;
+    }
+
+    file = fopen(temporary, "wb");
+    if (file == NULL)
+    {
+        ret = -(EIO);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    if (
+            (fwrite(session, sizeof(rpn_session_t), 1u, file) != 1u)
+                                ||
+            (fflush(file) != 0)
+                                ||
+            (fsync(fileno(file)) != 0)
+        )
+    {
+        ret = -(EIO);
+        goto end_of_function;
+    }
+
+    fclose(file);
+    file = NULL;
+
+    if (rename(temporary, path) != 0)
+    {
+        unlink(temporary);
+        ret = -(EIO);
+        goto end_of_function;
+    }
+
+    ret = Session_syncDirectory(path);
+
+    /*< Function Output >*/
+end_of_function:
+    if (file != NULL)
+    {
+        fclose(file);
+        remove(temporary);
+    }
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Session_restore
+  @package  session
+
+  @brief    Maps a snapshot back as a session.
+
+  @details  The file is mapped privately and used in place. Release the
+            session with Session_destroy as usual. Every count, offset and
+            stored program is validated first, so a truncated or corrupted
+            file is refused rather than read out of bounds.
+
+  @param    path    [in]:   Path of the snapshot file.
+  @param    session [out]:  Receives the restored session.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -ENOENT if the file cannot be opened or mapped.
+            -EINVAL if the file is not a snapshot of this layout or a field
+            is out of range.
+ =========================================================================== **/
+int Session_restore(const char* path, rpn_session_t** session)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    int descriptor          = -1;
+    struct stat info        = {0};
+    rpn_session_t* mapping  = NULL;
+
+    /*< Security Checks >*/
+    if ((path == NULL) || (session == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    descriptor = open(path, O_RDONLY);
+    if ((descriptor < 0) || (fstat(descriptor, &info) != 0))
+    {
+        ret = -(ENOENT);
+        goto end_of_function;
+    }
+
+    if ((size_t)info.st_size != sizeof(rpn_session_t))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    mapping = mmap(NULL, sizeof(rpn_session_t), PROT_READ | PROT_WRITE, MAP_PRIVATE, descriptor, 0);
+    if (mapping == MAP_FAILED)
+    {
+        ret = -(ENOENT);
+        goto end_of_function;
+    }
+
+    if (
+            (memcmp(mapping->magic, SNAPSHOT_MAGIC, SNAPSHOT_MAGIC_SIZE) != 0)
+                                ||
+            (mapping->size != (uint32_t)sizeof(rpn_session_t))
+        )
+    {
+        munmap(mapping, sizeof(rpn_session_t));
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    ret = Session_checkSnapshot(mapping);
+    if (ret != FUNCTION_SUCCESS)
+    {
+        munmap(mapping, sizeof(rpn_session_t));
+        goto end_of_function;
+    }
+
+    mapping->mapped = 1u;
+    *session        = mapping;
+
+    /*< Function Output >*/
+end_of_function:
+    if (descriptor >= 0)
+    {
+        close(descriptor);
+    }
+    return ret;
+}
+
+/*< end of file >*/
@@ -0,0 +1,729 @@
+/** ===========================================================================
+    @ingroup    Shape
+    @addtogroup Shape_Module shape
+
+    @package    shape
+    @brief      This module evaluates large sets of constant expressions by
+                grouping those with the same structure and running each
+                group as one vectorized program.
+
+    @file       shape.c
+    @headerfile shape.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    Grouping takes two levels so that only one expression per
+                distinct skeleton is compiled. An expression is tokenized
+                once; its numbers are parsed into a constant arena and
+                replaced by a placeholder in its skeleton. Expressions whose
+                skeletons match share the program compiled for the first of
+                them, because the shunting-yard conversion keeps the numbers
+                in input order, so number k of the text is constant k of the
+                program. Skeletons whose programs have identical
+                instructions, such as "(2)+3" and "2+3", then share a shape
+                group.
+
+                Both levels use open-addressing tables keyed by FNV-1a
+                hashes, with equal hashes confirmed by comparing the tokens
+                or the instructions. The members of each group are gathered
+                with a counting sort, so every group is a contiguous run of
+                expression indices.
+
+    @see        - Shape_evaluateMany
+ =========================================================================== **/
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <math.h>
+#include <limits.h>
+#include <errno.h>
+
+/*< Implements >*/
+#include <alloc.h>
+#include <RPNCalculator.h>
+#include <program.h>
+#include <shape.h>
+
+/* ==================================== *\
+ *            PRIVATE DEFINES           *
+\* ==================================== */
+
+/** ====================================
+  @def      FUNCTION_SUCCESS
+  @package  shape
+  @brief    Indicates successful function
+            execution.
+
+  @details  Represents a successful
+            operation, typically with
+            a value of 0.
+ ==================================== **/
+#define FUNCTION_SUCCESS        (int)(0)
+
+/** ====================================
+  @def      FNV_OFFSET_BASIS
+  @package  shape
+  @brief    64-bit FNV-1a offset basis.
+ ==================================== **/
+#define FNV_OFFSET_BASIS        (uint64_t)(0xcbf29ce484222325ULL)
+
+/** ====================================
+  @def      FNV_PRIME
+  @package  shape
+  @brief    64-bit FNV-1a prime.
+ ==================================== **/
+#define FNV_PRIME               (uint64_t)(0x100000001b3ULL)
+
+/** ====================================
+  @def      NO_GROUP
+  @package  shape
+  @brief    Group of an expression that
+            failed to compile.
+ ==================================== **/
+#define NO_GROUP                (size_t)(SIZE_MAX)
+
+/** ====================================
+  @def      NUMBER_MARK
+  @package  shape
+  @brief    Stands for any number in
+            a skeleton hash.
+ ==================================== **/
+#define NUMBER_MARK             (uint8_t)(0x01U)
+
+/** ====================================
+  @def      TOKEN_MARK
+  @package  shape
+  @brief    Ends every token in a
+            skeleton hash.
+ ==================================== **/
+#define TOKEN_MARK              (uint8_t)(0x00U)
+
+/* ==================================== *\
+ *       PRIVATE TYPES DEFINITION       *
+\* ==================================== */
+
+/** ============================================================================
+  @struct   shape_group_t
+  @package  shape
+
+  @typedef  shape_group_t
+
+  @brief    Represents the expressions that share one instruction array.
+ =========================================================================== **/
+typedef struct
+{
+    uint64_t                hash;       /*< Hash of the instruction array >*/
+    const rpn_program_t*    program;    /*< Program that stands for the group >*/
+    size_t                  size;       /*< Number of members >*/
+    size_t                  first;      /*< Start of the members in the member order >*/
+} shape_group_t;
+
+/** ============================================================================
+  @struct   shape_skeleton_t
+  @package  shape
+
+  @typedef  shape_skeleton_t
+
+  @brief    Represents the expressions that share one token skeleton.
+ =========================================================================== **/
+typedef struct
+{
+    uint64_t        hash;       /*< Hash of the skeleton >*/
+    const char*     expression; /*< First expression with this skeleton >*/
+    rpn_program_t*  program;    /*< Its compiled program, NULL on failure >*/
+    int             status;     /*< Result of the compilation >*/
+    size_t          group;      /*< Shape group of the program >*/
+} shape_skeleton_t;
+
+/* ==================================== *\
+ *     PRIVATE FUNCTIONS DEFINITION     *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Shape_isNumber
+  @package  shape
+
+  @brief    Checks whether a token is a numeric literal.
+
+  @details  Uses the same rule as the compiler, so a token the compiler
+            rejects stays part of the skeleton.
+
+  @param    token   [in]:   Token to check.
+
+  @return   Non-zero if the token is a number, 0 otherwise.
+ =========================================================================== **/
+static int Shape_isNumber(const char* token)
+{
+    return isdigit((unsigned char)token[0]) || ((token[0] == '.') && isdigit((unsigned char)token[1]));
+}
+
+/** ============================================================================
+  @fn       Shape_scan
+  @package  shape
+
+  @brief    Hashes the skeleton of an expression and parses its numbers.
+
+  @param    expression  [in]:   Infix expression.
+  @param    constants   [out]:  Receives the numbers in order of appearance;
+                                room for strlen(expression) values.
+  @param    count       [out]:  Number of numbers.
+  @param    hash        [out]:  Hash of the skeleton.
+
+  @return   0 on success.
+            -EINVAL if the expression is too long, has too many tokens or an
+            unknown character.
+ =========================================================================== **/
+static int Shape_scan(const char* expression, double* constants, size_t* count, uint64_t* hash)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    int length          = 0;
+    size_t position     = 0u;
+    size_t tokens       = 0u;
+    size_t iterator     = 0u;
+
+    char token[MAX_TOKEN_LEN];
+
+    /*< Security Checks >*/
+    if (strlen(expression) >= MAX_EXPRESSION_SIZE)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    *count  = 0u;
+    *hash   = FNV_OFFSET_BASIS;
+
+    /*< Start Function Algorithm >*/
+    while ((length = RPNCalculator_nextToken(expression, &position, token)) > 0)
+    {
+        if (++tokens > MAX_NUM_TOKENS)
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+
+        if (Shape_isNumber(token))
+        {
+            constants[(*count)++]   = atof(token);
+            *hash                   = (*hash ^ NUMBER_MARK) * FNV_PRIME;
+        }
+        else
+        {
+            for (iterator = 0u; iterator < (size_t)length; iterator++)
+            {
+                *hash = (*hash ^ (uint8_t)token[iterator]) * FNV_PRIME;
+            }
+        }
+
+        *hash = (*hash ^ TOKEN_MARK) * FNV_PRIME;
+    }
+
+    ret = (length < FUNCTION_SUCCESS) ? -(EINVAL) : FUNCTION_SUCCESS;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Shape_sameSkeleton
+  @package  shape
+
+  @brief    Checks whether two expressions differ only in their numbers.
+
+  @param    left    [in]:   First expression, already scanned.
+  @param    right   [in]:   Second expression, already scanned.
+
+  @return   Non-zero if the token sequences match with numbers as
+            wildcards.
+ =========================================================================== **/
+static int Shape_sameSkeleton(const char* left, const char* right)
+{
+    size_t left_position    = 0u;
+    size_t right_position   = 0u;
+    int left_length         = 0;
+    int right_length        = 0;
+
+    char left_token[MAX_TOKEN_LEN];
+    char right_token[MAX_TOKEN_LEN];
+
+    do
+    {
+        left_length     = RPNCalculator_nextToken(left, &left_position, left_token);
+        right_length    = RPNCalculator_nextToken(right, &right_position, right_token);
+
+        if (Shape_isNumber(left_token) && Shape_isNumber(right_token) && (left_length > 0) && (right_length > 0))
+        {
+            continue;
+        }
+
+        if ((left_length != right_length) || ((left_length > 0) && (strcmp(left_token, right_token) != 0)))
+        {
+            return 0;
+        }
+    } while (left_length > 0);
+
+    return 1;
+}
+
+/** ============================================================================
+  @fn       Shape_hash
+  @package  shape
+
+  @brief    Hashes the instruction array of a program with 64-bit FNV-1a.
+
+  @details  Constants are numbered in order of appearance, so the operands
+            of OPCODE_CONST depend only on the shape and the constant values
+            never enter the hash.
+
+  @param    program [in]:   Compiled program.
+
+  @return   Hash of the instructions.
+ =========================================================================== **/
+static uint64_t Shape_hash(const rpn_program_t* program)
+{
+    const uint8_t* bytes    = (const uint8_t*)PROGRAM_CODE(program);
+    size_t length           = program->code_count * sizeof(program_instr_t);
+    size_t iterator         = 0u;
+    uint64_t hash           = FNV_OFFSET_BASIS;
+
+    for (iterator = 0u; iterator < length; iterator++)
+    {
+        hash = (hash ^ bytes[iterator]) * FNV_PRIME;
+    }
+
+    return hash;
+}
+
+/** ============================================================================
+  @fn       Shape_equal
+  @package  shape
+
+  @brief    Checks whether two programs have the same instructions.
+
+  @param    left    [in]:   First program.
+  @param    right   [in]:   Second program.
+
+  @return   Non-zero if the instruction arrays are identical.
+ =========================================================================== **/
+static int Shape_equal(const rpn_program_t* left, const rpn_program_t* right)
+{
+    return (left->code_count == right->code_count)
+                            &&
+           (memcmp(PROGRAM_CODE(left), PROGRAM_CODE(right), left->code_count * sizeof(program_instr_t)) == 0);
+}
+
+/** ============================================================================
+  @fn       Shape_slot
+  @package  shape
+
+  @brief    Finds the table slot of a hash, stopping at a match or a hole.
+
+  @details  Entries hold an index + 1 into `hashes`, 0 marks a hole. When a
+            skeleton is given, a matching hash must also have the same
+            skeleton; otherwise the programs must have the same
+            instructions.
+
+  @param    table       [in]:   Open-addressing table.
+  @param    capacity    [in]:   Number of slots, a power of two.
+  @param    hash        [in]:   Hash to look up.
+  @param    skeletons   [in]:   Skeleton table, or NULL to search groups.
+  @param    groups      [in]:   Group table, used when skeletons is NULL.
+  @param    key         [in]:   Expression or program being looked up.
+
+  @return   Slot holding the match, or the hole where it belongs.
+ =========================================================================== **/
+static size_t Shape_slot(const size_t* table, size_t capacity, uint64_t hash, const shape_skeleton_t* skeletons,
+                         const shape_group_t* groups, const void* key)
+{
+    size_t slot = (size_t)hash & (capacity - 1u);
+
+    for (; table[slot] != 0u; slot = (slot + 1u) & (capacity - 1u))
+    {
+        if (skeletons != NULL)
+        {
+            if ((skeletons[table[slot] - 1u].hash == hash) && Shape_sameSkeleton(skeletons[table[slot] - 1u].expression, key))
+            {
+                break;
+            }
+        }
+        else if ((groups[table[slot] - 1u].hash == hash) && Shape_equal(groups[table[slot] - 1u].program, key))
+        {
+            break;
+        }
+    }
+
+    return slot;
+}
+
+/** ============================================================================
+  @fn       Shape_lift
+  @package  shape
+
+  @brief    Builds the lane program of a shape.
+
+  @details  Copies the instructions of the representative and turns every
+            OPCODE_CONST k into OPCODE_VAR k, so constant k of each member
+            is read from column k.
+
+  @param    program [in]:   Representative program of the group.
+  @param    lane    [out]:  Receives the newly allocated lane program.
+
+  @return   0 on success.
+            -ENOMEM if the allocation fails.
+ =========================================================================== **/
+static int Shape_lift(const rpn_program_t* program, rpn_program_t** lane)
+{
+    /*< Variable Declarations >*/
+    int ret                             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t iterator                     = 0u;
+    size_t code_size                    = 0u;
+
+    rpn_program_t* block                = NULL;
+    program_instr_t* code               = NULL;
+    char (*variables)[MAX_TOKEN_LEN]    = NULL;
+
+    /*< Assign Initial Values >*/
+    code_size = program->code_count * sizeof(program_instr_t);
+
+    /*< Start Function Algorithm >*/
+    block = Alloc_malloc(sizeof(rpn_program_t) + code_size + (program->const_count * MAX_TOKEN_LEN));
+    if (block == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    *block              = *program;
+    block->size         = (uint32_t)(sizeof(rpn_program_t) + code_size + (program->const_count * MAX_TOKEN_LEN));
+    block->code_offset  = (uint32_t)sizeof(rpn_program_t);
+    block->const_count  = 0u;
+    block->const_offset = (uint32_t)(sizeof(rpn_program_t) + code_size);
+    block->var_count    = program->const_count;
+    block->var_offset   = block->const_offset;
+
+    code        = (program_instr_t*)PROGRAM_CODE(block);
+    variables   = (char (*)[MAX_TOKEN_LEN])((char*)block + block->var_offset);
+
+    memcpy(code, PROGRAM_CODE(program), code_size);
+
+    for (iterator = 0u; iterator < program->code_count; iterator++)
+    {
+        code[iterator].opcode = (code[iterator].opcode == OPCODE_CONST) ? OPCODE_VAR : code[iterator].opcode;
+    }
+
+    for (iterator = 0u; iterator < program->const_count; iterator++)
+    {
+        memset(variables[iterator], 0, MAX_TOKEN_LEN);
+        snprintf(variables[iterator], MAX_TOKEN_LEN, "k%zu", iterator);
+    }
+
+    *lane = block;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Shape_evaluateGroup
+  @package  shape
+
+  @brief    Evaluates every member of a shape group in one block.
+
+  @param    group       [in]:   Group to evaluate.
+  @param    members     [in]:   Expression indices of the group.
+  @param    constants   [in]:   Constant arena.
+  @param    first       [in]:   Start of the constants of each expression.
+  @param    results     [out]:  Value of each expression.
+  @param    status      [out]:  Status of each expression.
+
+  @return   Number of failed members on success.
+            -ENOMEM if an allocation fails.
+ =========================================================================== **/
+static int Shape_evaluateGroup(const shape_group_t* group, const size_t* members, const double* constants,
+                               const size_t* first, double* results, int* status)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t member           = 0u;
+    size_t constant         = 0u;
+    size_t const_count      = 0u;
+
+    rpn_program_t* lane     = NULL;
+    double* values          = NULL;
+    double* lane_results    = NULL;
+    int* lane_status        = NULL;
+    const double** columns  = NULL;
+
+    /*< Assign Initial Values >*/
+    const_count = group->program->const_count;
+
+    /*< Start Function Algorithm >*/
+    ret = Shape_lift(group->program, &lane);
+    if (ret != FUNCTION_SUCCESS)
+    {
+        goto end_of_function;
+    }
+
+    values          = Alloc_malloc(((const_count * group->size) + group->size) * sizeof(double));
+    lane_status     = Alloc_malloc(group->size * sizeof(int));
+    columns         = Alloc_malloc((const_count + 1u) * sizeof(const double*));
+    if ((values == NULL) || (lane_status == NULL) || (columns == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Column k holds constant k of every member >*/
+    for (constant = 0u; constant < const_count; constant++)
+    {
+        columns[constant] = &values[constant * group->size];
+
+        for (member = 0u; member < group->size; member++)
+        {
+            values[(constant * group->size) + member] = constants[first[members[member]] + constant];
+        }
+    }
+
+    lane_results = &values[const_count * group->size];
+
+    ret = Program_evaluateBlock(lane, columns, group->size, lane_results, lane_status);
+    if (ret < FUNCTION_SUCCESS)
+    {
+        goto end_of_function;
+    }
+
+    for (member = 0u; member < group->size; member++)
+    {
+        results[members[member]]    = lane_results[member];
+        status[members[member]]     = lane_status[member];
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    Alloc_free(columns);
+    Alloc_free(lane_status);
+    Alloc_free(values);
+    Program_destroy(lane);
+    return ret;
+}
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS DEFINITION      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Shape_evaluateMany
+  @package  shape
+
+  @brief    Evaluates many constant expressions grouped by shape.
+
+  @param    expressions [in]:   Infix expressions.
+  @param    count       [in]:   Number of expressions.
+  @param    results     [out]:  Value of each expression, NaN on failure.
+  @param    status      [out]:  0 or the error of each expression.
+  @param    shapes      [out]:  Receives the number of shape groups. May be
+                                NULL.
+
+  @return   Number of failed expressions on success, saturated at INT_MAX.
+            -ENOMEM if an argument is NULL or an allocation fails.
+ =========================================================================== **/
+int Shape_evaluateMany(const char* const* expressions, size_t count, double* results, int* status, size_t* shapes)
+{
+    /*< Variable Declarations >*/
+    int ret                         = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t iterator                 = 0u;
+    size_t capacity                 = 1u;
+    size_t slot                     = 0u;
+    size_t entry                    = 0u;
+    size_t skeleton_count           = 0u;
+    size_t group_count              = 0u;
+    size_t failed                   = 0u;
+    size_t used                     = 0u;
+    size_t room                     = 0u;
+    size_t numbers                  = 0u;
+    uint64_t hash                   = 0u;
+
+    double* constants               = NULL;
+    double* grown                   = NULL;
+    size_t* first                   = NULL;
+    size_t* group_of                = NULL;
+    size_t* skeleton_table          = NULL;
+    size_t* group_table             = NULL;
+    size_t* members                 = NULL;
+    shape_skeleton_t* skeletons     = NULL;
+    shape_skeleton_t* skeleton      = NULL;
+    shape_group_t* groups           = NULL;
+
+    /*< Security Checks >*/
+    if ((expressions == NULL) || (results == NULL) || (status == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    while (capacity < (2u * count))
+    {
+        capacity *= 2u;
+    }
+
+    first           = Alloc_malloc((count + 1u) * sizeof(size_t));
+    group_of        = Alloc_malloc((count + 1u) * sizeof(size_t));
+    members         = Alloc_malloc((count + 1u) * sizeof(size_t));
+    skeletons       = Alloc_calloc(count + 1u, sizeof(shape_skeleton_t));
+    groups          = Alloc_malloc((count + 1u) * sizeof(shape_group_t));
+    skeleton_table  = Alloc_calloc(capacity, sizeof(size_t));
+    group_table     = Alloc_calloc(capacity, sizeof(size_t));
+    if ((first == NULL) || (group_of == NULL) || (members == NULL) || (skeletons == NULL) || (groups == NULL)
+                        || (skeleton_table == NULL) || (group_table == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    for (iterator = 0u; iterator < count; iterator++)
+    {
+        group_of[iterator]  = NO_GROUP;
+        first[iterator]     = used;
+        results[iterator]   = NAN;
+        status[iterator]    = -(EINVAL);
+
+        if (expressions[iterator] == NULL)
+        {
+            failed++;
+            continue;
+        }
+
+        /*< An expression has fewer numbers than characters >*/
+        if ((room - used) < (strlen(expressions[iterator]) + 1u))
+        {
+            room    = (2u * room) + strlen(expressions[iterator]) + 1u;
+            grown   = Alloc_realloc(constants, room * sizeof(double));
+            if (grown == NULL)
+            {
+                ret = -(ENOMEM);
+                goto end_of_function;
+            }
+            constants = grown;
+        }
+
+        status[iterator] = Shape_scan(expressions[iterator], &constants[used], &numbers, &hash);
+        if (status[iterator] != FUNCTION_SUCCESS)
+        {
+            failed++;
+            continue;
+        }
+
+        /*< Table entries hold an index + 1, 0 marks an empty slot >*/
+        slot = Shape_slot(skeleton_table, capacity, hash, skeletons, NULL, expressions[iterator]);
+        if (skeleton_table[slot] == 0u)
+        {
+            skeleton                = &skeletons[skeleton_count];
+            skeleton->hash          = hash;
+            skeleton->expression    = expressions[iterator];
+            skeleton->status        = Program_compile(expressions[iterator], &skeleton->program);
+            skeleton_table[slot]    = ++skeleton_count;
+
+            if ((skeleton->status == FUNCTION_SUCCESS) && (skeleton->program->var_count > 0u))
+            {
+                skeleton->status = -(EINVAL);
+            }
+
+            if (skeleton->status == FUNCTION_SUCCESS)
+            {
+                hash = Shape_hash(skeleton->program);
+                entry = Shape_slot(group_table, capacity, hash, NULL, groups, skeleton->program);
+                if (group_table[entry] == 0u)
+                {
+                    groups[group_count].hash    = hash;
+                    groups[group_count].program = skeleton->program;
+                    groups[group_count].size    = 0u;
+                    group_table[entry]          = ++group_count;
+                }
+                skeleton->group = group_table[entry] - 1u;
+            }
+        }
+
+        skeleton            = &skeletons[skeleton_table[slot] - 1u];
+        status[iterator]    = skeleton->status;
+        if (skeleton->status != FUNCTION_SUCCESS)
+        {
+            failed++;
+            continue;
+        }
+
+        group_of[iterator] = skeleton->group;
+        groups[skeleton->group].size++;
+        used += numbers;
+    }
+
+    /*< Counting sort: each group becomes a contiguous run of members >*/
+    for (iterator = 0u, slot = 0u; iterator < group_count; iterator++)
+    {
+        groups[iterator].first  = slot;
+        slot                   += groups[iterator].size;
+        groups[iterator].size   = 0u;
+    }
+
+    for (iterator = 0u; iterator < count; iterator++)
+    {
+        if (group_of[iterator] != NO_GROUP)
+        {
+            members[groups[group_of[iterator]].first + groups[group_of[iterator]].size++] = iterator;
+        }
+    }
+
+    for (iterator = 0u; iterator < group_count; iterator++)
+    {
+        ret = Shape_evaluateGroup(&groups[iterator], &members[groups[iterator].first], constants, first, results, status);
+        if (ret < FUNCTION_SUCCESS)
+        {
+            goto end_of_function;
+        }
+
+        failed += (size_t)ret;
+    }
+
+    if (shapes != NULL)
+    {
+        *shapes = group_count;
+    }
+
+    ret = (failed > (size_t)INT_MAX) ? INT_MAX : (int)failed;
+
+    /*< Function Output >*/
+end_of_function:
+    for (iterator = 0u; iterator < skeleton_count; iterator++)
+    {
+        Program_destroy(skeletons[iterator].program);
+    }
+    Alloc_free(group_table);
+    Alloc_free(skeleton_table);
+    Alloc_free(groups);
+    Alloc_free(skeletons);
+    Alloc_free(members);
+    Alloc_free(group_of);
+    Alloc_free(first);
+    Alloc_free(constants);
+    return ret;
+}
+
+/*< end of file >*/
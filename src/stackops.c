@@ -122,7 +122,7 @@ int Stack_pushOp(stack_op_t *stack, const char* value)
         goto end_of_function;
     }
 
-    if (stack->top >= (MAX_STACK_SIZE - SIZE_OFFSET)) 
+    if (stack->top >= (int)(MAX_STACK_SIZE - SIZE_OFFSET)) 
     {
         ret = -(EINVAL);
         goto end_of_function;
@@ -284,7 +284,7 @@ int Stack_pushVal(stack_val_t *stack_val, double value)
         goto end_of_function;
     }
 
-    if (stack_val->top >= (MAX_STACK_SIZE - SIZE_OFFSET)) 
+    if (stack_val->top >= (int)(MAX_STACK_SIZE - SIZE_OFFSET)) 
     {
         ret = -(EINVAL);
         goto end_of_function;
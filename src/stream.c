@@ -0,0 +1,457 @@
+/** ===========================================================================
+    @ingroup    Stream
+    @addtogroup Stream_Module stream
+
+    @package    stream
+    @brief      This module evaluates postfix (RPN) text directly, in one
+                pass over input delivered in chunks of any size.
+
+    @file       stream.c
+    @headerfile stream.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    Stream_feed walks the chunk once. Characters of a token are
+                appended to the pending buffer; whitespace completes the
+                token, which is classified and applied to the value stack.
+                The stack starts small and doubles when full.
+
+    @see        - Stream_init
+                - Stream_feed
+                - Stream_finish
+                - Stream_evaluate
+ =========================================================================== **/
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <errno.h>
+
+/*< Implements >*/
+#include <alloc.h>
+#include <RPNCalculator.h>
+#include <stream.h>
+
+/* ==================================== *\
+ *            PRIVATE DEFINES           *
+\* ==================================== */
+
+/** ====================================
+  @def      FUNCTION_SUCCESS
+  @package  stream
+  @brief    Indicates successful function
+            execution.
+
+  @details  Represents a successful
+            operation, typically with
+            a value of 0.
+ ==================================== **/
+#define FUNCTION_SUCCESS        (int)(0)
+
+/** ====================================
+  @def      INITIAL_CAPACITY
+  @package  stream
+  @brief    Value stack entries allocated
+            by the first push.
+ ==================================== **/
+#define INITIAL_CAPACITY        (size_t)(64U)
+
+/* ==================================== *\
+ *     PRIVATE FUNCTIONS DEFINITION     *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Stream_push
+  @package  stream
+
+  @brief    Pushes a value, growing the stack when it is full.
+
+  @param    stream  [in/out]:   Stream to update.
+  @param    value   [in]:       Value to push.
+
+  @return   0 on success.
+            -ENOMEM if the stack cannot grow.
+ =========================================================================== **/
+static int Stream_push(rpn_stream_t* stream, double value)
+{
+    size_t capacity = 0u;
+    double* values  = NULL;
+
+    if (stream->depth == stream->capacity)
+    {
+        capacity    = (stream->capacity == 0u) ? INITIAL_CAPACITY : (stream->capacity * 2u);
+        values      = Alloc_realloc(stream->values, capacity * sizeof(double));
+        if (values == NULL)
+        {
+            return -(ENOMEM);
+        }
+
+        stream->values      = values;
+        stream->capacity    = capacity;
+    }
+
+    stream->values[stream->depth++] = value;
+
+    return FUNCTION_SUCCESS;
+}
+
+/** ============================================================================
+  @fn       Stream_isNumber
+  @package  stream
+
+  @brief    Checks whether a token is a numeric literal.
+
+  @details  Accepts the literals of RPNCalculator_evaluatePostfix, optionally
+            preceded by a sign.
+
+  @param    token   [in]:   NUL-terminated token.
+
+  @return   Non-zero if the token is a number, 0 otherwise.
+ =========================================================================== **/
+static int Stream_isNumber(const char* token)
+{
+    if ((token[0] == '-') || (token[0] == '+'))
+    {
+        token++;
+    }
+
+    return (isdigit((unsigned char)token[0]))
+                            ||
+           ((token[0] == '.') && (isdigit((unsigned char)token[1])));
+}
+
+/** ============================================================================
+  @fn       Stream_applyToken
+  @package  stream
+
+  @brief    Applies the pending token to the value stack.
+
+  @param    stream  [in/out]:   Stream whose pending token is complete.
+
+  @return   0 on success.
+            -ENOMEM if the stack cannot grow.
+            -EINVAL if the token is unknown, lacks operands or fails.
+ =========================================================================== **/
+static int Stream_applyToken(rpn_stream_t* stream)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    int index           = 0;
+    char* stop          = NULL;
+    double left         = 0.0;
+    double right        = 0.0;
+    const char* token   = stream->pending;
+
+    /*< Assign Initial Values >*/
+    stream->pending[stream->pending_length] = '\0';
+    stream->pending_length                  = 0u;
+
+    /*< Start Function Algorithm >*/
+    if (Stream_isNumber(token))
+    {
+        left = strtod(token, &stop);
+        if (*stop != '\0')
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+
+        ret = Stream_push(stream, left);
+        goto end_of_function;
+    }
+
+    index = RPNCalculator_functionArity(token);
+    if (index >= FUNCTION_SUCCESS)
+    {
+        if (stream->depth < (size_t)index)
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+
+        /*< The arguments lie in call order at the top of the stack >*/
+        stream->depth                       -= (size_t)index - 1u;
+        stream->values[stream->depth - 1u]  = RPNCalculator_applyFunctionArgs(token, &stream->values[stream->depth - 1u]);
+        goto end_of_function;
+    }
+
+    index = RPNCalculator_whichOperator(token);
+    if (index == OP_FACT)
+    {
+        if (stream->depth < 1u)
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+
+        left = stream->values[stream->depth - 1u];
+        if ((left < 0.0) || ((left - (int)(left)) != 0.0))
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+
+        stream->values[stream->depth - 1u] = RPNCalculator_factorialCalculate((unsigned int)left);
+        goto end_of_function;
+    }
+
+    if ((index < FUNCTION_SUCCESS) || (stream->depth < 2u))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    right   = stream->values[--stream->depth];
+    left    = stream->values[stream->depth - 1u];
+
+    if ((index == OP_DIV) && (right == 0.0))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    stream->values[stream->depth - 1u] = (index == OP_ADD) ? (left + right) :
+                                         (index == OP_SUB) ? (left - right) :
+                                         (index == OP_MUL) ? (left * right) :
+                                         (index == OP_DIV) ? (left / right) : pow(left, right);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS DEFINITION      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Stream_init
+  @package  stream
+
+  @brief    Initializes an empty stream.
+
+  @param    stream  [out]:  Stream to initialize.
+
+  @return   0 on success.
+            -ENOMEM if stream is NULL.
+ =========================================================================== **/
+int Stream_init(rpn_stream_t* stream)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    /*< Security Checks >*/
+    if (stream == NULL)
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    memset(stream, 0, sizeof(rpn_stream_t));
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Stream_release
+  @package  stream
+
+  @brief    Releases the value stack of a stream.
+
+  @param    stream  [in/out]:   Stream to release.
+ =========================================================================== **/
+void Stream_release(rpn_stream_t* stream)
+{
+    if (stream != NULL)
+    {
+        Alloc_free(stream->values);
+        memset(stream, 0, sizeof(rpn_stream_t));
+    }
+}
+
+/** ============================================================================
+  @fn       Stream_reset
+  @package  stream
+
+  @brief    Empties a stream and clears its error, keeping its allocation.
+
+  @param    stream  [in/out]:   Stream to reset.
+ =========================================================================== **/
+void Stream_reset(rpn_stream_t* stream)
+{
+    if (stream != NULL)
+    {
+        stream->depth           = 0u;
+        stream->pending_length  = 0u;
+        stream->status          = FUNCTION_SUCCESS;
+    }
+}
+
+/** ============================================================================
+  @fn       Stream_feed
+  @package  stream
+
+  @brief    Consumes the next chunk of postfix text.
+
+  @param    stream  [in/out]:   Stream to feed.
+  @param    data    [in]:       Chunk, not NUL-terminated.
+  @param    length  [in]:       Length of the chunk.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or the stack cannot grow.
+            -EINVAL if a token is unknown or too long, an operator lacks
+            operands, or an operation fails (e.g., division by zero).
+ =========================================================================== **/
+int Stream_feed(rpn_stream_t* stream, const char* data, size_t length)
+{
+    /*< Variable Declarations >*/
+    int ret         = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t iterator = 0u;
+
+    /*< Security Checks >*/
+    if ((stream == NULL) || ((data == NULL) && (length > 0u)))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if (stream->status != FUNCTION_SUCCESS)
+    {
+        ret = stream->status;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    for (iterator = 0u; iterator < length; iterator++)
+    {
+        if (!isspace((unsigned char)data[iterator]))
+        {
+            if (stream->pending_length >= (MAX_TOKEN_LEN - 1u))
+            {
+                ret = -(EINVAL);
+                break;
+            }
+
+            stream->pending[stream->pending_length++] = data[iterator];
+            continue;
+        }
+
+        if (stream->pending_length > 0u)
+        {
+            ret = Stream_applyToken(stream);
+            if (ret != FUNCTION_SUCCESS)
+            {
+                break;
+            }
+        }
+    }
+
+    stream->status = ret;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Stream_finish
+  @package  stream
+
+  @brief    Ends the input and returns the value of the expression.
+
+  @details  Applies the last token if the input did not end with whitespace
+            and checks that exactly one value is left. The stream is reset
+            afterwards, ready for the next expression.
+
+  @param    stream  [in/out]:   Stream to finish.
+  @param    result  [out]:      Receives the value of the expression.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL.
+            -EINVAL if the input was invalid or did not leave exactly one
+            value.
+ =========================================================================== **/
+int Stream_finish(rpn_stream_t* stream, double* result)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    /*< Security Checks >*/
+    if ((stream == NULL) || (result == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    ret = stream->status;
+
+    if ((ret == FUNCTION_SUCCESS) && (stream->pending_length > 0u))
+    {
+        ret = Stream_applyToken(stream);
+    }
+
+    if ((ret == FUNCTION_SUCCESS) && (stream->depth != 1u))
+    {
+        ret = -(EINVAL);
+    }
+
+    if (ret == FUNCTION_SUCCESS)
+    {
+        *result = stream->values[0];
+    }
+
+    Stream_reset(stream);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Stream_evaluate
+  @package  stream
+
+  @brief    Evaluates a complete postfix text in one call.
+
+  @param    text    [in]:   Postfix text, not NUL-terminated.
+  @param    length  [in]:   Length of the text.
+  @param    result  [out]:  Receives the value of the expression.
+
+  @return   0 on success, or the error of Stream_feed or Stream_finish.
+ =========================================================================== **/
+int Stream_evaluate(const char* text, size_t length, double* result)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    rpn_stream_t stream     = {0};
+
+    /*< Start Function Algorithm >*/
+    ret = Stream_feed(&stream, text, length);
+    if (ret != FUNCTION_SUCCESS)
+    {
+        goto end_of_function;
+    }
+
+    ret = Stream_finish(&stream, result);
+
+    /*< Function Output >*/
+end_of_function:
+    Stream_release(&stream);
+    return ret;
+}
+
+/*< end of file >*/
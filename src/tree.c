@@ -0,0 +1,570 @@
+/** ===========================================================================
+    @ingroup    Tree
+    @addtogroup Tree_Module tree
+
+    @package    tree
+    @brief      This module evaluates one very large postfix expression on a
+                work-stealing pool.
+
+    @file       tree.c
+    @headerfile tree.h
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    The tree is never built: the sizes and arities of the
+                subtrees, indexed by the position of their root, are enough
+                to find the children of any node. They are computed in one
+                sequential pass with a heap-allocated stack of sizes.
+
+                A node larger than the grain is evaluated in two walks down
+                its heavy path. The first counts the path and the children
+                to spawn so both fit in one allocation; the second spawns
+                them. The fold then walks the path bottom-up, which meets
+                the spawned children in the reverse order of their spawning,
+                so they are consumed as a stack.
+
+    @see        - Tree_evaluatePostfix
+ =========================================================================== **/
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <errno.h>
+
+/*< Implements >*/
+#include <alloc.h>
+#include <stackops.h>
+#include <RPNCalculator.h>
+#include <pool.h>
+#include <tree.h>
+
+/* ==================================== *\
+ *            PRIVATE DEFINES           *
+\* ==================================== */
+
+/** ====================================
+  @def      FUNCTION_SUCCESS
+  @package  tree
+  @brief    Indicates successful function
+            execution.
+
+  @details  Represents a successful
+            operation, typically with
+            a value of 0.
+ ==================================== **/
+#define FUNCTION_SUCCESS        (int)(0)
+
+/* ==================================== *\
+ *       PRIVATE TYPES DEFINITION       *
+\* ==================================== */
+
+/** ============================================================================
+  @struct   tree_shared_t
+  @package  tree
+
+  @typedef  tree_shared_t
+
+  @brief    Represents the expression every task works on.
+ =========================================================================== **/
+typedef struct
+{
+    char            (*postfix)[MAX_TOKEN_LEN];  /*< Postfix tokens >*/
+    size_t*         sizes;                      /*< Tokens of the subtree ending at each token >*/
+    int8_t*         arities;                    /*< Arguments taken by each token >*/
+    size_t          grain;                      /*< Largest subtree evaluated in place >*/
+    pool_t*         pool;                       /*< Pool to spawn on, or NULL >*/
+} tree_shared_t;
+
+/** ============================================================================
+  @struct   tree_task_t
+  @package  tree
+
+  @typedef  tree_task_t
+
+  @brief    Represents a subtree evaluated by a task of its own.
+ =========================================================================== **/
+typedef struct
+{
+    tree_shared_t*  shared;                     /*< Expression of the subtree >*/
+    pool_task_t*    handle;                     /*< Spawned task, or NULL to run inline >*/
+    size_t          root;                       /*< Root of the subtree >*/
+    double          value;                      /*< Value of the subtree >*/
+    int             status;                     /*< 0 or the error of the subtree >*/
+} tree_task_t;
+
+/* ==================================== *\
+ *     PRIVATE FUNCTIONS DEFINITION     *
+\* ==================================== */
+
+static int Tree_evaluateNode(tree_shared_t* shared, size_t root, double* value);
+
+/** ============================================================================
+  @fn       Tree_arity
+  @package  tree
+
+  @brief    Returns the number of arguments a postfix token takes.
+
+  @param    token   [in]:   Token to classify.
+
+  @return   0 for a number, the arity of an operator or a function.
+            -EINVAL for any other token.
+ =========================================================================== **/
+static int Tree_arity(const char* token)
+{
+    int index = 0;
+
+    if (isdigit((unsigned char)token[0]) || ((token[0] == '.') && isdigit((unsigned char)token[1])))
+    {
+        return 0;
+    }
+
+    index = RPNCalculator_whichOperator(token);
+    if (index >= FUNCTION_SUCCESS)
+    {
+        return (index == OP_FACT) ? 1 : 2;
+    }
+
+    if (RPNCalculator_whichFunction(token) >= FUNCTION_SUCCESS)
+    {
+        return RPNCalculator_functionArity(token);
+    }
+
+    return -(EINVAL);
+}
+
+/** ============================================================================
+  @fn       Tree_children
+  @package  tree
+
+  @brief    Finds the roots of the arguments of a node.
+
+  @param    shared      [in]:   Expression of the node.
+  @param    node        [in]:   Node whose arguments are wanted.
+  @param    children    [out]:  Receives the roots, first argument first.
+
+  @return   Number of arguments.
+ =========================================================================== **/
+static int Tree_children(const tree_shared_t* shared, size_t node, size_t children[MAX_FUNCTION_ARITY])
+{
+    int arity       = shared->arities[node];
+    int iterator    = 0;
+    size_t child    = node - 1u;
+
+    for (iterator = arity; iterator-- > 0; )
+    {
+        children[iterator]  = child;
+        child              -= shared->sizes[child];
+    }
+
+    return arity;
+}
+
+/** ============================================================================
+  @fn       Tree_heavy
+  @package  tree
+
+  @brief    Returns the largest argument of a node, the first on ties.
+
+  @param    shared  [in]:   Expression of the node.
+  @param    node    [in]:   Node with at least one argument.
+
+  @return   Root of the largest argument.
+ =========================================================================== **/
+static size_t Tree_heavy(const tree_shared_t* shared, size_t node)
+{
+    size_t children[MAX_FUNCTION_ARITY] = { 0 };
+    int arity       = Tree_children(shared, node, children);
+    int iterator    = 0;
+    size_t heavy    = children[0];
+
+    for (iterator = 1; iterator < arity; iterator++)
+    {
+        heavy = (shared->sizes[children[iterator]] > shared->sizes[heavy]) ? children[iterator] : heavy;
+    }
+
+    return heavy;
+}
+
+/** ============================================================================
+  @fn       Tree_apply
+  @package  tree
+
+  @brief    Applies an operator or a function to its argument values.
+
+  @details  Follows RPNCalculator_evaluatePostfix: factorials need a
+            non-negative integer, and a result of -EINVAL is a failure.
+
+  @param    token       [in]:   Operator or function.
+  @param    arguments   [in]:   Argument values, first argument first.
+  @param    value       [out]:  Receives the result.
+
+  @return   0 on success.
+            -EINVAL if the operation fails.
+ =========================================================================== **/
+static int Tree_apply(const char* token, const double* arguments, double* value)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    /*< Start Function Algorithm >*/
+    if (RPNCalculator_whichOperator(token) == OP_FACT)
+    {
+        if ((arguments[0] < 0.0) || ((arguments[0] - (int)(arguments[0])) != 0.0))
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+
+        *value = RPNCalculator_factorialCalculate((unsigned int)arguments[0]);
+        goto end_of_function;
+    }
+
+    *value = (RPNCalculator_whichOperator(token) >= FUNCTION_SUCCESS) ? RPNCalculator_applyOperation(token, arguments[0], arguments[1])
+                                                                      : RPNCalculator_applyFunctionArgs(token, arguments);
+    if (*value == -(EINVAL))
+    {
+        ret = -(EINVAL);
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Tree_leaf
+  @package  tree
+
+  @brief    Evaluates a subtree of at most MAX_STACK_SIZE tokens in place.
+
+  @param    shared  [in]:   Expression of the subtree.
+  @param    root    [in]:   Root of the subtree.
+  @param    value   [out]:  Receives the value.
+
+  @return   0 on success.
+            -EINVAL if an operation fails.
+ =========================================================================== **/
+static int Tree_leaf(const tree_shared_t* shared, size_t root, double* value)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t iterator     = 0u;
+    size_t top          = 0u;
+    int arity           = 0;
+    double stack[MAX_STACK_SIZE];
+
+    /*< Start Function Algorithm >*/
+    if (shared->sizes[root] == 1u)
+    {
+        *value = atof(shared->postfix[root]);
+        goto end_of_function;
+    }
+
+    /*< Sizes were checked, so the stack never underflows >*/
+    for (iterator = root + 1u - shared->sizes[root]; iterator <= root; iterator++)
+    {
+        arity = shared->arities[iterator];
+        if (arity == 0)
+        {
+            stack[top++] = atof(shared->postfix[iterator]);
+            continue;
+        }
+
+        top -= (size_t)arity;
+
+        ret = Tree_apply(shared->postfix[iterator], &stack[top], &stack[top]);
+        if (ret != FUNCTION_SUCCESS)
+        {
+            goto end_of_function;
+        }
+
+        top++;
+    }
+
+    *value = stack[0];
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Tree_taskRoutine
+  @package  tree
+
+  @brief    Evaluates the subtree of a spawned task.
+
+  @param    argument    [in/out]:   Task to run.
+ =========================================================================== **/
+static void Tree_taskRoutine(void* argument)
+{
+    tree_task_t* task = argument;
+
+    task->status = Tree_evaluateNode(task->shared, task->root, &task->value);
+}
+
+/** ============================================================================
+  @fn       Tree_evaluateNode
+  @package  tree
+
+  @brief    Evaluates a subtree, splitting it if it exceeds the grain.
+
+  @param    shared  [in]:   Expression of the subtree.
+  @param    root    [in]:   Root of the subtree.
+  @param    value   [out]:  Receives the value.
+
+  @return   0 on success.
+            -ENOMEM if an allocation fails.
+            -EINVAL if an operation fails.
+ =========================================================================== **/
+static int Tree_evaluateNode(tree_shared_t* shared, size_t root, double* value)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t children[MAX_FUNCTION_ARITY];
+    double arguments[MAX_FUNCTION_ARITY];
+
+    size_t* path            = NULL;
+    tree_task_t* tasks      = NULL;
+    size_t length           = 0u;
+    size_t spawned          = 0u;
+    size_t top              = 0u;
+    size_t node             = 0u;
+    size_t heavy            = 0u;
+    size_t step             = 0u;
+    double carried          = 0.0;
+    int arity               = 0;
+    int iterator            = 0;
+    int status              = FUNCTION_SUCCESS;
+
+    /*< Start Function Algorithm >*/
+    if (shared->sizes[root] <= shared->grain)
+    {
+        ret = Tree_leaf(shared, root, value);
+        goto end_of_function;
+    }
+
+    /*< First walk: count the heavy path and the children to split off >*/
+    for (node = root; shared->sizes[node] > shared->grain; node = heavy)
+    {
+        heavy = Tree_heavy(shared, node);
+        arity = Tree_children(shared, node, children);
+        for (iterator = 0; iterator < arity; iterator++)
+        {
+            spawned += ((children[iterator] != heavy) && (shared->sizes[children[iterator]] > shared->grain)) ? 1u : 0u;
+        }
+
+        length++;
+    }
+
+    path    = Alloc_malloc(length * sizeof(size_t));
+    tasks   = Alloc_calloc(spawned + 1u, sizeof(tree_task_t));
+    if ((path == NULL) || (tasks == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Second walk: record the path and spawn; a failed spawn runs inline later >*/
+    for (node = root, step = 0u; step < length; node = heavy, step++)
+    {
+        path[step]  = node;
+        heavy       = Tree_heavy(shared, node);
+
+        arity = Tree_children(shared, node, children);
+        for (iterator = 0; iterator < arity; iterator++)
+        {
+            if ((children[iterator] == heavy) || (shared->sizes[children[iterator]] <= shared->grain))
+            {
+                continue;
+            }
+
+            tasks[top].shared   = shared;
+            tasks[top].root     = children[iterator];
+
+            if (shared->pool != NULL)
+            {
+                (void)Pool_spawn(shared->pool, Tree_taskRoutine, &tasks[top], &tasks[top].handle);
+            }
+
+            top++;
+        }
+    }
+
+    /*< Fold the path bottom-up; spawned children come back in reverse order >*/
+    for (step = length; step-- > 0u; )
+    {
+        node    = path[step];
+        arity   = Tree_children(shared, node, children);
+
+        for (iterator = arity; iterator-- > 0; )
+        {
+            if (((step + 1u) < length) && (children[iterator] == path[step + 1u]))
+            {
+                arguments[iterator] = carried;
+                continue;
+            }
+
+            if (shared->sizes[children[iterator]] <= shared->grain)
+            {
+                status = Tree_leaf(shared, children[iterator], &arguments[iterator]);
+            }
+            else
+            {
+                top--;
+                if (tasks[top].handle != NULL)
+                {
+                    (void)Pool_wait(shared->pool, tasks[top].handle);
+                    tasks[top].handle = NULL;
+                }
+                else
+                {
+                    Tree_taskRoutine(&tasks[top]);
+                }
+
+                status              = tasks[top].status;
+                arguments[iterator] = tasks[top].value;
+            }
+
+            ret = (ret == FUNCTION_SUCCESS) ? status : ret;
+        }
+
+        if (ret != FUNCTION_SUCCESS)
+        {
+            goto end_of_function;
+        }
+
+        ret = Tree_apply(shared->postfix[node], arguments, &carried);
+        if (ret != FUNCTION_SUCCESS)
+        {
+            goto end_of_function;
+        }
+    }
+
+    *value = carried;
+
+    /*< Function Output >*/
+end_of_function:
+    /*< Every spawned task must be waited for, even after a failure >*/
+    while ((tasks != NULL) && (top > 0u))
+    {
+        top--;
+        if (tasks[top].handle != NULL)
+        {
+            (void)Pool_wait(shared->pool, tasks[top].handle);
+        }
+    }
+
+    Alloc_free(tasks);
+    Alloc_free(path);
+    return ret;
+}
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS DEFINITION      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Tree_evaluatePostfix
+  @package  tree
+
+  @brief    Evaluates a postfix expression, sharing its large subtrees
+            among the threads of a pool.
+
+  @param    pool    [in]:   Pool to run on. NULL evaluates on the caller.
+  @param    postfix [in]:   Postfix tokens, as RPNCalculator_infixToPostfix
+                            or Parse_infixToPostfix give them.
+  @param    count   [in]:   Number of tokens.
+  @param    grain   [in]:   Largest subtree evaluated without splitting, at
+                            most MAX_STACK_SIZE; 0 uses MAX_STACK_SIZE.
+  @param    result  [out]:  Receives the value.
+
+  @return   0 on success.
+            -ENOMEM if an argument is NULL or an allocation fails.
+            -EINVAL if the expression is malformed or fails to evaluate.
+ =========================================================================== **/
+int Tree_evaluatePostfix(pool_t* pool, char postfix[][MAX_TOKEN_LEN], size_t count, size_t grain, double* result)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    tree_shared_t shared    = { 0 };
+    size_t* stack           = NULL;
+    size_t top              = 0u;
+    size_t iterator         = 0u;
+    int arity               = 0;
+
+    /*< Security Checks >*/
+    if ((postfix == NULL) || (result == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    if ((count == 0u) || (grain > MAX_STACK_SIZE))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    shared.postfix  = postfix;
+    shared.pool     = pool;
+    shared.grain    = (grain == 0u) ? MAX_STACK_SIZE : grain;
+
+    shared.sizes    = Alloc_malloc(count * sizeof(size_t));
+    shared.arities  = Alloc_malloc(count * sizeof(int8_t));
+    stack           = Alloc_malloc(count * sizeof(size_t));
+    if ((shared.sizes == NULL) || (shared.arities == NULL) || (stack == NULL))
+    {
+        ret = -(ENOMEM);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    for (iterator = 0u; iterator < count; iterator++)
+    {
+        arity = Tree_arity(postfix[iterator]);
+        if ((arity < 0) || ((size_t)arity > top))
+        {
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+
+        shared.arities[iterator]    = (int8_t)arity;
+        shared.sizes[iterator]      = 1u;
+
+        while (arity-- > 0)
+        {
+            shared.sizes[iterator] += stack[--top];
+        }
+
+        stack[top++] = shared.sizes[iterator];
+    }
+
+    if (top != 1u)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    ret = Tree_evaluateNode(&shared, count - 1u, result);
+
+    /*< Function Output >*/
+end_of_function:
+    Alloc_free(stack);
+    Alloc_free(shared.arities);
+    Alloc_free(shared.sizes);
+    return ret;
+}
+
+/*< end of file >*/
@@ -0,0 +1,465 @@
+/** ===========================================================================
+    @ingroup    Codegen
+    @addtogroup Codegen_Module codegen
+
+    @package    rpn2c
+    @brief      This program turns infix expressions into C source and checks
+                the generated code against the interpreter.
+
+    @file       rpn2c.c
+
+    @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+    @date       18.10.2026
+
+    @details    Usage:
+
+                    rpn2c [--name NAME] [--scalar | --block] EXPRESSION
+                    rpn2c --check [EXPRESSION...]
+
+                The first form writes the functions from Codegen_emit to
+                standard output, both forms unless one is selected.
+
+                The second form generates a function per expression (a
+                built-in list when none is given), compiles them with $CC
+                (cc by default) into a shared object, loads it and compares
+                every result bit for bit with RPNCalculator_evaluatePostfix
+                on the same expression. The scalar and the block forms are
+                both checked; a failing row must match the -EINVAL that the
+                interpreter returns. The exit status is 0 only if every
+                expression matches.
+
+                Build it together with every source of src/, with -Iinc,
+                -D_GNU_SOURCE and -lm -pthread -ldl.
+
+    @note       - The check only accepts expressions without variables, since
+                  RPNCalculator_evaluatePostfix has no way to bind them.
+
+    @see        - Codegen_emit
+                - Codegen_emitExpression
+                - RPNCalculator_evaluatePostfix
+ =========================================================================== **/
+
+/* ==================================== *\
+ *             INCLUDED FILE            *
+\* ==================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <dlfcn.h>
+
+#include <RPNCalculator.h>
+#include <program.h>
+#include <codegen.h>
+
+/* ==================================== *\
+ *            PRIVATE DEFINES           *
+\* ==================================== */
+
+/** ====================================
+  @def      FUNCTION_SUCCESS
+  @package  rpn2c
+  @brief    Indicates successful function
+            execution.
+
+  @details  Represents a successful
+            operation, typically with
+            a value of 0.
+ ==================================== **/
+#define FUNCTION_SUCCESS        (int)(0)
+
+/** ====================================
+  @def      CHECK_FLAGS
+  @package  rpn2c
+  @brief    Compiler flags of the check,
+            as codegen.h requires for
+            identical bits.
+ ==================================== **/
+#define CHECK_FLAGS             "-std=c11 -O2 -ffp-contract=off -fno-builtin -fPIC -shared"
+
+/** ====================================
+  @def      CHECK_PATH_SIZE
+  @package  rpn2c
+  @brief    Size of the paths and the
+            command line of the check.
+ ==================================== **/
+#define CHECK_PATH_SIZE         (size_t)(512U)
+
+/* ==================================== *\
+ *       PRIVATE TYPES DEFINITION       *
+\* ==================================== */
+
+/** ============================================================================
+  @typedef  check_scalar_t
+  @package  rpn2c
+
+  @brief    Signature of a generated scalar function.
+ =========================================================================== **/
+typedef int (*check_scalar_t)(const double* variables, double* result);
+
+/** ============================================================================
+  @typedef  check_block_t
+  @package  rpn2c
+
+  @brief    Signature of a generated block function.
+ =========================================================================== **/
+typedef size_t (*check_block_t)(const double* const* columns, size_t rows, double* results, int* status);
+
+/* ==================================== *\
+ *  PRIVATE GLOBAL VARIABLES DEFINITION *
+\* ==================================== */
+
+/** ============================================================================
+  @var      check_expressions
+  @package  rpn2c
+
+  @brief    Expressions checked when none is given; together they cover
+            every opcode and a failing row.
+ =========================================================================== **/
+static const char* const check_expressions[] =
+{
+    "1 + 2 * 3 - 4 / 5",
+    "(0.1 + 0.2) * 3",
+    "2 ^ 0.5 + 3 ^ 2 ^ 0.5",
+    "5! / 3 + 0!",
+    "sqrt(2) * log(100) - ln(10)",
+    "sin(1) + cos(2) * tan(0.5)",
+    "sinh(1) - cosh(1) + tanh(0.3)",
+    "asin(0.5) + acos(0.2) + atan(3)",
+    "arcsin(0.1) * arccos(0.3) / arctan(7)",
+    "pow10(0.5) + pow10(3)",
+    "atan2(1, 2) + hypot(3, 4)",
+    "min(3, 4) ^ max(1.5, 2)",
+    "fma(0.1, 10, 0 - 1)",
+    "1 / (2 - 2)",
+    "(2.5)!"
+};
+
+/* ==================================== *\
+ *     PRIVATE FUNCTIONS DEFINITION     *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       Rpn2c_usage
+  @package  rpn2c
+
+  @brief    Prints the usage and returns the status of a usage error.
+ =========================================================================== **/
+static int Rpn2c_usage(void)
+{
+    fprintf(stderr, "usage: rpn2c [--name NAME] [--scalar | --block] EXPRESSION\n");
+    fprintf(stderr, "       rpn2c --check [EXPRESSION...]\n");
+
+    return EXIT_FAILURE;
+}
+
+/** ============================================================================
+  @fn       Rpn2c_reference
+  @package  rpn2c
+
+  @brief    Evaluates an expression with RPNCalculator_evaluatePostfix.
+
+  @param    expression  [in]:   Infix expression.
+  @param    value       [out]:  Receives the value, -EINVAL on failure as
+                                the interpreter reports it.
+
+  @return   0 on success.
+            -EINVAL if the expression does not convert to postfix.
+ =========================================================================== **/
+static int Rpn2c_reference(const char* expression, double* value)
+{
+    /*< Variable Declarations >*/
+    int ret                     = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    int token_count             = 0;
+    int postfix_count           = 0;
+
+    static char tokens[MAX_NUM_TOKENS][MAX_TOKEN_LEN];
+    static char postfix[MAX_NUM_TOKENS][MAX_TOKEN_LEN];
+
+    /*< Start Function Algorithm >*/
+    token_count = RPNCalculator_tokenize(expression, tokens);
+    if (token_count <= 0)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    postfix_count = RPNCalculator_infixToPostfix(tokens, postfix, token_count);
+    if (postfix_count <= 0)
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    *value = RPNCalculator_evaluatePostfix(postfix, postfix_count);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Rpn2c_compare
+  @package  rpn2c
+
+  @brief    Compares one generated function with the interpreter.
+
+  @param    library     [in]:   Loaded shared object.
+  @param    index       [in]:   Number of the function, `f<index>`.
+  @param    expression  [in]:   Expression it was generated from.
+
+  @return   0 if both forms match the interpreter bit for bit.
+            -EINVAL otherwise; the mismatch is printed.
+ =========================================================================== **/
+static int Rpn2c_compare(void* library, size_t index, const char* expression)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    check_scalar_t scalar   = NULL;
+    check_block_t block     = NULL;
+    double reference        = 0.0;
+    double value            = 0.0;
+    double row              = 0.0;
+    int status              = 0;
+    int row_status          = 0;
+    char name[32];
+
+    /*< Assign Initial Values >*/
+    snprintf(name, sizeof(name), "f%zu", index);
+    *(void**)(&scalar) = dlsym(library, name);
+    snprintf(name, sizeof(name), "f%zu_block", index);
+    *(void**)(&block) = dlsym(library, name);
+
+    /*< Security Checks >*/
+    if ((scalar == NULL) || (block == NULL) || (Rpn2c_reference(expression, &reference) != FUNCTION_SUCCESS))
+    {
+        ret = -(EINVAL);
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    status = scalar(NULL, &value);
+    (void)block(NULL, 1u, &row, &row_status);
+
+    if (status != FUNCTION_SUCCESS)
+    {
+        /*< The interpreter reports failures in band, as -EINVAL >*/
+        ret = ((reference == (double)-(EINVAL)) && (row_status == status)) ? FUNCTION_SUCCESS : -(EINVAL);
+    }
+    else
+    {
+        ret = (
+                    (row_status == FUNCTION_SUCCESS)
+                                &&
+                    (memcmp(&value, &reference, sizeof(double)) == 0)
+                                &&
+                    (memcmp(&row, &reference, sizeof(double)) == 0)
+              ) ? FUNCTION_SUCCESS : -(EINVAL);
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    printf("%-8s %-40s generated %.17g (%d), block %.17g (%d), interpreter %.17g\n",
+           (ret == FUNCTION_SUCCESS) ? "ok" : "MISMATCH", expression, value, status, row, row_status, reference);
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Rpn2c_check
+  @package  rpn2c
+
+  @brief    Generates, compiles, loads and compares a list of expressions.
+
+  @param    expressions [in]:   Expressions without variables.
+  @param    count       [in]:   Number of expressions.
+
+  @return   0 if every expression matches.
+            -EINVAL if one does not match, has variables or cannot be
+            generated.
+            -EIO if the temporary files or the compiler fail.
+ =========================================================================== **/
+static int Rpn2c_check(const char* const* expressions, size_t count)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    size_t iterator         = 0u;
+    size_t failures         = 0u;
+    FILE* source            = NULL;
+    void* library           = NULL;
+    rpn_program_t* program  = NULL;
+    const char* cc          = getenv("CC");
+
+    char directory[]        = "/tmp/rpn2cXXXXXX";
+    char source_path[CHECK_PATH_SIZE];
+    char library_path[CHECK_PATH_SIZE];
+    char command[CHECK_PATH_SIZE * 3u];
+    char name[32];
+
+    /*< Security Checks >*/
+    if (mkdtemp(directory) == NULL)
+    {
+        ret = -(EIO);
+        goto end_of_function;
+    }
+
+    /*< Assign Initial Values >*/
+    snprintf(source_path, sizeof(source_path), "%s/check.c", directory);
+    snprintf(library_path, sizeof(library_path), "%s/check.so", directory);
+    snprintf(command, sizeof(command), "%s " CHECK_FLAGS " -o %s %s -lm", ((cc != NULL) && (*cc != '\0')) ? cc : "cc",
+             library_path, source_path);
+
+    /*< Start Function Algorithm >*/
+    source = fopen(source_path, "w");
+    if (source == NULL)
+    {
+        ret = -(EIO);
+        goto end_of_function;
+    }
+
+    for (iterator = 0u; iterator < count; iterator++)
+    {
+        if ((Program_compile(expressions[iterator], &program) == FUNCTION_SUCCESS) && (program->var_count > 0u))
+        {
+            fprintf(stderr, "rpn2c: \"%s\" has variables, which the interpreter cannot bind\n", expressions[iterator]);
+            ret = -(EINVAL);
+        }
+        Program_destroy(program);
+        program = NULL;
+
+        if (ret != FUNCTION_SUCCESS)
+        {
+            goto end_of_function;
+        }
+
+        snprintf(name, sizeof(name), "f%zu", iterator);
+        if (Codegen_emitExpression(expressions[iterator], name, (unsigned int)CODEGEN_BOTH, source) != FUNCTION_SUCCESS)
+        {
+            fprintf(stderr, "rpn2c: cannot generate \"%s\"\n", expressions[iterator]);
+            ret = -(EINVAL);
+            goto end_of_function;
+        }
+    }
+
+    if (fclose(source) != 0)
+    {
+        source  = NULL;
+        ret     = -(EIO);
+        goto end_of_function;
+    }
+    source = NULL;
+
+    if (system(command) != 0)
+    {
+        fprintf(stderr, "rpn2c: \"%s\" failed\n", command);
+        ret = -(EIO);
+        goto end_of_function;
+    }
+
+    library = dlopen(library_path, RTLD_NOW | RTLD_LOCAL);
+    if (library == NULL)
+    {
+        fprintf(stderr, "rpn2c: %s\n", dlerror());
+        ret = -(EIO);
+        goto end_of_function;
+    }
+
+    for (iterator = 0u; iterator < count; iterator++)
+    {
+        failures += (Rpn2c_compare(library, iterator, expressions[iterator]) != FUNCTION_SUCCESS) ? 1u : 0u;
+    }
+
+    printf("%zu of %zu expressions match\n", count - failures, count);
+    ret = (failures == 0u) ? FUNCTION_SUCCESS : -(EINVAL);
+
+    /*< Function Output >*/
+end_of_function:
+    if (library != NULL)
+    {
+        dlclose(library);
+    }
+    if (source != NULL)
+    {
+        fclose(source);
+    }
+    unlink(library_path);
+    unlink(source_path);
+    rmdir(directory);
+    return ret;
+}
+
+/* ==================================== *\
+ *     PUBLIC FUNCTIONS DEFINITION      *
+\* ==================================== */
+
+/** ============================================================================
+  @fn       main
+  @package  rpn2c
+
+  @brief    Parses the command line and runs the generator or the check.
+
+  @param    argc    [in]:   Number of arguments.
+  @param    argv    [in]:   Arguments.
+
+  @return   EXIT_SUCCESS or EXIT_FAILURE.
+ =========================================================================== **/
+int main(int argc, char** argv)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCCESS; /*< Return Control >*/
+
+    int argument        = 1;
+    unsigned int forms  = (unsigned int)CODEGEN_BOTH;
+    const char* name    = "rpn_expression";
+
+    /*< Security Checks >*/
+    if (argc < 2)
+    {
+        return Rpn2c_usage();
+    }
+
+    /*< Start Function Algorithm >*/
+    if (strcmp(argv[1], "--check") == 0)
+    {
+        ret = (argc > 2) ? Rpn2c_check((const char* const*)&argv[2], (size_t)(argc - 2))
+                         : Rpn2c_check(check_expressions, sizeof(check_expressions) / sizeof(check_expressions[0]));
+        goto end_of_function;
+    }
+
+    for (argument = 1; (argument < (argc - 1)); argument++)
+    {
+        if ((strcmp(argv[argument], "--name") == 0) && ((argument + 2) < argc))
+        {
+            name = argv[++argument];
+        }
+        else if (strcmp(argv[argument], "--scalar") == 0)
+        {
+            forms = (unsigned int)CODEGEN_SCALAR;
+        }
+        else if (strcmp(argv[argument], "--block") == 0)
+        {
+            forms = (unsigned int)CODEGEN_BLOCK;
+        }
+        else
+        {
+            return Rpn2c_usage();
+        }
+    }
+
+    ret = Codegen_emitExpression(argv[argc - 1], name, forms, stdout);
+    if (ret != FUNCTION_SUCCESS)
+    {
+        fprintf(stderr, "rpn2c: cannot generate \"%s\": %s\n", argv[argc - 1], strerror(-ret));
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return (ret == FUNCTION_SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*< end of file >*/